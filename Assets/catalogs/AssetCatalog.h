@@ -1,31 +1,46 @@
 #pragma once
 
 #include "core/containers/Array.h"
-#include "core/containers/HashMap.h"
+#include "core/containers/ConcurrentHashMap.h"
 #include "core/containers/OpaqueID.h"
+#include "core/containers/SlotMap.h"
 #include "core/io/file_system/FileSystem.h"
 #include "core/io/serialization/InputStream.h"
 #include "core/status/Status.h"
+#include "core/status/StatusOr.h"
 
-
-
-#include "AssetsReference.h"
+#include "assets/catalogs/AssetReference.h"
 
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 
 namespace Assets {
+// Loads assets on first use and keeps them in a slot map, reloading them when their file changes.
+//
+// Assets can be resolved, looked up and removed from several threads at once. Each asset lives in its own allocation,
+// so asset pointers stay valid until that asset is removed.
 template <typename ASSET_TYPE>
 class AssetCatalog {
 private:
     Core::IO::FileSystem* fileSystem;
 
-    mutable uint64_t nextID = 0;
-    mutable Core::HashMap<Core::IO::Path, AssetTag<ASSET_TYPE>> resolvedReferences;
-    mutable Core::HashMap<AssetTag<ASSET_TYPE>, std::unique_ptr<ASSET_TYPE>> assets;
+    // Resolving an already loaded asset only reads this map, so it is sharded to keep lookups from different threads
+    // from queueing up behind each other.
+    mutable Core::ConcurrentHashMap<Core::IO::Path, AssetTag<ASSET_TYPE>> resolvedReferences;
+
+    // The file system can't stop watching a file, so each path is only watched once, however many times it is resolved
+    // and removed. Only the keys are used.
+    mutable Core::ConcurrentHashMap<Core::IO::Path, bool> watchedPaths;
+
+    // Lookups share the lock, inserting, erasing and reloading take it exclusively. Files are read and assets created
+    // before taking it.
+    mutable Core::SlotMap<std::unique_ptr<ASSET_TYPE>, AssetTag<ASSET_TYPE>> assets;
+    mutable std::shared_mutex assetsLock;
 
 protected:
-    virtual Core::StatusOr<ASSET_TYPE*> create(Core::IO::InputStream& assetData) const = 0;
-    virtual Core::Status reload(Core::IO::InputStream& assetData, T& resource) const   = 0;
+    virtual Core::StatusOr<ASSET_TYPE> create(Core::IO::InputStream& assetData) const        = 0;
+    virtual Core::Status reload(Core::IO::InputStream& assetData, ASSET_TYPE& resource) const = 0;
 
 public:
     struct ResolveResult {
@@ -36,43 +51,71 @@ public:
     AssetCatalog(Core::IO::FileSystem* fileSystem) : fileSystem(fileSystem) {}
 
     Core::StatusOr<ResolveResult> resolve(const AssetReference<ASSET_TYPE>& reference) const {
-        AssetTag<ASSET_TYPE> tag;
-
-        auto tagIterator = resolvedReferences.find(reference.path);
-        if(tagIterator == resolvedReferences.end()) {
-            ASSIGN_OR_RETURN(Core::IO::InputStream assetData, fileSystem->openFile(reference.path));
+        std::optional<AssetTag<ASSET_TYPE>> resolvedTag = resolvedReferences.find(reference.path);
+        if(resolvedTag) {
+            // The asset may have been removed since the tag was looked up
+            ASSIGN_OR_RETURN(ASSET_TYPE * asset, get(*resolvedTag));
+            return ResolveResult{.tag = *resolvedTag, .asset = asset};
+        }
 
-            ASSIGN_OR_RETURN(ASSET_TYPE * asset, create(assetData));
-            tag = AssetTag<ASSET_TYPE>(nextID++);
+        // Assets are read whole, so they are read out of a mapping of the file instead of copied through a buffer
+        ASSIGN_OR_RETURN(Core::IO::InputStream assetData, fileSystem->openMappedFileForRead(reference.path));
 
-            assets.emplace(tag, asset);
+        ASSIGN_OR_RETURN(ASSET_TYPE asset, create(assetData));
+        AssetTag<ASSET_TYPE> tag;
+        {
+            std::unique_lock lock(assetsLock);
+            tag = assets.insert(std::make_unique<ASSET_TYPE>(std::move(asset)));
+        }
 
-            filesystem->WatchForChanges(reference.path, [=]() -> bool {
-                ASSIGN_OR_RETURN(Core::IO::InputStream assetData, fileSystem->OpenFile(reference.path));
-                return this->reload(assetData, *assets[tag]);
+        // If the same path was resolved while we were loading it, the first one to finish wins and ours is dropped
+        AssetTag<ASSET_TYPE> winningTag = resolvedReferences.getOrInsert(reference.path, [&]() { return tag; });
+        if(winningTag != tag) {
+            std::unique_lock lock(assetsLock);
+            assets.erase(tag);
+            tag = winningTag;
+        } else if(watchedPaths.insert(reference.path, true)) {
+            fileSystem->watchForChanges(reference.path, [path = reference.path, this]() -> Core::Status {
+                // The path may have been removed, or removed and resolved again to a new asset, since it was watched
+                std::optional<AssetTag<ASSET_TYPE>> currentTag = resolvedReferences.find(path);
+                if(!currentTag) {
+                    return Core::Status::Ok();
+                }
+
+                // Not mapped, the file was just changed and could still be cut short while reloading it
+                ASSIGN_OR_RETURN(Core::IO::InputStream assetData, fileSystem->openFileForRead(path));
+
+                std::unique_lock lock(assetsLock);
+                std::unique_ptr<ASSET_TYPE>* asset = assets.find(*currentTag);
+                if(asset == nullptr) {
+                    return Core::Status::Ok();
+                }
+
+                return this->reload(assetData, **asset);
             });
-        } else {
-            tag = tagIterator->second;
         }
 
-        return ResolveResult{.tag = tag, .asset = assets[tag].get()};
+        ASSIGN_OR_RETURN(ASSET_TYPE * resolvedAsset, get(tag));
+        return ResolveResult{.tag = tag, .asset = resolvedAsset};
     }
 
 
     Core::StatusOr<ASSET_TYPE*> get(const AssetTag<ASSET_TYPE>& tag) const {
-        auto asset = assets.find(tag);
-        if(asset == assets.end()) {
-            return Core::Status::Error("Could not find asset with tag {}", tag);
+        std::shared_lock lock(assetsLock);
+        std::unique_ptr<ASSET_TYPE>* asset = assets.find(tag);
+        if(asset == nullptr) {
+            return Core::Status::Error("Could not find asset with tag {}", tag.value());
         } else {
             return asset->get();
         }
     }
 
     void remove(const AssetReference<ASSET_TYPE>& reference) const {
-        auto referenceIterator = resolvedReferences.find(reference.path);
-        if(referenceIterator != resolvedReferences.end()) {
-            assets.erase(referenceIterator->second);
-            resolvedReferences.erase(referenceIterator);
+        // Taking the tag out in the same step as erasing it means a path resolved again in between keeps its new asset
+        std::optional<AssetTag<ASSET_TYPE>> tag = resolvedReferences.extract(reference.path);
+        if(tag) {
+            std::unique_lock lock(assetsLock);
+            assets.erase(*tag);
         }
     }
 };
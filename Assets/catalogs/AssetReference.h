@@ -1,6 +1,7 @@
 #pragma once
 
 #include "core/containers/OpaqueID.h"
+#include "core/io/file_system/Path.h"
 
 #include <variant>
 
@@ -176,7 +176,7 @@ ToUniformDescription(const glslang::TType& type, Core::HashMap<std::string, uint
 
         std::string fieldName = std::string(fieldType.getFieldName());
 
-        buffer.properties[fieldName] = Assets::BufferProperty{
+        buffer.properties[Core::StringId(fieldName)] = Assets::BufferProperty{
               .property   = property.property,
               .byteOffset = bufferOffsets[fieldName],
               .count      = 1,
@@ -327,7 +327,7 @@ Core::Status run(const SourceFiles& inputFiles, const std::filesystem::path& out
         ASSIGN_OR_RETURN(Assets::VertexUsageName usage, GetVertexUsage(pipeInput.name, semanticsDefinitions));
         ASSIGN_OR_RETURN(Assets::VertexInputRateType rate, GetVertexRate(pipeInput.name, semanticsDefinitions));
         ASSIGN_OR_RETURN(Assets::VertexInput input, ToVertexInput(*pipeInput.getType(), usage, rate));
-        shader.vertexInputs.emplace(pipeInput.name, input);
+        shader.vertexInputs.emplace(Core::StringId(pipeInput.name), input);
 
         if(rate == Assets::VertexInputRate::PER_INSTANCE) {
             shader.instanceFormat.properties.emplace(
@@ -362,7 +362,7 @@ Core::Status run(const SourceFiles& inputFiles, const std::filesystem::path& out
 
 
         ASSIGN_OR_RETURN(Assets::ShaderUniform input, ToShaderUniform(uniform, bufferOffsets));
-        shader.uniforms.emplace(uniform.name, input);
+        shader.uniforms.emplace(Core::StringId(uniform.name), input);
     }
 
     int uniformBlockCount = program.getNumUniformBlocks();
@@ -372,7 +372,7 @@ Core::Status run(const SourceFiles& inputFiles, const std::filesystem::path& out
         Core::Log::Info(ShaderCompiler, "\t{}: {}", uniformBlock.name, uniformBlock.getType()->getCompleteString());
 
         ASSIGN_OR_RETURN(Assets::ShaderUniform input, ToShaderUniform(uniformBlock, bufferOffsets));
-        shader.uniforms.emplace(uniformBlock.name, input);
+        shader.uniforms.emplace(Core::StringId(uniformBlock.name), input);
     }
 
     ASSIGN_OR_RETURN(Core::IO::OutputStream outputStream, Core::IO::OpenFileForWrite(outputFile));
@@ -1,10 +1,14 @@
 #include "assets/importers/obj/OBJImporter.h"
 
+#include "core/containers/InlineArray.h"
 #include "core/containers/Span.h"
 
 #include "core/algorithms/Strings.h"
 #include "core/io/file_system/FileSystem.h"
+#include "core/memory/LinearArena.h"
 
+#include <algorithm>
+#include <array>
 #include <optional>
 
 namespace {
@@ -17,14 +21,29 @@ const T& OBJIndexFind(Core::Array<T>& values, int64_t index) {
         return values[index - 1];
     }
 }
+// Removes the first whitespace separated token from text and returns it
+std::string_view NextToken(std::string_view& text) {
+    std::string_view::size_type start = std::min(text.find_first_not_of(" \t"), text.size());
+    std::string_view::size_type end   = std::min(text.find_first_of(" \t", start), text.size());
+
+    std::string_view token = text.substr(start, end - start);
+    text.remove_prefix(end);
+    return token;
+}
+
+// Values that are missing from the line are left as 0
+template <u64 COUNT>
+std::array<float, COUNT> ParseFloats(std::string_view text) {
+    std::array<float, COUNT> values{};
+    Core::Algorithms::String::ParseFloats(text, Core::Span<float>(values.data(), COUNT));
+    return values;
+}
+
 struct Vector3 {
     float x, y, z;
-    Vector3(const Core::Array<std::string_view>& elements)
-      : x(Core::Algorithms::String::ParseFloat(elements[1])),
-        y(Core::Algorithms::String::ParseFloat(elements[2])),
-        z(Core::Algorithms::String::ParseFloat(elements[3])) {}
+    Vector3(const std::array<float, 3>& values) : x(values[0]), y(values[1]), z(values[2]) {}
 
-    void appendTo(Core::Array<std::byte>& data) const {
+    void appendTo(Core::Array<std::byte, Core::Memory::RemappingAllocator>& data) const {
         data.insertAll(Core::ToBytes(x));
         data.insertAll(Core::ToBytes(y));
         data.insertAll(Core::ToBytes(z));
@@ -33,10 +52,9 @@ struct Vector3 {
 
 struct Vector2 {
     float x, y;
-    Vector2(const Core::Array<std::string_view>& elements)
-      : x(Core::Algorithms::String::ParseFloat(elements[1])), y(Core::Algorithms::String::ParseFloat(elements[2])) {}
+    Vector2(const std::array<float, 2>& values) : x(values[0]), y(values[1]) {}
 
-    void appendTo(Core::Array<std::byte>& data) const {
+    void appendTo(Core::Array<std::byte, Core::Memory::RemappingAllocator>& data) const {
         data.insertAll(Core::ToBytes(x));
         data.insertAll(Core::ToBytes(y));
     }
@@ -75,35 +93,41 @@ Mesh Import(const std::filesystem::path& filename) {
     uint64_t currentMeshPartStartIndex = 0;
     std::string currentMeshPartName    = "default";
 
-    Core::Array<std::string_view> elements;
-    Core::Array<std::string_view> face;
+    // The corners of the face being read. Almost every face fits inline, only the largest polygons allocate.
+    Core::InlineArray<Core::Algorithms::String::IndexTriplet, 16> corners;
 
     const uint32_t PositionElements = 3;
     const uint32_t NormalElements   = 3;
     const uint32_t TextureElements  = 2;
 
-    Core::Array<std::string_view> lines = Core::Algorithms::String::SplitLines(data);
-    for(auto& line : lines) {
-        // There may be more than one space between elements, this will break in such a case :(
-        Core::Algorithms::String::SplitIntoBuffer(line, " \t", elements, Core::Algorithms::String::Filter::Empty);
-        if(elements.isEmpty()) {
+    // The lines only live as long as the import, so they go in a scratch arena. They are counted first so that the
+    // arena and the array both hold exactly that many, and the array never grows.
+    const u64 lineCount = std::count(data.begin(), data.end(), '\n') + 1;
+    Core::Memory::LinearArena scratch("OBJ import scratch", lineCount * sizeof(std::string_view));
+
+    Core::Array<std::string_view, Core::Memory::ResourceAllocator> lines(lineCount,
+                                                                          Core::Memory::ResourceAllocator(&scratch));
+    Core::Algorithms::String::SplitLinesIntoBuffer(data, lines);
+    for(std::string_view line : lines) {
+        std::string_view keyword = NextToken(line);
+        if(keyword.empty()) {
             continue;
         }
 
-        if(elements[0] == "v") {
-            positions.emplace(elements);
-        } else if(elements[0] == "vt") {
-            Vector2& coords = textureCoordinates.emplace(elements);
+        if(keyword == "v") {
+            positions.emplace(ParseFloats<PositionElements>(line));
+        } else if(keyword == "vt") {
+            Vector2& coords = textureCoordinates.emplace(ParseFloats<TextureElements>(line));
             coords.y        = 1.0f - coords.y;
-        } else if(elements[0] == "vn") {
-            normals.emplace(elements);
-        } else if(elements[0] == "usemtl") {
+        } else if(keyword == "vn") {
+            normals.emplace(ParseFloats<NormalElements>(line));
+        } else if(keyword == "usemtl") {
             mesh.meshParts.emplace(
-                  MeshPart{currentMeshPartName,
+                  MeshPart{Core::StringId(currentMeshPartName),
                            {currentMeshPartStartIndex, mesh.indexData.count() - currentMeshPartStartIndex}});
             currentMeshPartStartIndex = mesh.indexData.count();
-            currentMeshPartName       = elements[1];
-        } else if(elements[0] == "f") {
+            currentMeshPartName       = NextToken(line);
+        } else if(keyword == "f") {
             // We can divide by format.totalSize here, even before it is set below because we initialize it to 1.
             // See definition of VertexFormat.
             uint32_t vertexCount = 1;
@@ -112,27 +136,41 @@ Mesh Import(const std::filesystem::path& filename) {
             }
 
 
-            int faceVertices = static_cast<int>(elements.count()) - 1;
+            // Each batch fills the free capacity, or doubles it once the corners fill it, until the line runs out
+            corners.clear();
+            while(true) {
+                u64 parsedCorners = corners.count();
+                u64 batchSize     = corners.unusedCapacity() > 0 ? corners.unusedCapacity() : parsedCorners;
 
-            for(int i = 0; i < faceVertices; ++i) {
-                Core::Algorithms::String::SplitIntoBuffer(elements[i + 1], '/', face);
+                Core::Algorithms::String::BatchParseResult batch =
+                      Core::Algorithms::String::ParseIndexTriplets(line, corners.insertUninitialized(batchSize));
+                line.remove_prefix(batch.length);
+                corners.eraseAt(parsedCorners + batch.count, batchSize - batch.count);
+
+                if(batch.count < batchSize) {
+                    break;
+                }
+            }
 
+            for(uint32_t i = 0; i < corners.count(); i++) {
                 if(i > 1) {
                     mesh.indexData.insert(vertexCount + 0);
                     mesh.indexData.insert(vertexCount + i - 1);
                     mesh.indexData.insert(vertexCount + i);
                 }
 
-                int64_t vertexIndex = Core::Algorithms::String::ParseInt64(face[0]);
+                // Indices start at 1, so 0 means the part was left out
+                const Core::Algorithms::String::IndexTriplet& corner = corners[i];
+                int64_t vertexIndex                                  = corner.first;
                 std::optional<int64_t> textureCoordinateIndex;
                 std::optional<int64_t> normalIndex;
 
-                if(face.count() > 1 && face[1] != "") {
-                    textureCoordinateIndex = Core::Algorithms::String::ParseInt64(face[1]);
+                if(corner.second != 0) {
+                    textureCoordinateIndex = corner.second;
                 }
 
-                if(face.count() > 2 && face[2] != "") {
-                    normalIndex = Core::Algorithms::String::ParseInt64(face[2]);
+                if(corner.third != 0) {
+                    normalIndex = corner.third;
                 }
 
                 OBJIndexFind(positions, vertexIndex).appendTo(mesh.vertexData);
@@ -170,8 +208,9 @@ Mesh Import(const std::filesystem::path& filename) {
         }
     }
 
-    mesh.meshParts.emplace(MeshPart{currentMeshPartName,
-                                    {currentMeshPartStartIndex, mesh.indexData.count() - currentMeshPartStartIndex}});
+    mesh.meshParts.emplace(
+          MeshPart{Core::StringId(currentMeshPartName),
+                   {currentMeshPartStartIndex, mesh.indexData.count() - currentMeshPartStartIndex}});
 
     return mesh;
 }
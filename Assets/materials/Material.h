@@ -2,6 +2,7 @@
 
 #include "core/containers/Array.h"
 #include "core/containers/HashMap.h"
+#include "core/containers/StringId.h"
 
 #include "core/io/file_system/Path.h"
 
@@ -17,7 +18,7 @@ struct BufferInput {
 using MaterialInput = std::variant<TextureInput, BufferInput>;
 
 struct Material {
-    Core::HashMap<std::string, MaterialInput> inputs;
+    Core::HashMap<Core::StringId, MaterialInput> inputs;
     Core::IO::Path shaderPath;
 };
 }    // namespace Assets
\ No newline at end of file
@@ -5,6 +5,8 @@
 
 #include "core/containers/Array.h"
 #include "core/containers/HashMap.h"
+#include "core/containers/StringId.h"
+#include "core/io/serialization/Borrowed.h"
 #include "core/io/serialization/InputStream.h"
 #include "core/io/serialization/OutputStream.h"
 
@@ -32,7 +34,7 @@ constexpr std::string_view AsString(const PipelineStageType type) {
 }
 }    // namespace PipelineStage
 
-using BufferDescription = BufferLayout<std::string>;
+using BufferDescription = BufferLayout<Core::StringId>;
 
 struct SamplerDescription {
     // sampler type
@@ -73,10 +75,17 @@ struct ShaderSource {
     std::string entryPoint;
 };
 
+// A ShaderSource that borrows its code and entry point from the memory it was read from, if it can. SPIR-V is made of
+// 32-bit words, so the code is only borrowed when it's aligned for them.
+struct ShaderSourceView {
+    Core::IO::BorrowedArray<std::byte, alignof(uint32_t)> spirv;
+    Core::IO::BorrowedString entryPoint;
+};
+
 struct Shader {
     Core::HashMap<PipelineStageType, ShaderSource> stageSources;
-    Core::HashMap<std::string, ShaderUniform> uniforms;
-    Core::HashMap<std::string, VertexInput> vertexInputs;
+    Core::HashMap<Core::StringId, ShaderUniform> uniforms;
+    Core::HashMap<Core::StringId, VertexInput> vertexInputs;
     VertexFormat instanceFormat;
 };
 }    // namespace Assets
@@ -128,6 +137,19 @@ struct Deserializer<Assets::ShaderSource> {
     }
 };
 
+template <>
+struct Deserializer<Assets::ShaderSourceView> {
+    static Assets::ShaderSourceView deserialize(InputStream& stream) {
+        auto spirv      = stream.read<Core::IO::BorrowedArray<std::byte, alignof(uint32_t)>>();
+        auto entryPoint = stream.read<Core::IO::BorrowedString>();
+
+        return Assets::ShaderSourceView{
+              .spirv      = std::move(spirv),
+              .entryPoint = std::move(entryPoint),
+        };
+    }
+};
+
 template <>
 struct Serializer<Assets::Shader> {
     static void serialize(OutputStream& stream, const Assets::Shader& shader) {
@@ -142,8 +164,8 @@ template <>
 struct Deserializer<Assets::Shader> {
     static Assets::Shader deserialize(InputStream& stream) {
         auto sources  = stream.read<Core::HashMap<Assets::PipelineStageType, Assets::ShaderSource>>();
-        auto uniforms = stream.read<Core::HashMap<std::string, Assets::ShaderUniform>>();
-        auto inputs   = stream.read<Core::HashMap<std::string, Assets::VertexInput>>();
+        auto uniforms = stream.read<Core::HashMap<Core::StringId, Assets::ShaderUniform>>();
+        auto inputs   = stream.read<Core::HashMap<Core::StringId, Assets::VertexInput>>();
         auto format   = stream.read<Assets::VertexFormat>();
 
         return Assets::Shader{
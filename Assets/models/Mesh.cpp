@@ -1,64 +1,69 @@
 #include "assets/models/Mesh.h"
 
+#include "core/algorithms/Hashing.h"
+#include "core/algorithms/Sorting.h"
 #include "core/containers/Array.h"
 
-#include <algorithm>
-
-namespace {
-
-struct VertexProxy {
-    size_t index;
-    Core::Span<std::byte> data;
-
-    void appendDataTo(Core::Array<std::byte>& vertexData) const {
-        vertexData.insertAll(data);
-    }
-
-    uint32_t firstNotEqualIndex(const VertexProxy& other) const {
-        for(uint32_t i = 0; i < data.count(); i++) {
-            if(data[i] != other.data[i]) {
-                return i;
-            }
-        }
-        return data.count();
-    }
-};
-}    // namespace
+#include <cstring>
 
 namespace Assets {
 
 void Mesh::deduplicateVertices() {
     uint32_t vertexSize = vertexFormat.byteCount();
     size_t vertexCount  = vertexData.count() / vertexSize;
-    Core::Array<std::byte> dedupedVertexData;
 
-    Core::Array<VertexProxy> proxies;
+    auto vertex = [&](uint64_t index) {
+        return Core::Span<const std::byte>(&vertexData[index * vertexSize], vertexSize);
+    };
 
+    // Equal vertices hash the same, so sorting by hash puts them next to each other
+    Core::Array<Core::Algorithms::KeyIndexPair<uint64_t>> hashes(vertexCount);
     for(size_t i = 0; i < vertexCount; i++) {
-        proxies.insert(VertexProxy{
-              .index = i,
-              .data  = Core::Span(&vertexData[i * vertexSize], vertexSize),
+        hashes.insert(Core::Algorithms::KeyIndexPair<uint64_t>{
+              .key   = Core::Algorithms::HashBytes(vertex(i)),
+              .index = static_cast<uint32_t>(i),
         });
     }
+    Core::Algorithms::RadixSort(Core::ToSpan(hashes));
+
+    // Every vertex points at the first vertex with the same bytes. The sort is stable, so that's the earliest one in
+    // its run of equal hashes. Different vertices that happen to share a hash are told apart by their bytes.
+    Core::Array<uint32_t> firstCopy(0, vertexCount);
+    for(size_t runStart = 0; runStart < vertexCount;) {
+        size_t runEnd = runStart + 1;
+        while(runEnd < vertexCount && hashes[runEnd].key == hashes[runStart].key) {
+            runEnd++;
+        }
 
-    std::sort(proxies.begin(), proxies.end(), [=](const VertexProxy& a, const VertexProxy& b) {
-        uint32_t firstNotEqualIndex = a.firstNotEqualIndex(b);
-        return firstNotEqualIndex != vertexSize && a.data[firstNotEqualIndex] < b.data[firstNotEqualIndex];
-    });
+        for(size_t i = runStart; i < runEnd; i++) {
+            uint32_t index   = hashes[i].index;
+            firstCopy[index] = index;
+
+            for(size_t j = runStart; j < i; j++) {
+                uint32_t candidate = hashes[j].index;
+                if(firstCopy[candidate] == candidate &&
+                   std::memcmp(vertex(candidate).rawData(), vertex(index).rawData(), vertexSize) == 0) {
+                    firstCopy[index] = candidate;
+                    break;
+                }
+            }
+        }
 
-    Core::Array<uint32_t> indexRedirects(0, vertexCount);
+        runStart = runEnd;
+    }
 
-    uint32_t currentUniqueVertexIndex = 0;
-    const VertexProxy* uniqueVertex   = &proxies[0];
-    uniqueVertex->appendDataTo(dedupedVertexData);
+    // Unique vertices keep the order they first appear in
+    Core::Array<std::byte, Core::Memory::RemappingAllocator> dedupedVertexData;
+    Core::Array<uint32_t> indexRedirects(0, vertexCount);
 
-    for(const auto& proxy : proxies) {
-        if(uniqueVertex->firstNotEqualIndex(proxy) != vertexSize) {
-            currentUniqueVertexIndex++;
-            uniqueVertex = &proxy;
-            uniqueVertex->appendDataTo(dedupedVertexData);
+    uint32_t uniqueVertexCount = 0;
+    for(size_t i = 0; i < vertexCount; i++) {
+        if(firstCopy[i] == i) {
+            indexRedirects[i] = uniqueVertexCount++;
+            dedupedVertexData.insertAll(vertex(i));
+        } else {
+            indexRedirects[i] = indexRedirects[firstCopy[i]];
         }
-        indexRedirects[proxy.index] = currentUniqueVertexIndex;
     }
 
     for(uint32_t& index : indexData) {
@@ -68,4 +73,4 @@ void Mesh::deduplicateVertices() {
     vertexData = std::move(dedupedVertexData);
 }
 void Mesh::optimizeVertexOrder() {}
-}    // namespace Assets
\ No newline at end of file
+}    // namespace Assets
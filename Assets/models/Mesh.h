@@ -4,25 +4,39 @@
 
 #include "core/containers/Array.h"
 #include "core/containers/IndexSpan.h"
+#include "core/containers/StringId.h"
+#include "core/io/serialization/Borrowed.h"
 #include "core/io/serialization/InputStream.h"
 #include "core/io/serialization/OutputStream.h"
+#include "core/memory/Allocator.h"
 
 namespace Assets {
 
 struct MeshPart {
-    std::string name;
+    Core::StringId name;
     Core::IndexSpan indices;
 };
 
 struct Mesh {
     VertexFormat vertexFormat;
     Core::Array<MeshPart> meshParts;
-    Core::Array<std::byte> vertexData;
+    // Importers append to this vertex by vertex until it is tens of megabytes, so growing it remaps pages rather than
+    // copying them
+    Core::Array<std::byte, Core::Memory::RemappingAllocator> vertexData;
     Core::Array<uint32_t> indexData;
 
     void deduplicateVertices();
     void optimizeVertexOrder();
 };
+
+// A Mesh read without copying its vertex and index data, which point into the memory it was read from instead. It
+// is read from the same files as a Mesh.
+struct MeshView {
+    VertexFormat vertexFormat;
+    Core::Array<MeshPart> meshParts;
+    Core::IO::BorrowedArray<std::byte> vertexData;
+    Core::IO::BorrowedArray<uint32_t> indexData;
+};
 }    // namespace Assets
 
 namespace Core::IO {
@@ -37,9 +51,9 @@ struct Serializer<Assets::MeshPart> {
 template <>
 struct Deserializer<Assets::MeshPart> {
     static Assets::MeshPart deserialize(InputStream& stream) {
-        auto name    = stream.read<std::string>();
+        auto name    = stream.read<Core::StringId>();
         auto indices = stream.read<IndexSpan>();
-        return Assets::MeshPart{.name = std::move(name), .indices = indices};
+        return Assets::MeshPart{.name = name, .indices = indices};
     }
 };
 
@@ -58,7 +72,7 @@ struct Deserializer<Assets::Mesh> {
     static Assets::Mesh deserialize(InputStream& stream) {
         auto vertexFormat = stream.read<Assets::VertexFormat>();
         auto meshParts    = stream.read<Core::Array<Assets::MeshPart>>();
-        auto vertexData   = stream.read<Core::Array<std::byte>>();
+        auto vertexData   = stream.read<Core::Array<std::byte, Core::Memory::RemappingAllocator>>();
         auto indexData    = stream.read<Core::Array<uint32_t>>();
 
         return Assets::Mesh{.vertexFormat = std::move(vertexFormat),
@@ -67,4 +81,19 @@ struct Deserializer<Assets::Mesh> {
                             .indexData    = std::move(indexData)};
     }
 };
+
+template <>
+struct Deserializer<Assets::MeshView> {
+    static Assets::MeshView deserialize(InputStream& stream) {
+        auto vertexFormat = stream.read<Assets::VertexFormat>();
+        auto meshParts    = stream.read<Core::Array<Assets::MeshPart>>();
+        auto vertexData   = stream.read<Core::IO::BorrowedArray<std::byte>>();
+        auto indexData    = stream.read<Core::IO::BorrowedArray<uint32_t>>();
+
+        return Assets::MeshView{.vertexFormat = std::move(vertexFormat),
+                                .meshParts    = std::move(meshParts),
+                                .vertexData   = std::move(vertexData),
+                                .indexData    = std::move(indexData)};
+    }
+};
 }    // namespace Core::IO
\ No newline at end of file
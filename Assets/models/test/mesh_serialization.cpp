@@ -1,8 +1,10 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include "core/io/serialization/ArrayBuffer.h"
+#include "core/io/serialization/MemoryBuffer.h"
 #include "core/io/serialization/OutputStream.h"
 
+#include "assets/models/Mesh.h"
 #include "assets/models/VertexFormat.h"
 
 TEST_CASE("Vertex Format Serialization", "Serialization") {
@@ -38,4 +40,37 @@ TEST_CASE("Vertex Format Serialization", "Serialization") {
         CHECK(readProperty.byteOffset == property.byteOffset);
         CHECK(readProperty.property.elementCount == property.property.elementCount);
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Mesh View Serialization", "Serialization") {
+    using namespace Assets;
+
+    Mesh mesh{.vertexFormat = VertexFormat{},
+              .meshParts    = {MeshPart{.name = Core::StringId("part"), .indices = Core::IndexSpan(0, 3)}},
+              .vertexData   = Core::Array<std::byte, Core::Memory::RemappingAllocator>(std::byte(42), 24),
+              .indexData    = {0, 1, 2}};
+
+    Core::IO::ArrayBuffer storage;
+    Core::IO::OutputStream outStream(&storage);
+    outStream.write(mesh);
+
+    Core::IO::ReadOnlyMemoryBuffer memory(Core::ToSpan(storage.buffer()));
+    Core::IO::InputStream inStream(&memory);
+
+    MeshView view = inStream.read<MeshView>();
+
+    REQUIRE(view.meshParts.count() == 1);
+    CHECK(view.meshParts[0].name == Core::StringId("part"));
+
+    REQUIRE(view.vertexData.isBorrowed());
+    const std::byte* storageStart = storage.buffer().rawData();
+    const std::byte* storageEnd   = storageStart + storage.buffer().count();
+    CHECK(view.vertexData.span().rawData() >= storageStart);
+    CHECK(view.vertexData.span().rawData() < storageEnd);
+    REQUIRE(view.vertexData.count() == 24);
+    CHECK(view.vertexData[23] == std::byte(42));
+
+    REQUIRE(view.indexData.count() == 3);
+    CHECK(view.indexData[0] == 0);
+    CHECK(view.indexData[2] == 2);
+}
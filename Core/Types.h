@@ -16,4 +16,16 @@ using u32 = uint32_t;
 using u64 = uint64_t;
 
 using f32 = float;
-using f64 = double;
\ No newline at end of file
+using f64 = double;
+
+// MSVC accepts [[no_unique_address]] but ignores it, so empty members such as stateless allocators and comparators only
+// stop taking up space when it is spelled the MSVC way.
+#if defined(_MSC_VER)
+#define CORE_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+#define CORE_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
+// Data written by different threads is aligned to this, so that threads working on neighbouring values do not keep
+// taking the same cache line away from each other.
+constexpr u64 CacheLineSize = 64;
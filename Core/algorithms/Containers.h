@@ -6,6 +6,7 @@
 #include <set>
 #include <unordered_set>
 
+#include "core/algorithms/Ranges.h"
 #include "core/containers/Array.h"
 #include "core/status/StatusOr.h"
 
@@ -77,32 +78,26 @@ void Map(const T& before, M& after, MAPPING_FUNCTION mapper) {
 
 
 template <typename T,
+          typename ALLOCATOR,
           typename MAPPING_FUNCTION,
           typename U = std::invoke_result_t<MAPPING_FUNCTION, std::add_lvalue_reference_t<std::add_const_t<T>>>>
-Core::Array<U> Map(const Core::Array<T>& collection, MAPPING_FUNCTION transform) {
+Core::Array<U, ALLOCATOR> Map(const Core::Array<T, ALLOCATOR>& collection, MAPPING_FUNCTION transform) {
     static_assert(std::is_invocable_r_v<U, MAPPING_FUNCTION, std::add_lvalue_reference_t<std::add_const_t<T>>>);
 
-    Core::Array<U> after;
-    for(const T& element : collection) {
-        after.emplace(transform(element));
-    }
-    return after;
+    return View(collection).map(std::move(transform)).collect(collection.allocator());
 }
 
 template <
       typename T,
+      typename ALLOCATOR,
       typename MAPPING_FUNCTION,
       typename STATUS_TYPE = std::invoke_result_t<MAPPING_FUNCTION, std::add_lvalue_reference_t<std::add_const_t<T>>>,
       typename U           = STATUS_TYPE::value_type>
-Core::StatusOr<Core::Array<U>> MapWithStatus(const Core::Array<T>& collection, MAPPING_FUNCTION transform) {
-    static_assert(std::is_invocable_r_v<U, MAPPING_FUNCTION, std::add_lvalue_reference_t<std::add_const_t<T>>>);
+Core::StatusOr<Core::Array<U, ALLOCATOR>> MapWithStatus(const Core::Array<T, ALLOCATOR>& collection,
+                                                        MAPPING_FUNCTION transform) {
+    static_assert(std::is_same_v<STATUS_TYPE, Core::StatusOr<U>>);
 
-    Core::Array<U> after;
-    for(const T& element : collection) {
-        ASSIGN_OR_RETURN(U transformedElement, transform(element));
-        after.emplace(std::move(element));
-    }
-    return after;
+    return View(collection).map(std::move(transform)).collectWithStatus(collection.allocator());
 }
 
 template <typename T, typename U = typename T::value_type, typename P>
@@ -115,6 +110,11 @@ T Filter(const T& container, P predicate) {
     return filteredContainer;
 }
 
+template <typename T, typename ALLOCATOR, typename P>
+Core::Array<T, ALLOCATOR> Filter(const Core::Array<T, ALLOCATOR>& collection, P predicate) {
+    return View(collection).filter(std::move(predicate)).collect(collection.allocator());
+}
+
 template <typename T>
 bool AllEqual(const std::vector<T>& container) {
     if(container.empty()) {
@@ -0,0 +1,604 @@
+#include "core/algorithms/Hashing.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Most of the time on long inputs goes into the accumulate loop, which works on eight 64-bit lanes at once, two
+// vectors at a time with AVX2 (/arch:AVX2 or -mavx2) and four with SSE2, which every x64 compiler may use. The scalar
+// loop gives the same results.
+#if defined(__AVX2__)
+#define CORE_HASHING_AVX2 1
+#define CORE_HASHING_SSE2 0
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define CORE_HASHING_AVX2 0
+#define CORE_HASHING_SSE2 1
+#include <emmintrin.h>
+#else
+#define CORE_HASHING_AVX2 0
+#define CORE_HASHING_SSE2 0
+#endif
+
+namespace {
+// The constants, secret and structure all follow the XXH3 reference implementation (xxhash 0.8), so that the results
+// match it exactly
+constexpr u64 Prime32_1 = 0x9E3779B1;
+constexpr u64 Prime32_2 = 0x85EBCA77;
+constexpr u64 Prime32_3 = 0xC2B2AE3D;
+constexpr u64 Prime64_1 = 0x9E3779B185EBCA87;
+constexpr u64 Prime64_2 = 0xC2B2AE3D27D4EB4F;
+constexpr u64 Prime64_3 = 0x165667B19E3779F9;
+constexpr u64 Prime64_4 = 0x85EBCA77C2B2AE63;
+constexpr u64 Prime64_5 = 0x27D4EB2F165667C5;
+constexpr u64 PrimeMx1  = 0x165667919E3779F9;
+constexpr u64 PrimeMx2  = 0x9FB21C651E98DF25;
+
+constexpr u64 SecretSize    = 192;
+constexpr u64 StripeLength  = 64;
+constexpr u64 SecretConsume = 8;
+
+// Each stripe uses the secret 8 bytes further on than the last, and the accumulators are scrambled once it runs out
+constexpr u64 StripesPerBlock = (SecretSize - StripeLength) / SecretConsume;
+constexpr u64 BlockLength     = StripeLength * StripesPerBlock;
+
+constexpr u64 MidSizeMaximum     = 240;
+constexpr u64 MidSizeStartOffset = 3;
+constexpr u64 MidSizeLastOffset  = 17;
+constexpr u64 SecretSizeMinimum  = 136;
+constexpr u64 SecretMergeStart   = 11;
+constexpr u64 SecretLastStart    = 7;
+
+alignas(64) constexpr u8 DefaultSecret[SecretSize] = {
+      0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+      0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+      0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+      0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+      0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+      0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+      0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+      0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+      0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+      0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+      0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+      0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+};
+
+static_assert(std::endian::native == std::endian::little, "XXH3 reads its input as little endian words");
+
+u64 Read64(const u8* bytes) {
+    u64 value;
+    std::memcpy(&value, bytes, sizeof(value));
+    return value;
+}
+
+u32 Read32(const u8* bytes) {
+    u32 value;
+    std::memcpy(&value, bytes, sizeof(value));
+    return value;
+}
+
+Core::Algorithms::Hash128 Multiply128(u64 a, u64 b) {
+#if defined(_MSC_VER) && defined(_M_X64)
+    u64 high;
+    u64 low = _umul128(a, b, &high);
+    return Core::Algorithms::Hash128{.low = low, .high = high};
+#elif defined(__SIZEOF_INT128__)
+    unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+    return Core::Algorithms::Hash128{.low = static_cast<u64>(product), .high = static_cast<u64>(product >> 64)};
+#else
+    u64 lowLow   = (a & 0xFFFFFFFF) * (b & 0xFFFFFFFF);
+    u64 highLow  = (a >> 32) * (b & 0xFFFFFFFF);
+    u64 lowHigh  = (a & 0xFFFFFFFF) * (b >> 32);
+    u64 highHigh = (a >> 32) * (b >> 32);
+
+    u64 cross = (lowLow >> 32) + (highLow & 0xFFFFFFFF) + lowHigh;
+    return Core::Algorithms::Hash128{.low = (cross << 32) | (lowLow & 0xFFFFFFFF),
+                                     .high = (highLow >> 32) + (cross >> 32) + highHigh};
+#endif
+}
+
+// Multiplies to 128 bits and folds the halves together, which mixes far better than a 64-bit multiply
+u64 MultiplyFold64(u64 a, u64 b) {
+    Core::Algorithms::Hash128 product = Multiply128(a, b);
+    return product.low ^ product.high;
+}
+
+u64 Avalanche(u64 hash) {
+    hash ^= hash >> 37;
+    hash *= PrimeMx1;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+u64 Avalanche64(u64 hash) {
+    hash ^= hash >> 33;
+    hash *= Prime64_2;
+    hash ^= hash >> 29;
+    hash *= Prime64_3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+u64 Rrmxmx(u64 hash, u64 length) {
+    hash ^= std::rotl(hash, 49) ^ std::rotl(hash, 24);
+    hash *= PrimeMx2;
+    hash ^= (hash >> 35) + length;
+    hash *= PrimeMx2;
+    return hash ^ (hash >> 28);
+}
+
+u64 Mix16Bytes(const u8* input, const u8* secret, u64 seed) {
+    return MultiplyFold64(Read64(input) ^ (Read64(secret) + seed), Read64(input + 8) ^ (Read64(secret + 8) - seed));
+}
+
+// Long inputs use a secret with the seed folded in, rather than adding the seed in every round
+void InitializeSecret(u8* secret, u64 seed) {
+    for(u64 i = 0; i < SecretSize / 16; i++) {
+        u64 low  = Read64(DefaultSecret + 16 * i) + seed;
+        u64 high = Read64(DefaultSecret + 16 * i + 8) - seed;
+        std::memcpy(secret + 16 * i, &low, sizeof(low));
+        std::memcpy(secret + 16 * i + 8, &high, sizeof(high));
+    }
+}
+
+// Adds stripes of 64 bytes into the accumulators, each one keyed with the secret 8 bytes on from the one before
+void Accumulate(u64* accumulators, const u8* input, const u8* secret, u64 stripes) {
+#if CORE_HASHING_AVX2
+    __m256i accumulator[2] = {_mm256_load_si256(reinterpret_cast<const __m256i*>(accumulators)),
+                              _mm256_load_si256(reinterpret_cast<const __m256i*>(accumulators + 4))};
+    for(u64 stripe = 0; stripe < stripes; stripe++) {
+        const u8* stripeInput  = input + stripe * StripeLength;
+        const u8* stripeSecret = secret + stripe * SecretConsume;
+        for(u64 i = 0; i < 2; i++) {
+            __m256i data    = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(stripeInput) + i);
+            __m256i key     = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(stripeSecret) + i);
+            __m256i keyed   = _mm256_xor_si256(data, key);
+            __m256i product = _mm256_mul_epu32(keyed, _mm256_srli_epi64(keyed, 32));
+            __m256i swapped = _mm256_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+            accumulator[i]  = _mm256_add_epi64(accumulator[i], _mm256_add_epi64(product, swapped));
+        }
+    }
+    _mm256_store_si256(reinterpret_cast<__m256i*>(accumulators), accumulator[0]);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(accumulators + 4), accumulator[1]);
+#elif CORE_HASHING_SSE2
+    __m128i accumulator[4];
+    for(u64 i = 0; i < 4; i++) {
+        accumulator[i] = _mm_load_si128(reinterpret_cast<const __m128i*>(accumulators) + i);
+    }
+    for(u64 stripe = 0; stripe < stripes; stripe++) {
+        const u8* stripeInput  = input + stripe * StripeLength;
+        const u8* stripeSecret = secret + stripe * SecretConsume;
+        for(u64 i = 0; i < 4; i++) {
+            __m128i data    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(stripeInput) + i);
+            __m128i key     = _mm_loadu_si128(reinterpret_cast<const __m128i*>(stripeSecret) + i);
+            __m128i keyed   = _mm_xor_si128(data, key);
+            __m128i product = _mm_mul_epu32(keyed, _mm_srli_epi64(keyed, 32));
+            __m128i swapped = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+            accumulator[i]  = _mm_add_epi64(accumulator[i], _mm_add_epi64(product, swapped));
+        }
+    }
+    for(u64 i = 0; i < 4; i++) {
+        _mm_store_si128(reinterpret_cast<__m128i*>(accumulators) + i, accumulator[i]);
+    }
+#else
+    for(u64 stripe = 0; stripe < stripes; stripe++) {
+        const u8* stripeInput  = input + stripe * StripeLength;
+        const u8* stripeSecret = secret + stripe * SecretConsume;
+        for(u64 i = 0; i < 8; i++) {
+            u64 data  = Read64(stripeInput + 8 * i);
+            u64 keyed = data ^ Read64(stripeSecret + 8 * i);
+            accumulators[i ^ 1] += data;
+            accumulators[i] += (keyed & 0xFFFFFFFF) * (keyed >> 32);
+        }
+    }
+#endif
+}
+
+void Scramble(u64* accumulators, const u8* secret) {
+#if CORE_HASHING_AVX2
+    const __m256i prime = _mm256_set1_epi32(static_cast<int>(Prime32_1));
+    for(u64 i = 0; i < 2; i++) {
+        __m256i* accumulator = reinterpret_cast<__m256i*>(accumulators) + i;
+        __m256i value        = _mm256_load_si256(accumulator);
+        __m256i key          = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(secret) + i);
+        __m256i keyed        = _mm256_xor_si256(_mm256_xor_si256(value, _mm256_srli_epi64(value, 47)), key);
+        __m256i productLow   = _mm256_mul_epu32(keyed, prime);
+        __m256i productHigh  = _mm256_mul_epu32(_mm256_shuffle_epi32(keyed, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+        _mm256_store_si256(accumulator, _mm256_add_epi64(productLow, _mm256_slli_epi64(productHigh, 32)));
+    }
+#elif CORE_HASHING_SSE2
+    const __m128i prime = _mm_set1_epi32(static_cast<int>(Prime32_1));
+    for(u64 i = 0; i < 4; i++) {
+        __m128i* accumulator = reinterpret_cast<__m128i*>(accumulators) + i;
+        __m128i value        = _mm_load_si128(accumulator);
+        __m128i key          = _mm_loadu_si128(reinterpret_cast<const __m128i*>(secret) + i);
+        __m128i keyed        = _mm_xor_si128(_mm_xor_si128(value, _mm_srli_epi64(value, 47)), key);
+        __m128i productLow   = _mm_mul_epu32(keyed, prime);
+        __m128i productHigh  = _mm_mul_epu32(_mm_shuffle_epi32(keyed, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+        _mm_store_si128(accumulator, _mm_add_epi64(productLow, _mm_slli_epi64(productHigh, 32)));
+    }
+#else
+    for(u64 i = 0; i < 8; i++) {
+        u64 value = accumulators[i];
+        value ^= value >> 47;
+        value ^= Read64(secret + 8 * i);
+        accumulators[i] = value * Prime32_1;
+    }
+#endif
+}
+
+void InitializeAccumulators(u64* accumulators) {
+    const u64 initial[8] = {Prime32_3, Prime64_1, Prime64_2, Prime64_3, Prime64_4, Prime32_2, Prime64_5, Prime32_1};
+    std::memcpy(accumulators, initial, sizeof(initial));
+}
+
+u64 MergeAccumulators(const u64* accumulators, const u8* secret, u64 start) {
+    u64 result = start;
+    for(u64 i = 0; i < 4; i++) {
+        result += MultiplyFold64(accumulators[2 * i] ^ Read64(secret + 16 * i),
+                                 accumulators[2 * i + 1] ^ Read64(secret + 16 * i + 8));
+    }
+    return Avalanche(result);
+}
+
+// Inputs longer than MidSizeMaximum, which are the only ones that go through the accumulators
+void AccumulateLong(u64* accumulators, const u8* input, u64 length, const u8* secret) {
+    InitializeAccumulators(accumulators);
+
+    u64 blocks = (length - 1) / BlockLength;
+    for(u64 block = 0; block < blocks; block++) {
+        Accumulate(accumulators, input + block * BlockLength, secret, StripesPerBlock);
+        Scramble(accumulators, secret + SecretSize - StripeLength);
+    }
+
+    // The last partial block, and then the last 64 bytes, which may overlap the stripes before them
+    u64 stripes = ((length - 1) - BlockLength * blocks) / StripeLength;
+    Accumulate(accumulators, input + blocks * BlockLength, secret, stripes);
+    Accumulate(accumulators, input + length - StripeLength, secret + SecretSize - StripeLength - SecretLastStart, 1);
+}
+
+u64 Hash64To16(const u8* input, u64 length, const u8* secret, u64 seed) {
+    if(length > 8) {
+        u64 bitflip1 = (Read64(secret + 24) ^ Read64(secret + 32)) + seed;
+        u64 bitflip2 = (Read64(secret + 40) ^ Read64(secret + 48)) - seed;
+        u64 low      = Read64(input) ^ bitflip1;
+        u64 high     = Read64(input + length - 8) ^ bitflip2;
+        return Avalanche(length + std::byteswap(low) + high + MultiplyFold64(low, high));
+    }
+
+    if(length >= 4) {
+        seed ^= static_cast<u64>(std::byteswap(static_cast<u32>(seed))) << 32;
+        u64 bitflip = (Read64(secret + 8) ^ Read64(secret + 16)) - seed;
+        u64 value   = Read32(input + length - 4) + (static_cast<u64>(Read32(input)) << 32);
+        return Rrmxmx(value ^ bitflip, length);
+    }
+
+    if(length > 0) {
+        u32 combined = (static_cast<u32>(input[0]) << 16) | (static_cast<u32>(input[length >> 1]) << 24) |
+                       static_cast<u32>(input[length - 1]) | (static_cast<u32>(length) << 8);
+        u64 bitflip = (Read32(secret) ^ Read32(secret + 4)) + seed;
+        return Avalanche64(combined ^ bitflip);
+    }
+
+    return Avalanche64(seed ^ Read64(secret + 56) ^ Read64(secret + 64));
+}
+
+u64 Hash64To128(const u8* input, u64 length, const u8* secret, u64 seed) {
+    u64 accumulator = length * Prime64_1;
+    if(length > 32) {
+        if(length > 64) {
+            if(length > 96) {
+                accumulator += Mix16Bytes(input + 48, secret + 96, seed);
+                accumulator += Mix16Bytes(input + length - 64, secret + 112, seed);
+            }
+            accumulator += Mix16Bytes(input + 32, secret + 64, seed);
+            accumulator += Mix16Bytes(input + length - 48, secret + 80, seed);
+        }
+        accumulator += Mix16Bytes(input + 16, secret + 32, seed);
+        accumulator += Mix16Bytes(input + length - 32, secret + 48, seed);
+    }
+    accumulator += Mix16Bytes(input, secret, seed);
+    accumulator += Mix16Bytes(input + length - 16, secret + 16, seed);
+    return Avalanche(accumulator);
+}
+
+u64 Hash64To240(const u8* input, u64 length, const u8* secret, u64 seed) {
+    u64 accumulator = length * Prime64_1;
+    for(u64 i = 0; i < 8; i++) {
+        accumulator += Mix16Bytes(input + 16 * i, secret + 16 * i, seed);
+    }
+    accumulator = Avalanche(accumulator);
+
+    for(u64 i = 8; i < length / 16; i++) {
+        accumulator += Mix16Bytes(input + 16 * i, secret + 16 * (i - 8) + MidSizeStartOffset, seed);
+    }
+    accumulator += Mix16Bytes(input + length - 16, secret + SecretSizeMinimum - MidSizeLastOffset, seed);
+    return Avalanche(accumulator);
+}
+
+u64 Hash64Short(const u8* input, u64 length, u64 seed) {
+    if(length <= 16) {
+        return Hash64To16(input, length, DefaultSecret, seed);
+    }
+    if(length <= 128) {
+        return Hash64To128(input, length, DefaultSecret, seed);
+    }
+    return Hash64To240(input, length, DefaultSecret, seed);
+}
+
+u64 Finish64Long(const u64* accumulators, u64 length, const u8* secret) {
+    return MergeAccumulators(accumulators, secret + SecretMergeStart, length * Prime64_1);
+}
+
+Core::Algorithms::Hash128 Finish128Long(const u64* accumulators, u64 length, const u8* secret) {
+    return Core::Algorithms::Hash128{
+          .low  = MergeAccumulators(accumulators, secret + SecretMergeStart, length * Prime64_1),
+          .high = MergeAccumulators(
+                accumulators, secret + SecretSize - StripeLength - SecretMergeStart, ~(length * Prime64_2)),
+    };
+}
+
+Core::Algorithms::Hash128 Hash128To16(const u8* input, u64 length, const u8* secret, u64 seed) {
+    if(length > 8) {
+        u64 bitflipLow  = (Read64(secret + 32) ^ Read64(secret + 40)) - seed;
+        u64 bitflipHigh = (Read64(secret + 48) ^ Read64(secret + 56)) + seed;
+        u64 low         = Read64(input);
+        u64 high        = Read64(input + length - 8);
+
+        Core::Algorithms::Hash128 mixed = Multiply128(low ^ high ^ bitflipLow, Prime64_1);
+        mixed.low += (length - 1) << 54;
+        high ^= bitflipHigh;
+        mixed.high += high + (high & 0xFFFFFFFF) * (Prime32_2 - 1);
+        mixed.low ^= std::byteswap(mixed.high);
+
+        Core::Algorithms::Hash128 result = Multiply128(mixed.low, Prime64_2);
+        result.high += mixed.high * Prime64_2;
+        return Core::Algorithms::Hash128{.low = Avalanche(result.low), .high = Avalanche(result.high)};
+    }
+
+    if(length >= 4) {
+        seed ^= static_cast<u64>(std::byteswap(static_cast<u32>(seed))) << 32;
+        u64 value   = Read32(input) + (static_cast<u64>(Read32(input + length - 4)) << 32);
+        u64 bitflip = (Read64(secret + 16) ^ Read64(secret + 24)) + seed;
+
+        Core::Algorithms::Hash128 mixed = Multiply128(value ^ bitflip, Prime64_1 + (length << 2));
+        mixed.high += mixed.low << 1;
+        mixed.low ^= mixed.high >> 3;
+        mixed.low ^= mixed.low >> 35;
+        mixed.low *= PrimeMx2;
+        mixed.low ^= mixed.low >> 28;
+        return Core::Algorithms::Hash128{.low = mixed.low, .high = Avalanche(mixed.high)};
+    }
+
+    if(length > 0) {
+        u32 combinedLow = (static_cast<u32>(input[0]) << 16) | (static_cast<u32>(input[length >> 1]) << 24) |
+                          static_cast<u32>(input[length - 1]) | (static_cast<u32>(length) << 8);
+        u32 combinedHigh = std::rotl(std::byteswap(combinedLow), 13);
+        u64 bitflipLow   = (Read32(secret) ^ Read32(secret + 4)) + seed;
+        u64 bitflipHigh  = (Read32(secret + 8) ^ Read32(secret + 12)) - seed;
+        return Core::Algorithms::Hash128{.low  = Avalanche64(combinedLow ^ bitflipLow),
+                                         .high = Avalanche64(combinedHigh ^ bitflipHigh)};
+    }
+
+    return Core::Algorithms::Hash128{.low  = Avalanche64(seed ^ Read64(secret + 64) ^ Read64(secret + 72)),
+                                     .high = Avalanche64(seed ^ Read64(secret + 80) ^ Read64(secret + 88))};
+}
+
+void Mix32Bytes(Core::Algorithms::Hash128& accumulator,
+                const u8* first,
+                const u8* second,
+                const u8* secret,
+                u64 seed) {
+    accumulator.low += Mix16Bytes(first, secret, seed);
+    accumulator.low ^= Read64(second) + Read64(second + 8);
+    accumulator.high += Mix16Bytes(second, secret + 16, seed);
+    accumulator.high ^= Read64(first) + Read64(first + 8);
+}
+
+Core::Algorithms::Hash128 Finish128Short(const Core::Algorithms::Hash128& accumulator, u64 length, u64 seed) {
+    u64 low  = accumulator.low + accumulator.high;
+    u64 high = accumulator.low * Prime64_1 + accumulator.high * Prime64_4 + (length - seed) * Prime64_2;
+    return Core::Algorithms::Hash128{.low = Avalanche(low), .high = 0 - Avalanche(high)};
+}
+
+Core::Algorithms::Hash128 Hash128To128(const u8* input, u64 length, const u8* secret, u64 seed) {
+    Core::Algorithms::Hash128 accumulator{.low = length * Prime64_1, .high = 0};
+    if(length > 32) {
+        if(length > 64) {
+            if(length > 96) {
+                Mix32Bytes(accumulator, input + 48, input + length - 64, secret + 96, seed);
+            }
+            Mix32Bytes(accumulator, input + 32, input + length - 48, secret + 64, seed);
+        }
+        Mix32Bytes(accumulator, input + 16, input + length - 32, secret + 32, seed);
+    }
+    Mix32Bytes(accumulator, input, input + length - 16, secret, seed);
+    return Finish128Short(accumulator, length, seed);
+}
+
+Core::Algorithms::Hash128 Hash128To240(const u8* input, u64 length, const u8* secret, u64 seed) {
+    Core::Algorithms::Hash128 accumulator{.low = length * Prime64_1, .high = 0};
+    for(u64 i = 32; i < 160; i += 32) {
+        Mix32Bytes(accumulator, input + i - 32, input + i - 16, secret + i - 32, seed);
+    }
+    accumulator.low  = Avalanche(accumulator.low);
+    accumulator.high = Avalanche(accumulator.high);
+
+    for(u64 i = 160; i <= length; i += 32) {
+        Mix32Bytes(accumulator, input + i - 32, input + i - 16, secret + MidSizeStartOffset + i - 160, seed);
+    }
+    Mix32Bytes(accumulator,
+               input + length - 16,
+               input + length - 32,
+               secret + SecretSizeMinimum - MidSizeLastOffset - 16,
+               0 - seed);
+    return Finish128Short(accumulator, length, seed);
+}
+
+Core::Algorithms::Hash128 Hash128Short(const u8* input, u64 length, u64 seed) {
+    if(length <= 16) {
+        return Hash128To16(input, length, DefaultSecret, seed);
+    }
+    if(length <= 128) {
+        return Hash128To128(input, length, DefaultSecret, seed);
+    }
+    return Hash128To240(input, length, DefaultSecret, seed);
+}
+
+// Accumulates whole stripes, scrambling whenever the stripes so far reach the end of a block
+void ConsumeStripes(u64* accumulators, u64& stripesSoFar, const u8* input, u64 stripes, const u8* secret) {
+    while(stripes > 0) {
+        u64 stripesNow = std::min(stripes, StripesPerBlock - stripesSoFar);
+        Accumulate(accumulators, input, secret + stripesSoFar * SecretConsume, stripesNow);
+        input += stripesNow * StripeLength;
+        stripes -= stripesNow;
+        stripesSoFar += stripesNow;
+
+        if(stripesSoFar == StripesPerBlock) {
+            Scramble(accumulators, secret + SecretSize - StripeLength);
+            stripesSoFar = 0;
+        }
+    }
+}
+
+// The accumulators as they would be after the rest of the buffer, and the last stripe, were added
+void FinishAccumulators(u64* accumulators,
+                        u64 stripesSoFar,
+                        const u8* buffer,
+                        u64 bufferSize,
+                        u64 bufferedSize,
+                        const u8* secret) {
+    const u8* lastStripe;
+    alignas(64) u8 joinedStripe[StripeLength];
+    if(bufferedSize >= StripeLength) {
+        u64 stripes = (bufferedSize - 1) / StripeLength;
+        ConsumeStripes(accumulators, stripesSoFar, buffer, stripes, secret);
+        lastStripe = buffer + bufferedSize - StripeLength;
+    } else {
+        // The last stripe starts in the bytes kept from before the buffer was last refilled
+        u64 fromBefore = StripeLength - bufferedSize;
+        std::memcpy(joinedStripe, buffer + bufferSize - fromBefore, fromBefore);
+        std::memcpy(joinedStripe + fromBefore, buffer, bufferedSize);
+        lastStripe = joinedStripe;
+    }
+
+    Accumulate(accumulators, lastStripe, secret + SecretSize - StripeLength - SecretLastStart, 1);
+}
+// The seed only changes the secret of long inputs, so the default secret can be used as it is for seed 0
+const u8* LongSecret(u64 seed, u8* customSecret) {
+    if(seed == 0) {
+        return DefaultSecret;
+    }
+
+    InitializeSecret(customSecret, seed);
+    return customSecret;
+}
+}    // namespace
+
+namespace Core::Algorithms {
+
+u64 HashBytes(Span<const byte> bytes, u64 seed) {
+    const u8* input = reinterpret_cast<const u8*>(bytes.rawData());
+    if(bytes.count() <= MidSizeMaximum) {
+        return Hash64Short(input, bytes.count(), seed);
+    }
+
+    alignas(64) u8 customSecret[SecretSize];
+    alignas(64) u64 accumulators[8];
+    const u8* secret = LongSecret(seed, customSecret);
+    AccumulateLong(accumulators, input, bytes.count(), secret);
+    return Finish64Long(accumulators, bytes.count(), secret);
+}
+
+Hash128 HashBytes128(Span<const byte> bytes, u64 seed) {
+    const u8* input = reinterpret_cast<const u8*>(bytes.rawData());
+    if(bytes.count() <= MidSizeMaximum) {
+        return Hash128Short(input, bytes.count(), seed);
+    }
+
+    alignas(64) u8 customSecret[SecretSize];
+    alignas(64) u64 accumulators[8];
+    const u8* secret = LongSecret(seed, customSecret);
+    AccumulateLong(accumulators, input, bytes.count(), secret);
+    return Finish128Long(accumulators, bytes.count(), secret);
+}
+
+StreamingHasher::StreamingHasher(u64 seed) {
+    reset(seed);
+}
+
+void StreamingHasher::reset(u64 newSeed) {
+    InitializeAccumulators(accumulators);
+    if(newSeed == 0) {
+        std::memcpy(secret, DefaultSecret, SecretSize);
+    } else {
+        InitializeSecret(secret, newSeed);
+    }
+
+    bufferedSize = 0;
+    stripesSoFar = 0;
+    totalLength  = 0;
+    seed         = newSeed;
+}
+
+void StreamingHasher::update(Span<const byte> bytes) {
+    const u8* input = reinterpret_cast<const u8*>(bytes.rawData());
+    const u8* end   = input + bytes.count();
+    totalLength += bytes.count();
+
+    if(bytes.count() <= BufferSize - bufferedSize) {
+        std::memcpy(buffer + bufferedSize, input, bytes.count());
+        bufferedSize += bytes.count();
+        return;
+    }
+
+    // The buffer is only consumed once more input arrives, so that the last stripe is always still in it to finish
+    if(bufferedSize > 0) {
+        u64 filling = BufferSize - bufferedSize;
+        std::memcpy(buffer + bufferedSize, input, filling);
+        input += filling;
+        ConsumeStripes(accumulators, stripesSoFar, buffer, BufferSize / StripeLength, secret);
+        bufferedSize = 0;
+    }
+
+    if(static_cast<u64>(end - input) > BufferSize) {
+        u64 stripes = (end - input - 1) / StripeLength;
+        ConsumeStripes(accumulators, stripesSoFar, input, stripes, secret);
+        input += stripes * StripeLength;
+
+        // Finishing may need the 64 bytes before the ones left over
+        std::memcpy(buffer + BufferSize - StripeLength, input - StripeLength, StripeLength);
+    }
+
+    std::memcpy(buffer, input, end - input);
+    bufferedSize = end - input;
+}
+
+u64 StreamingHasher::finish() const {
+    if(totalLength <= MidSizeMaximum) {
+        return Hash64Short(buffer, totalLength, seed);
+    }
+
+    alignas(64) u64 finished[8];
+    std::memcpy(finished, accumulators, sizeof(finished));
+    FinishAccumulators(finished, stripesSoFar, buffer, BufferSize, bufferedSize, secret);
+    return Finish64Long(finished, totalLength, secret);
+}
+
+Hash128 StreamingHasher::finish128() const {
+    if(totalLength <= MidSizeMaximum) {
+        return Hash128Short(buffer, totalLength, seed);
+    }
+
+    alignas(64) u64 finished[8];
+    std::memcpy(finished, accumulators, sizeof(finished));
+    FinishAccumulators(finished, stripesSoFar, buffer, BufferSize, bufferedSize, secret);
+    return Finish128Long(finished, totalLength, secret);
+}
+
+}    // namespace Core::Algorithms
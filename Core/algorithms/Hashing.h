@@ -1,11 +1,67 @@
 #pragma once
 
+#include "core/Types.h"
+#include "core/containers/Span.h"
+
 #include <functional>
 
 namespace Core::Algorithms {
+
+struct Hash128 {
+    u64 low  = 0;
+    u64 high = 0;
+
+    bool operator==(const Hash128& other) const = default;
+};
+
+// XXH3, a fast non-cryptographic hash with good quality over any length of input. The results are the same as the
+// reference XXH3_64bits_withSeed and XXH3_128bits_withSeed on every platform, so they can be stored, for example as
+// the key of a content addressed cache. Use the 128-bit variant for that, where a collision would be a silent bug.
+[[nodiscard]] u64 HashBytes(Span<const byte> bytes, u64 seed = 0);
+[[nodiscard]] Hash128 HashBytes128(Span<const byte> bytes, u64 seed = 0);
+
+// Hashes bytes that arrive in pieces. The result only depends on the bytes and the seed, not on how they were split
+// up, so it is the same as HashBytes or HashBytes128 of all of them at once.
+class StreamingHasher {
+public:
+    explicit StreamingHasher(u64 seed = 0);
+
+    void update(Span<const byte> bytes);
+
+    [[nodiscard]] u64 finish() const;
+    [[nodiscard]] Hash128 finish128() const;
+
+    void reset(u64 seed = 0);
+
+private:
+    constexpr static u64 SecretSize = 192;
+    constexpr static u64 BufferSize = 256;
+
+    alignas(64) u64 accumulators[8];
+    alignas(64) u8 secret[SecretSize];
+    alignas(64) u8 buffer[BufferSize];
+
+    u64 bufferedSize = 0;
+    u64 stripesSoFar = 0;
+    u64 totalLength  = 0;
+    u64 seed         = 0;
+};
+
+// Pelle Evensen's moremur, a variant of the MurmurHash3 finalizer with better avalanche. Every bit of the input
+// affects every bit of the output, so it turns identity hashes like std::hash of an integer into well spread ones.
+constexpr u64 MixInteger(u64 value) {
+    value ^= value >> 27;
+    value *= 0x3C79AC492BA7B653;
+    value ^= value >> 33;
+    value *= 0x1C69B3F74AC4AE35;
+    value ^= value >> 27;
+    return value;
+}
+
+// Values that hash the same don't cancel each other out, and the result depends on the order values are combined in
 template <typename T>
 void CombineHash(size_t& currentValue, const T& valueToHash) {
-    currentValue ^= std::hash<T>{}(valueToHash) + 0x9e3779b9 + (currentValue << 6) + (currentValue >> 2);
+    currentValue = MixInteger(currentValue + 0x9E3779B97F4A7C15 + std::hash<T>{}(valueToHash));
 }
 
 template <typename... Ts>
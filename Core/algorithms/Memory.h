@@ -2,9 +2,29 @@
 
 #include "core/assert/Assert.h"
 
+#include <cstring>
 #include <memory>
 #include <type_traits>
 
+namespace Core {
+
+// Whether a T can be moved to a new address by copying its bytes and then forgetting about the original, without
+// running its move constructor or destructor. Containers use this to grow with realloc and shift elements with memmove.
+//
+// Every trivially copyable type qualifies. Types that own memory through a pointer and never point into themselves,
+// such as unique_ptr or Core::Array, are relocatable too but have to opt in by specializing this. Types that do point
+// into themselves, like a std::string with its characters stored inline, must not opt in.
+template <typename T>
+constexpr bool IsTriviallyRelocatable = std::is_trivially_copyable_v<T>;
+
+template <typename T>
+constexpr bool IsTriviallyRelocatable<std::unique_ptr<T>> = true;
+
+template <typename T>
+constexpr bool IsTriviallyRelocatable<std::shared_ptr<T>> = true;
+
+}    // namespace Core
+
 namespace Core::Algorithms {
 
 // This function is only safe to use if destination is before source, or at least elementCount after source.
@@ -74,6 +94,26 @@ void MoveElementsBackwards(T* source, T* destination, uint64_t elementCount) {
     }
 }
 
+// Constructs elementCount elements at destination from source. The destination must not overlap the source and must not
+// contain any live objects.
+template <typename T>
+void MoveElementsToUninitialized(T* source, T* destination, uint64_t elementCount) {
+    if constexpr(std::is_trivially_copyable_v<T>) {
+        std::memcpy(destination, source, elementCount * sizeof(T));
+        return;
+    }
+
+    T* sourceEnd = source + elementCount;
+    for(T *currentSource = source, *currentDestination = destination; currentSource < sourceEnd;
+        currentSource++, currentDestination++) {
+        if constexpr(std::is_move_constructible_v<T>) {
+            std::construct_at(currentDestination, std::move(*currentSource));
+        } else {
+            std::construct_at(currentDestination, *currentSource);
+        }
+    }
+}
+
 template <typename T>
 void DestroyElements(T* start, uint64_t elementCount) {
     if constexpr(!std::is_trivially_destructible_v<T>) {
@@ -81,4 +121,18 @@ void DestroyElements(T* start, uint64_t elementCount) {
     }
 }
 
+// Moves elementCount elements from source to destination, which must not contain any live objects, and ends the
+// lifetime of the originals. The ranges may overlap if T is trivially relocatable.
+template <typename T>
+void RelocateElements(T* source, T* destination, uint64_t elementCount) {
+    if constexpr(Core::IsTriviallyRelocatable<T>) {
+        if(elementCount > 0) {
+            std::memmove(static_cast<void*>(destination), static_cast<const void*>(source), elementCount * sizeof(T));
+        }
+    } else {
+        MoveElementsToUninitialized(source, destination, elementCount);
+        DestroyElements(source, elementCount);
+    }
+}
+
 }    // namespace Core::Algorithms
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "core/Types.h"
+#include "core/containers/Array.h"
+#include "core/containers/Span.h"
+#include "core/memory/Allocator.h"
+
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+namespace Core::Algorithms {
+
+namespace internal {
+
+// Where every view ends. Each iterator knows by itself when it's done, so views that skip elements or stop at the
+// shorter of two sources don't need a matching end iterator.
+struct ViewEnd {};
+
+template <typename RANGE>
+concept SizedRange = requires(const RANGE& range) {
+    { range.count() } -> std::convertible_to<u64>;
+};
+
+template <typename T>
+class SpanRange;
+
+template <typename RANGE>
+concept ContiguousRange = requires(const RANGE& range) {
+    { range.span() } -> std::same_as<Span<typename RANGE::ElementType>>;
+};
+
+}    // namespace internal
+
+// An element of an enumerated view together with its position
+template <typename REFERENCE>
+struct Enumerated {
+    u64 index;
+    REFERENCE element;
+};
+
+// A lazy sequence of elements. Views don't allocate or copy elements, they read them from the span or array they were
+// made from as they are iterated, so a chain like View(meshes).filter(isVisible).map(toDrawCall).collect() runs as a
+// single loop over meshes and allocates once for the result instead of once per step.
+//
+// A view refers to the elements it was made from and holds copies of the functions given to it, so it must not
+// outlive either. Mapping functions run each time an element is read, so read each element once or collect them.
+template <typename RANGE>
+class RangeView {
+public:
+    using Iterator  = decltype(std::declval<const RANGE&>().begin());
+    using Reference = decltype(*std::declval<Iterator&>());
+    using Element   = std::remove_cvref_t<Reference>;
+
+    explicit RangeView(RANGE range);
+
+    // The result of function for each element
+    template <typename FUNCTION>
+    [[nodiscard]] auto map(FUNCTION function) const;
+
+    // Only the elements predicate returns true for
+    template <typename PREDICATE>
+    [[nodiscard]] auto filter(PREDICATE predicate) const;
+
+    // Each element with its position in this view, as an Enumerated
+    [[nodiscard]] auto enumerate() const;
+
+    // Pairs of elements from both views, ending with the shorter one
+    template <typename OTHER_RANGE>
+    [[nodiscard]] auto zip(const RangeView<OTHER_RANGE>& other) const;
+
+    // Spans of chunkSize elements, apart from the last which has whatever is left. Only views made straight from a
+    // span or array can be chunked, as the chunks point into it.
+    [[nodiscard]] auto chunk(u64 chunkSize) const requires internal::ContiguousRange<RANGE>;
+
+    // Views that can't know how many elements they have without reading them, such as filtered ones, have no count
+    [[nodiscard]] u64 count() const requires internal::SizedRange<RANGE>;
+
+    // Copies the elements into a new array, allocating exactly once when the view has a count
+    template <typename ALLOCATOR = Core::Memory::MallocAllocator>
+    [[nodiscard]] Core::Array<Element, ALLOCATOR> collect(const ALLOCATOR& allocator = ALLOCATOR()) const;
+
+    // For views of StatusOr, an array of their values or the first error. Elements after an error aren't read.
+    template <typename ALLOCATOR = Core::Memory::MallocAllocator>
+    [[nodiscard]] auto collectWithStatus(const ALLOCATOR& allocator = ALLOCATOR()) const;
+
+    [[nodiscard]] Iterator begin() const;
+    [[nodiscard]] internal::ViewEnd end() const;
+
+private:
+    template <typename OTHER_RANGE>
+    friend class RangeView;
+
+    RANGE range;
+};
+
+template <typename T>
+[[nodiscard]] RangeView<internal::SpanRange<T>> View(Span<T> elements);
+
+template <typename T, typename ALLOCATOR>
+[[nodiscard]] RangeView<internal::SpanRange<T>> View(Core::Array<T, ALLOCATOR>& elements);
+
+template <typename T, typename ALLOCATOR>
+[[nodiscard]] RangeView<internal::SpanRange<const T>> View(const Core::Array<T, ALLOCATOR>& elements);
+
+// The view would outlive the array
+template <typename T, typename ALLOCATOR>
+void View(Core::Array<T, ALLOCATOR>&& elements) = delete;
+
+}    // namespace Core::Algorithms
+
+#include "core/algorithms/internal/Ranges.inl"
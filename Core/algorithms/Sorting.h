@@ -0,0 +1,46 @@
+#pragma once
+
+#include "core/Types.h"
+#include "core/containers/Array.h"
+#include "core/containers/Span.h"
+
+#include <type_traits>
+
+namespace Core::Algorithms {
+
+// Integers and floating point numbers of 1, 2, 4 or 8 bytes
+template <typename KEY>
+concept RadixSortKey = (std::is_integral_v<KEY> || std::is_floating_point_v<KEY>) && !std::is_same_v<KEY, bool> &&
+                       (sizeof(KEY) == 1 || sizeof(KEY) == 2 || sizeof(KEY) == 4 || sizeof(KEY) == 8);
+
+// A key and the position of the element it belongs to, for sorting the key without moving the element
+template <typename KEY>
+struct KeyIndexPair {
+    KEY key;
+    u32 index;
+};
+
+// A stable least significant digit radix sort, ordering elements by key(element). It looks at each element once to
+// count every digit of its key and once more for each byte of the key that isn't the same for every element, so it
+// takes linear time and is much faster than std::sort for large arrays of small elements. The key function is called
+// once per pass and should be cheap.
+//
+// Floating point keys sort the way < does, apart from -0 coming before +0 and NaNs going to either end depending on
+// their sign bit.
+template <typename T, typename KEY_FUNCTION>
+void RadixSort(Span<T> elements, const KEY_FUNCTION& key);
+
+// The same, using scratch, which has to be at least as long as elements, instead of allocating
+template <typename T, typename KEY_FUNCTION>
+void RadixSort(Span<T> elements, Span<T> scratch, const KEY_FUNCTION& key);
+
+template <typename KEY>
+void RadixSort(Span<KeyIndexPair<KEY>> pairs);
+
+// The indices of keys in sorted order, with equal keys keeping the order they're in
+template <typename KEY>
+[[nodiscard]] Core::Array<u32> RadixSortedOrder(Span<KEY> keys);
+
+}    // namespace Core::Algorithms
+
+#include "core/algorithms/internal/Sorting.inl"
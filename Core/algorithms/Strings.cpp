@@ -1,77 +1,212 @@
 #include "core/algorithms/Strings.h"
 
+#include "core/algorithms/internal/PowersOfFive.h"
+
 #include <algorithm>
+#include <bit>
 #include <cctype>
+#include <charconv>
+#include <cstring>
 #include <limits>
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// The splitters look at a block of bytes at a time, 32 with AVX2 (/arch:AVX2 or -mavx2) and 16 with SSE2, which every
+// x64 compiler may use. Without either, and for the few bytes after the last whole block, they look at one at a time.
+#if defined(__AVX2__)
+#define CORE_STRINGS_AVX2 1
+#define CORE_STRINGS_SSE2 0
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define CORE_STRINGS_AVX2 0
+#define CORE_STRINGS_SSE2 1
+#include <emmintrin.h>
+#else
+#define CORE_STRINGS_AVX2 0
+#define CORE_STRINGS_SSE2 0
+#endif
+
 namespace {
-constexpr Core::FixedArray<double, 633> exp_table{
-      {1e308,  1e307,  1e306,  1e305,  1e304,  1e303,  1e302,  1e301,  1e300,  1e299,  1e298,  1e297,  1e296,  1e295,
-       1e294,  1e293,  1e292,  1e291,  1e290,  1e289,  1e288,  1e287,  1e286,  1e285,  1e284,  1e283,  1e282,  1e281,
-       1e280,  1e279,  1e278,  1e277,  1e276,  1e275,  1e274,  1e273,  1e272,  1e271,  1e270,  1e269,  1e268,  1e267,
-       1e266,  1e265,  1e264,  1e263,  1e262,  1e261,  1e260,  1e259,  1e258,  1e257,  1e256,  1e255,  1e254,  1e253,
-       1e252,  1e251,  1e250,  1e249,  1e248,  1e247,  1e246,  1e245,  1e244,  1e243,  1e242,  1e241,  1e240,  1e239,
-       1e238,  1e237,  1e236,  1e235,  1e234,  1e233,  1e232,  1e231,  1e230,  1e229,  1e228,  1e227,  1e226,  1e225,
-       1e224,  1e223,  1e222,  1e221,  1e220,  1e219,  1e218,  1e217,  1e216,  1e215,  1e214,  1e213,  1e212,  1e211,
-       1e210,  1e209,  1e208,  1e207,  1e206,  1e205,  1e204,  1e203,  1e202,  1e201,  1e200,  1e199,  1e198,  1e197,
-       1e196,  1e195,  1e194,  1e193,  1e192,  1e191,  1e190,  1e189,  1e188,  1e187,  1e186,  1e185,  1e184,  1e183,
-       1e182,  1e181,  1e180,  1e179,  1e178,  1e177,  1e176,  1e175,  1e174,  1e173,  1e172,  1e171,  1e170,  1e169,
-       1e168,  1e167,  1e166,  1e165,  1e164,  1e163,  1e162,  1e161,  1e160,  1e159,  1e158,  1e157,  1e156,  1e155,
-       1e154,  1e153,  1e152,  1e151,  1e150,  1e149,  1e148,  1e147,  1e146,  1e145,  1e144,  1e143,  1e142,  1e141,
-       1e140,  1e139,  1e138,  1e137,  1e136,  1e135,  1e134,  1e133,  1e132,  1e131,  1e130,  1e129,  1e128,  1e127,
-       1e126,  1e125,  1e124,  1e123,  1e122,  1e121,  1e120,  1e119,  1e118,  1e117,  1e116,  1e115,  1e114,  1e113,
-       1e112,  1e111,  1e110,  1e109,  1e108,  1e107,  1e106,  1e105,  1e104,  1e103,  1e102,  1e101,  1e100,  1e99,
-       1e98,   1e97,   1e96,   1e95,   1e94,   1e93,   1e92,   1e91,   1e90,   1e89,   1e88,   1e87,   1e86,   1e85,
-       1e84,   1e83,   1e82,   1e81,   1e80,   1e79,   1e78,   1e77,   1e76,   1e75,   1e74,   1e73,   1e72,   1e71,
-       1e70,   1e69,   1e68,   1e67,   1e66,   1e65,   1e64,   1e63,   1e62,   1e61,   1e60,   1e59,   1e58,   1e57,
-       1e56,   1e55,   1e54,   1e53,   1e52,   1e51,   1e50,   1e49,   1e48,   1e47,   1e46,   1e45,   1e44,   1e43,
-       1e42,   1e41,   1e40,   1e39,   1e38,   1e37,   1e36,   1e35,   1e34,   1e33,   1e32,   1e31,   1e30,   1e29,
-       1e28,   1e27,   1e26,   1e25,   1e24,   1e23,   1e22,   1e21,   1e20,   1e19,   1e18,   1e17,   1e16,   1e15,
-       1e14,   1e13,   1e12,   1e11,   1e10,   1e9,    1e8,    1e7,    1e6,    1e5,    1e4,    1e3,    1e2,    10.,
-       1.,     0.1,    1e-2,   1e-3,   1e-4,   1e-5,   1e-6,   1e-7,   1e-8,   1e-9,   1e-10,  1e-11,  1e-12,  1e-13,
-       1e-14,  1e-15,  1e-16,  1e-17,  1e-18,  1e-19,  1e-20,  1e-21,  1e-22,  1e-23,  1e-24,  1e-25,  1e-26,  1e-27,
-       1e-28,  1e-29,  1e-30,  1e-31,  1e-32,  1e-33,  1e-34,  1e-35,  1e-36,  1e-37,  1e-38,  1e-39,  1e-40,  1e-41,
-       1e-42,  1e-43,  1e-44,  1e-45,  1e-46,  1e-47,  1e-48,  1e-49,  1e-50,  1e-51,  1e-52,  1e-53,  1e-54,  1e-55,
-       1e-56,  1e-57,  1e-58,  1e-59,  1e-60,  1e-61,  1e-62,  1e-63,  1e-64,  1e-65,  1e-66,  1e-67,  1e-68,  1e-69,
-       1e-70,  1e-71,  1e-72,  1e-73,  1e-74,  1e-75,  1e-76,  1e-77,  1e-78,  1e-79,  1e-80,  1e-81,  1e-82,  1e-83,
-       1e-84,  1e-85,  1e-86,  1e-87,  1e-88,  1e-89,  1e-90,  1e-91,  1e-92,  1e-93,  1e-94,  1e-95,  1e-96,  1e-97,
-       1e-98,  1e-99,  1e-100, 1e-101, 1e-102, 1e-103, 1e-104, 1e-105, 1e-106, 1e-107, 1e-108, 1e-109, 1e-110, 1e-111,
-       1e-112, 1e-113, 1e-114, 1e-115, 1e-116, 1e-117, 1e-118, 1e-119, 1e-120, 1e-121, 1e-122, 1e-123, 1e-124, 1e-125,
-       1e-126, 1e-127, 1e-128, 1e-129, 1e-130, 1e-131, 1e-132, 1e-133, 1e-134, 1e-135, 1e-136, 1e-137, 1e-138, 1e-139,
-       1e-140, 1e-141, 1e-142, 1e-143, 1e-144, 1e-145, 1e-146, 1e-147, 1e-148, 1e-149, 1e-150, 1e-151, 1e-152, 1e-153,
-       1e-154, 1e-155, 1e-156, 1e-157, 1e-158, 1e-159, 1e-160, 1e-161, 1e-162, 1e-163, 1e-164, 1e-165, 1e-166, 1e-167,
-       1e-168, 1e-169, 1e-170, 1e-171, 1e-172, 1e-173, 1e-174, 1e-175, 1e-176, 1e-177, 1e-178, 1e-179, 1e-180, 1e-181,
-       1e-182, 1e-183, 1e-184, 1e-185, 1e-186, 1e-187, 1e-188, 1e-189, 1e-190, 1e-191, 1e-192, 1e-193, 1e-194, 1e-195,
-       1e-196, 1e-197, 1e-198, 1e-199, 1e-200, 1e-201, 1e-202, 1e-203, 1e-204, 1e-205, 1e-206, 1e-207, 1e-208, 1e-209,
-       1e-210, 1e-211, 1e-212, 1e-213, 1e-214, 1e-215, 1e-216, 1e-217, 1e-218, 1e-219, 1e-220, 1e-221, 1e-222, 1e-223,
-       1e-224, 1e-225, 1e-226, 1e-227, 1e-228, 1e-229, 1e-230, 1e-231, 1e-232, 1e-233, 1e-234, 1e-235, 1e-236, 1e-237,
-       1e-238, 1e-239, 1e-240, 1e-241, 1e-242, 1e-243, 1e-244, 1e-245, 1e-246, 1e-247, 1e-248, 1e-249, 1e-250, 1e-251,
-       1e-252, 1e-253, 1e-254, 1e-255, 1e-256, 1e-257, 1e-258, 1e-259, 1e-260, 1e-261, 1e-262, 1e-263, 1e-264, 1e-265,
-       1e-266, 1e-267, 1e-268, 1e-269, 1e-270, 1e-271, 1e-272, 1e-273, 1e-274, 1e-275, 1e-276, 1e-277, 1e-278, 1e-279,
-       1e-280, 1e-281, 1e-282, 1e-283, 1e-284, 1e-285, 1e-286, 1e-287, 1e-288, 1e-289, 1e-290, 1e-291, 1e-292, 1e-293,
-       1e-294, 1e-295, 1e-296, 1e-297, 1e-298, 1e-299, 1e-300, 1e-301, 1e-302, 1e-303, 1e-304, 1e-305, 1e-306, 1e-307,
-       1e-308, 1e-309, 1e-310, 1e-311, 1e-312, 1e-313, 1e-314, 1e-315, 1e-316, 1e-317, 1e-318, 1e-319, 1e-320, 1e-321,
-       1e-322, 1e-323}};
-
-using exp_index_t                             = decltype(exp_table)::size_type;
-constexpr exp_index_t IDENTITY_EXPONENT_INDEX = 308;
+// The same characters as std::isspace in the "C" locale, without depending on the current locale
+constexpr bool IsWhitespace(char c) {
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
 
 bool passesFilter(std::string_view s, Core::Algorithms::String::Filter filter) {
     using Core::Algorithms::String::Filter;
     return (filter == Filter::None) || (filter == Filter::Empty && !s.empty()) ||
-           (filter == Filter::Whitespace && !s.empty() &&
-            !std::all_of(s.begin(), s.end(), [](char c) { return std::isspace(c); }));
+           (filter == Filter::Whitespace && !std::all_of(s.begin(), s.end(), IsWhitespace));
 }
 
 std::string_view skipWhitespace(const std::string_view string) {
     std::string_view::size_type i = 0;
-    while(i < string.size() && std::isspace(string[i])) {
+    while(i < string.size() && IsWhitespace(string[i])) {
         i++;
     }
 
     return string.substr(i);
 }
 
+// A set of bytes to split at, that can test a whole block of the string at once and report the matches as one bit per
+// byte.
+class ByteSet {
+public:
+#if CORE_STRINGS_AVX2
+    constexpr static uint64_t BlockSize = 32;
+#elif CORE_STRINGS_SSE2
+    constexpr static uint64_t BlockSize = 16;
+
+    // SSE2 has no byte shuffle to look bytes up in a table with, so each byte in the set costs a compare per block
+    constexpr static uint64_t MaxVectorBytes = 8;
+#endif
+
+    explicit ByteSet(std::string_view bytes) {
+#if CORE_STRINGS_AVX2
+        // Each high nibble in the set gets a bit, and a byte is in the set if the entry for its low nibble has the bit
+        // of its high nibble. There are only eight bits, so past eight high nibbles they have to be shared, and the
+        // bytes that then match have to be checked against the exact set.
+        alignas(16) uint8_t lowNibbleBits[16]  = {};
+        alignas(16) uint8_t highNibbleBits[16] = {};
+        uint8_t nextBit                        = 0;
+        for(char c : bytes) {
+            uint8_t byte = static_cast<uint8_t>(c);
+            uint8_t high = byte >> 4;
+            if(highNibbleBits[high] == 0) {
+                exact                = exact && nextBit < 8;
+                highNibbleBits[high] = static_cast<uint8_t>(1 << (nextBit < 8 ? nextBit++ : high & 7));
+            }
+            lowNibbleBits[byte & 0xF] |= highNibbleBits[high];
+        }
+
+        lowNibbleTable  = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(lowNibbleBits)));
+        highNibbleTable = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(highNibbleBits)));
+#elif CORE_STRINGS_SSE2
+        vectorByteCount = bytes.size() <= MaxVectorBytes ? bytes.size() : 0;
+        for(uint64_t i = 0; i < vectorByteCount; i++) {
+            vectorBytes[i] = _mm_set1_epi8(bytes[i]);
+        }
+#endif
+
+        for(char c : bytes) {
+            uint8_t byte = static_cast<uint8_t>(c);
+            bits[byte >> 6] |= uint64_t(1) << (byte & 63);
+        }
+    }
+
+    bool contains(char c) const {
+        uint8_t byte = static_cast<uint8_t>(c);
+        return (bits[byte >> 6] >> (byte & 63)) & 1;
+    }
+
+#if CORE_STRINGS_AVX2 || CORE_STRINGS_SSE2
+    bool canMatchBlocks() const {
+#if CORE_STRINGS_AVX2
+        return true;
+#else
+        return vectorByteCount != 0;
+#endif
+    }
+
+    // Bit i is set if block[i] is in the set
+    uint32_t matchBlock(const char* block) const {
+#if CORE_STRINGS_AVX2
+        __m256i input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+
+        // There is no byte shift, so the high nibbles are shifted within 16 bit lanes and the low bits masked off
+        __m256i lowNibbles  = _mm256_and_si256(input, _mm256_set1_epi8(0x0F));
+        __m256i highNibbles = _mm256_and_si256(_mm256_srli_epi16(input, 4), _mm256_set1_epi8(0x0F));
+
+        __m256i classes = _mm256_and_si256(_mm256_shuffle_epi8(lowNibbleTable, lowNibbles),
+                                           _mm256_shuffle_epi8(highNibbleTable, highNibbles));
+        __m256i misses  = _mm256_cmpeq_epi8(classes, _mm256_setzero_si256());
+
+        uint32_t matches = ~static_cast<uint32_t>(_mm256_movemask_epi8(misses));
+        if(!exact) {
+            for(uint32_t candidates = matches; candidates != 0; candidates &= candidates - 1) {
+                uint32_t index = std::countr_zero(candidates);
+                if(!contains(block[index])) {
+                    matches &= ~(uint32_t(1) << index);
+                }
+            }
+        }
+
+        return matches;
+#else
+        __m128i input   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+        __m128i matches = _mm_cmpeq_epi8(input, vectorBytes[0]);
+        for(uint64_t i = 1; i < vectorByteCount; i++) {
+            matches = _mm_or_si128(matches, _mm_cmpeq_epi8(input, vectorBytes[i]));
+        }
+
+        return static_cast<uint32_t>(_mm_movemask_epi8(matches));
+#endif
+    }
+#endif
+
+private:
+    uint64_t bits[4] = {};
+
+#if CORE_STRINGS_AVX2
+    __m256i lowNibbleTable;
+    __m256i highNibbleTable;
+    bool exact = true;
+#elif CORE_STRINGS_SSE2
+    __m128i vectorBytes[MaxVectorBytes];
+    uint64_t vectorByteCount;
+#endif
+};
+
+// Calls onMatch with the index of every byte of string that is in bytes, in order
+template <typename ON_MATCH>
+void ForEachMatch(const std::string_view string, const ByteSet& bytes, ON_MATCH&& onMatch) {
+    const char* data = string.data();
+    uint64_t size    = string.size();
+    uint64_t offset  = 0;
+
+#if CORE_STRINGS_AVX2 || CORE_STRINGS_SSE2
+    if(bytes.canMatchBlocks()) {
+        for(; offset + ByteSet::BlockSize <= size; offset += ByteSet::BlockSize) {
+            for(uint32_t matches = bytes.matchBlock(data + offset); matches != 0; matches &= matches - 1) {
+                onMatch(offset + std::countr_zero(matches));
+            }
+        }
+    }
+#endif
+
+    for(; offset < size; offset++) {
+        if(bytes.contains(data[offset])) {
+            onMatch(offset);
+        }
+    }
+}
+
+template <typename ALLOCATOR>
+void SplitAt(const std::string_view string,
+             const ByteSet& delimiters,
+             Core::Array<std::string_view, ALLOCATOR>& buffer,
+             Core::Algorithms::String::Filter filter) {
+    buffer.clear();
+
+    std::string_view::size_type start = 0;
+    ForEachMatch(string, delimiters, [&](uint64_t index) {
+        std::string_view chunk = string.substr(start, index - start);
+        if(passesFilter(chunk, filter)) {
+            buffer.insert(chunk);
+        }
+
+        start = index + 1;
+    });
+
+    if(start != string.size()) {
+        std::string_view chunk = string.substr(start);
+        if(passesFilter(chunk, filter)) {
+            buffer.insert(chunk);
+        }
+    }
+}
+
 uint64_t InternalParseUInt64(const std::string_view string, uint64_t& continueFrom) {
     std::string_view::size_type consumedCharacters = 0;
     for(char c : string) {
@@ -87,178 +222,571 @@ uint64_t InternalParseUInt64(const std::string_view string, uint64_t& continueFr
     return consumedCharacters;
 }
 
-//
+// The Eisel-Lemire algorithm as described in "Number Parsing at a Gigabyte per Second" (Lemire, 2021), with the
+// structure and constants of the fast_float library it was published with.
+namespace FloatParsing = Core::Algorithms::internal::FloatParsing;
 
-// Adapted from https://stackoverflow.com/a/5679966
 template <typename REAL_TYPE>
-REAL_TYPE InternalParseReal(const std::string_view string) {
-    // Get rid of leading white space
-    std::string_view sanitized = skipWhitespace(string);
+struct FloatFormat;
+
+template <>
+struct FloatFormat<double> {
+    using Bits = uint64_t;
+
+    constexpr static int MantissaBits      = 52;
+    constexpr static int MinimumExponent   = -1023;
+    constexpr static int InfinitePower     = 0x7FF;
+    constexpr static int64_t SmallestPower = -342;
+    constexpr static int64_t LargestPower  = 308;
+
+    // Between these powers a product can be exactly half way between two doubles, which has to round to even
+    constexpr static int64_t MinExponentRoundToEven = -4;
+    constexpr static int64_t MaxExponentRoundToEven = 23;
+
+    // Mantissas and powers of ten in these ranges are exact doubles, so one multiply or divide rounds correctly
+    constexpr static uint64_t MaxMantissaFastPath = uint64_t(2) << MantissaBits;
+    constexpr static int64_t MaxExponentFastPath  = 22;
+    constexpr static double ExactPowersOfTen[]    = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                                     1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                                     1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+};
+
+template <>
+struct FloatFormat<float> {
+    using Bits = uint32_t;
+
+    constexpr static int MantissaBits      = 23;
+    constexpr static int MinimumExponent   = -127;
+    constexpr static int InfinitePower     = 0xFF;
+    constexpr static int64_t SmallestPower = -65;
+    constexpr static int64_t LargestPower  = 38;
+
+    constexpr static int64_t MinExponentRoundToEven = -17;
+    constexpr static int64_t MaxExponentRoundToEven = 10;
+
+    constexpr static uint64_t MaxMantissaFastPath = uint64_t(2) << MantissaBits;
+    constexpr static int64_t MaxExponentFastPath  = 10;
+    constexpr static float ExactPowersOfTen[]     = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+};
+
+static_assert(std::endian::native == std::endian::little, "The digit parsing loads eight characters as a u64");
+
+constexpr bool IsDigit(char c) {
+    return static_cast<unsigned char>(c - '0') < 10;
+}
 
-    // If there was only whitespace, our contract is to return 0
-    if(sanitized.empty()) {
-        return 0;
+uint64_t LoadEightCharacters(const char* characters) {
+    uint64_t value;
+    std::memcpy(&value, characters, sizeof(value));
+    return value;
+}
+
+// Every byte is '0' to '9' if its high nibble is 3 both before and after adding 6
+bool IsEightDigits(uint64_t characters) {
+    return (((characters & 0xF0F0F0F0F0F0F0F0) | (((characters + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) ==
+            0x3333333333333333);
+}
+
+// Combines neighbouring digits into pairs, then pairs into fours, then fours into the whole number
+uint32_t ParseEightDigits(uint64_t characters) {
+    constexpr uint64_t Mask        = 0x000000FF000000FF;
+    constexpr uint64_t Multiplier1 = 100 + (uint64_t(1000000) << 32);
+    constexpr uint64_t Multiplier2 = 1 + (uint64_t(10000) << 32);
+
+    characters -= 0x3030303030303030;
+    characters = (characters * 10) + (characters >> 8);
+    characters = (((characters & Mask) * Multiplier1) + (((characters >> 16) & Mask) * Multiplier2)) >> 32;
+    return static_cast<uint32_t>(characters);
+}
+
+// Adds the digits at the start of [current, end) to value, returning where the digits stop
+const char* AccumulateDigits(const char* current, const char* end, uint64_t& value) {
+    while(end - current >= 8 && IsEightDigits(LoadEightCharacters(current))) {
+        value = value * 100000000 + ParseEightDigits(LoadEightCharacters(current));
+        current += 8;
     }
 
-    // The algorithm implemented here is:
-    //  1. parse whole part as an unsigned integer into I
-    //  2. continue parsing the fractional part into I as if there were no decimal point
-    //      while keeping track of how many decimal places there are in D
-    //  3. modify D if there is an exponent specified
-    //  4. clamp D to the limits of the return type
-    //  4. multiply I by 10^-D to get a floating point value
-    //  5. multiple I by -1 if the string started with a '-' symbol
+    while(current != end && IsDigit(*current)) {
+        value = value * 10 + static_cast<uint64_t>(*current - '0');
+        current++;
+    }
 
-    bool isNegative           = 0;
-    uint64_t charactersParsed = 0;
-    int64_t fractionalPlaces  = 0;
+    return current;
+}
 
-    // Get the whole part of the number;
-    uint64_t integerValue = 0;
-    if(sanitized[0] == '-') {
-        isNegative       = true;
-        charactersParsed = InternalParseUInt64(sanitized.substr(1), integerValue) + 1;
-    } else {
-        charactersParsed = InternalParseUInt64(sanitized, integerValue);
+// A number in the form mantissa * 10^exponent. Only the first 19 significant digits fit in the mantissa, and if there
+// were more, tooManyDigits is set and the mantissa is truncated.
+struct DecimalNumber {
+    uint64_t mantissa  = 0;
+    int64_t exponent   = 0;
+    bool negative      = false;
+    bool tooManyDigits = false;
+
+    // The number of characters that made up the number, or 0 if there wasn't one
+    uint64_t length = 0;
+};
+
+DecimalNumber ParseDecimal(const std::string_view string) {
+    DecimalNumber number;
+
+    const char* current = string.data();
+    const char* end     = current + string.size();
+    if(current != end && (*current == '-' || *current == '+')) {
+        number.negative = *current == '-';
+        current++;
     }
 
-    // Get the fractional part if there is one
-    sanitized = sanitized.substr(charactersParsed);
-    if(!sanitized.empty() && sanitized[0] == '.') {
-        fractionalPlaces = InternalParseUInt64(sanitized.substr(1), integerValue);
-        sanitized        = sanitized.substr(fractionalPlaces + 1);
+    const char* integerStart = current;
+    current                  = AccumulateDigits(current, end, number.mantissa);
+    const char* integerEnd   = current;
+    int64_t digitCount       = integerEnd - integerStart;
+
+    const char* fractionStart = current;
+    const char* fractionEnd   = current;
+    if(current != end && *current == '.') {
+        fractionStart = current + 1;
+        fractionEnd   = AccumulateDigits(fractionStart, end, number.mantissa);
+        current       = fractionEnd;
+
+        number.exponent = fractionStart - fractionEnd;
+        digitCount -= number.exponent;
     }
 
-    // Get the exponent part if there is one
-    if(sanitized.size() > 1 && (sanitized[0] == 'E' || sanitized[0] == 'e')) {
-        uint64_t exponent = 0;
-        if(sanitized[1] == '+' || sanitized[1] == '-') {
-            InternalParseUInt64(sanitized.substr(2), exponent);
-        } else {
-            InternalParseUInt64(sanitized.substr(1), exponent);
+    if(digitCount == 0) {
+        return DecimalNumber();
+    }
+
+    int64_t explicitExponent = 0;
+    if(current != end && (*current == 'e' || *current == 'E')) {
+        const char* exponentDigits = current + 1;
+        bool negativeExponent      = false;
+        if(exponentDigits != end && (*exponentDigits == '-' || *exponentDigits == '+')) {
+            negativeExponent = *exponentDigits == '-';
+            exponentDigits++;
         }
 
-        if(sanitized[1] == '-') {
-            fractionalPlaces += exponent;
-        } else {
-            fractionalPlaces -= exponent;
+        // An e without digits after it isn't part of the number
+        if(exponentDigits != end && IsDigit(*exponentDigits)) {
+            current = exponentDigits;
+            while(current != end && IsDigit(*current)) {
+                // Exponents this large already give zero or infinity, this just keeps them from overflowing
+                if(explicitExponent < 0x10000000) {
+                    explicitExponent = explicitExponent * 10 + (*current - '0');
+                }
+                current++;
+            }
+
+            explicitExponent = negativeExponent ? -explicitExponent : explicitExponent;
+            number.exponent += explicitExponent;
         }
     }
 
-    // Clamp the expontent based on the return type
-    exp_index_t maxIndex = IDENTITY_EXPONENT_INDEX - std::numeric_limits<REAL_TYPE>::max_exponent10;
-    exp_index_t minIndex = IDENTITY_EXPONENT_INDEX - std::numeric_limits<REAL_TYPE>::min_exponent10;
+    number.length = current - string.data();
+
+    if(digitCount > 19) {
+        // Leading zeros are not significant
+        for(const char* digit = integerStart; digit != fractionEnd && (*digit == '0' || *digit == '.'); digit++) {
+            digitCount -= *digit == '0';
+        }
+
+        if(digitCount > 19) {
+            // Keep the first 19 significant digits and move the decimal point to just after them
+            constexpr uint64_t MinimumNineteenDigits = 1000000000000000000;
+
+            number.tooManyDigits = true;
+            number.mantissa      = 0;
+
+            const char* digit = integerStart;
+            while(number.mantissa < MinimumNineteenDigits && digit != integerEnd) {
+                number.mantissa = number.mantissa * 10 + static_cast<uint64_t>(*digit - '0');
+                digit++;
+            }
 
-    fractionalPlaces = std::clamp(IDENTITY_EXPONENT_INDEX + fractionalPlaces, maxIndex, minIndex);
+            if(number.mantissa >= MinimumNineteenDigits) {
+                number.exponent = (integerEnd - digit) + explicitExponent;
+            } else {
+                digit = fractionStart;
+                while(number.mantissa < MinimumNineteenDigits && digit != fractionEnd) {
+                    number.mantissa = number.mantissa * 10 + static_cast<uint64_t>(*digit - '0');
+                    digit++;
+                }
+                number.exponent = (fractionStart - digit) + explicitExponent;
+            }
+        }
+    }
 
-    // Make our floating point value
-    REAL_TYPE realValue = static_cast<REAL_TYPE>(exp_table[fractionalPlaces]) * integerValue;
-    return isNegative ? -realValue : realValue;
+    return number;
 }
-}    // namespace
 
-namespace Core::Algorithms::String {
+struct Product {
+    uint64_t high;
+    uint64_t low;
+};
+
+Product Multiply(uint64_t a, uint64_t b) {
+#if defined(_MSC_VER) && defined(_M_X64)
+    uint64_t high;
+    uint64_t low = _umul128(a, b, &high);
+    return Product{.high = high, .low = low};
+#elif defined(__SIZEOF_INT128__)
+    unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+    return Product{.high = static_cast<uint64_t>(product >> 64), .low = static_cast<uint64_t>(product)};
+#else
+    uint64_t aLow = a & 0xFFFFFFFF, aHigh = a >> 32;
+    uint64_t bLow = b & 0xFFFFFFFF, bHigh = b >> 32;
+
+    uint64_t lowLow   = aLow * bLow;
+    uint64_t lowHigh  = aLow * bHigh;
+    uint64_t highLow  = aHigh * bLow;
+    uint64_t highHigh = aHigh * bHigh;
+
+    uint64_t middle = (lowLow >> 32) + (lowHigh & 0xFFFFFFFF) + (highLow & 0xFFFFFFFF);
+    return Product{.high = highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32),
+                   .low  = (middle << 32) | (lowLow & 0xFFFFFFFF)};
+#endif
+}
 
+// The bits of a float before they are put together, with the implicit leading one of the mantissa already removed
+struct AdjustedMantissa {
+    uint64_t mantissa;
+    int32_t power2;
 
-void SplitIntoBuffer(const std::string_view string,
-                     char delimiter,
-                     Core::Array<std::string_view>& buffer,
-                     Filter filter) {
-    buffer.clear();
+    bool operator==(const AdjustedMantissa& other) const = default;
+};
 
-    std::string_view::size_type start = 0;
-    for(std::string_view::size_type current = start; current < string.size(); current++) {
-        char currentChar = string[current];
-        if(currentChar == delimiter) {
-            std::string_view chunk = string.substr(start, current - start);
-            if(passesFilter(chunk, filter)) {
-                buffer.insert(chunk);
-            }
+// Finds the float nearest to w * 10^q
+template <typename REAL_TYPE>
+AdjustedMantissa ComputeFloat(int64_t q, uint64_t w) {
+    using Format = FloatFormat<REAL_TYPE>;
+
+    if(w == 0 || q < Format::SmallestPower) {
+        return AdjustedMantissa{.mantissa = 0, .power2 = 0};
+    }
+    if(q > Format::LargestPower) {
+        return AdjustedMantissa{.mantissa = 0, .power2 = Format::InfinitePower};
+    }
 
-            start = current + 1;
+    int leadingZeros = std::countl_zero(w);
+    w <<= leadingZeros;
+
+    // The high half of the product with the truncated power of five is enough unless all of the bits below the ones
+    // that end up in the mantissa are set, in which case the next 64 bits of the power might carry into them
+    constexpr uint64_t PrecisionMask = 0xFFFFFFFFFFFFFFFF >> (Format::MantissaBits + 3);
+
+    uint64_t index  = 2 * static_cast<uint64_t>(q - FloatParsing::SmallestPowerOfFive);
+    Product product = Multiply(w, FloatParsing::PowersOfFive[index]);
+    if((product.high & PrecisionMask) == PrecisionMask) {
+        Product lowerProduct = Multiply(w, FloatParsing::PowersOfFive[index + 1]);
+        product.low += lowerProduct.high;
+        if(lowerProduct.high > product.low) {
+            product.high++;
         }
     }
 
-    if(start != string.size()) {
-        std::string_view chunk = string.substr(start);
-        if(passesFilter(chunk, filter)) {
-            buffer.insert(chunk);
+    int upperBit = static_cast<int>(product.high >> 63);
+    int shift    = upperBit + 64 - Format::MantissaBits - 3;
+
+    // floor(log2(10^q)) + 63, as a fixed point multiply that is exact over the range of q we use
+    int32_t power = static_cast<int32_t>((((152170 + 65536) * q) >> 16) + 63);
+
+    AdjustedMantissa answer{
+          .mantissa = product.high >> shift,
+          .power2   = power + upperBit - leadingZeros - Format::MinimumExponent,
+    };
+
+    if(answer.power2 <= 0) {
+        // Subnormal, shift down to the smallest exponent and round
+        if(-answer.power2 + 1 >= 64) {
+            return AdjustedMantissa{.mantissa = 0, .power2 = 0};
         }
+
+        answer.mantissa >>= -answer.power2 + 1;
+        answer.mantissa += answer.mantissa & 1;
+        answer.mantissa >>= 1;
+
+        // Rounding up can carry into the smallest normal number
+        answer.power2 = answer.mantissa < (uint64_t(1) << Format::MantissaBits) ? 0 : 1;
+        return answer;
+    }
+
+    // A product that is exactly half way between two floats rounds to even rather than up
+    if(product.low <= 1 && q >= Format::MinExponentRoundToEven && q <= Format::MaxExponentRoundToEven &&
+       (answer.mantissa & 3) == 1 && (answer.mantissa << shift) == product.high) {
+        answer.mantissa &= ~uint64_t(1);
+    }
+
+    answer.mantissa += answer.mantissa & 1;
+    answer.mantissa >>= 1;
+    if(answer.mantissa >= (uint64_t(2) << Format::MantissaBits)) {
+        answer.mantissa = uint64_t(1) << Format::MantissaBits;
+        answer.power2++;
+    }
+
+    answer.mantissa &= ~(uint64_t(1) << Format::MantissaBits);
+    if(answer.power2 >= Format::InfinitePower) {
+        return AdjustedMantissa{.mantissa = 0, .power2 = Format::InfinitePower};
     }
+
+    return answer;
 }
 
-Core::Array<std::string_view> Split(const std::string_view string, char delimiter, Filter filter) {
-    Core::Array<std::string_view> splits;
-    SplitIntoBuffer(string, delimiter, splits, filter);
-    return splits;
+template <typename REAL_TYPE>
+REAL_TYPE ToFloat(bool negative, AdjustedMantissa adjusted) {
+    using Bits = typename FloatFormat<REAL_TYPE>::Bits;
+
+    Bits bits = static_cast<Bits>(adjusted.mantissa);
+    bits |= static_cast<Bits>(adjusted.power2) << FloatFormat<REAL_TYPE>::MantissaBits;
+    bits |= static_cast<Bits>(negative) << (sizeof(Bits) * 8 - 1);
+    return std::bit_cast<REAL_TYPE>(bits);
 }
 
+bool StartsWithIgnoringCase(std::string_view string, std::string_view prefix) {
+    return string.size() >= prefix.size() &&
+           std::equal(prefix.begin(), prefix.end(), string.begin(), [](char a, char b) { return a == (b | 0x20); });
+}
 
-void SplitIntoBuffer(const std::string_view string,
-                     const std::string_view delimiters,
-                     Core::Array<std::string_view>& buffer,
-                     Filter filter) {
-    buffer.clear();
+// inf, infinity and nan in any case, like std::strtod, and nan's optional (characters) suffix
+template <typename REAL_TYPE>
+uint64_t ParseInfinityOrNaN(const std::string_view string, REAL_TYPE& value) {
+    uint64_t signLength   = !string.empty() && (string[0] == '-' || string[0] == '+') ? 1 : 0;
+    bool negative         = signLength == 1 && string[0] == '-';
+    std::string_view rest = string.substr(signLength);
+
+    if(StartsWithIgnoringCase(rest, "inf")) {
+        value = negative ? -std::numeric_limits<REAL_TYPE>::infinity() : std::numeric_limits<REAL_TYPE>::infinity();
+        return signLength + (StartsWithIgnoringCase(rest, "infinity") ? 8 : 3);
+    }
 
+    if(StartsWithIgnoringCase(rest, "nan")) {
+        uint64_t length = 3;
+        if(rest.size() > 3 && rest[3] == '(') {
+            uint64_t close = rest.find(')', 4);
+            bool valid     = close != std::string_view::npos &&
+                         std::all_of(rest.begin() + 4, rest.begin() + close, [](char c) {
+                             return IsDigit(c) || c == '_' || ((c | 0x20) >= 'a' && (c | 0x20) <= 'z');
+                         });
+            length = valid ? close + 1 : 3;
+        }
 
-    std::string_view::size_type start = 0;
-    for(std::string_view::size_type current = start; current < string.size(); current++) {
-        char currentChar = string[current];
-        if(delimiters.find(currentChar) != std::string_view::npos) {
-            std::string_view chunk = string.substr(start, current - start);
-            if(passesFilter(chunk, filter)) {
-                buffer.insert(chunk);
-            }
+        value = negative ? -std::numeric_limits<REAL_TYPE>::quiet_NaN() : std::numeric_limits<REAL_TYPE>::quiet_NaN();
+        return signLength + length;
+    }
 
-            start = current + 1;
+    return 0;
+}
+
+template <typename REAL_TYPE>
+uint64_t InternalFromChars(const std::string_view string, REAL_TYPE& value) {
+    using Format = FloatFormat<REAL_TYPE>;
+
+    DecimalNumber number = ParseDecimal(string);
+    if(number.length == 0) {
+        return ParseInfinityOrNaN(string, value);
+    }
+
+    if(!number.tooManyDigits && number.mantissa <= Format::MaxMantissaFastPath &&
+       number.exponent >= -Format::MaxExponentFastPath && number.exponent <= Format::MaxExponentFastPath) {
+        REAL_TYPE result = static_cast<REAL_TYPE>(number.mantissa);
+        if(number.exponent < 0) {
+            result /= Format::ExactPowersOfTen[-number.exponent];
+        } else {
+            result *= Format::ExactPowersOfTen[number.exponent];
         }
+
+        value = number.negative ? -result : result;
+        return number.length;
     }
 
-    if(start != string.size()) {
-        std::string_view chunk = string.substr(start);
-        if(passesFilter(chunk, filter)) {
-            buffer.insert(chunk);
+    AdjustedMantissa adjusted = ComputeFloat<REAL_TYPE>(number.exponent, number.mantissa);
+    if(number.tooManyDigits && adjusted != ComputeFloat<REAL_TYPE>(number.exponent, number.mantissa + 1)) {
+        // The digits past the first 19 decide which way this rounds, which needs arbitrary precision. That is rare
+        // enough to leave to the standard library.
+        const char* digits = string.data() + (string[0] == '-' || string[0] == '+' ? 1 : 0);
+        REAL_TYPE result   = ToFloat<REAL_TYPE>(false, adjusted);
+        std::from_chars(digits, string.data() + number.length, result);
+
+        value = number.negative ? -result : result;
+        return number.length;
+    }
+
+    value = ToFloat<REAL_TYPE>(number.negative, adjusted);
+    return number.length;
+}
+
+template <typename REAL_TYPE>
+REAL_TYPE InternalParseReal(const std::string_view string) {
+    REAL_TYPE value = 0;
+    InternalFromChars(skipWhitespace(string), value);
+    return value;
+}
+
+template <typename REAL_TYPE>
+Core::Algorithms::String::BatchParseResult InternalParseReals(const std::string_view string,
+                                                              Core::Span<REAL_TYPE> values) {
+    Core::Algorithms::String::BatchParseResult result;
+
+    uint64_t position = 0;
+    while(result.count < values.count()) {
+        while(position < string.size() && IsWhitespace(string[position])) {
+            position++;
+        }
+
+        uint64_t length = InternalFromChars(string.substr(position), values[result.count]);
+        if(length == 0) {
+            break;
         }
+
+        position += length;
+        result.count++;
+        result.length = position;
     }
+
+    return result;
 }
 
-Core::Array<std::string_view> Split(const std::string_view string, const std::string_view delimiters, Filter filter) {
-    Core::Array<std::string_view> splits;
-    SplitIntoBuffer(string, delimiters, splits, filter);
+// Sets the high bit of each byte that is '0' to '9'. Only the low seven bits of each byte are added to, so nothing
+// carries into the next byte.
+uint64_t DigitMask(uint64_t characters) {
+    constexpr uint64_t HighBits = 0x8080808080808080;
+
+    uint64_t lowBits     = characters & ~HighBits;
+    uint64_t atLeastZero = lowBits + 0x5050505050505050;
+    uint64_t aboveNine   = lowBits + 0x4646464646464646;
+    return atLeastZero & ~aboveNine & ~characters & HighBits;
+}
+
+// Adds the digits at the start of [current, end) to value, returning where the digits stop. Indices are rarely longer
+// than eight digits, so rather than checking for a whole word of digits, this finds how long the run in the next word
+// is and parses just those.
+const char* AccumulateIndexDigits(const char* current, const char* end, uint64_t& value) {
+    constexpr uint64_t PowersOfTen[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000};
+
+    while(end - current >= 8) {
+        uint64_t characters = LoadEightCharacters(current);
+        uint64_t digitCount = std::countr_zero(~DigitMask(characters) & 0x8080808080808080) / 8;
+        if(digitCount == 0) {
+            return current;
+        }
+
+        if(digitCount < 8) {
+            // Move the digits to the end of the word and fill in the start with leading zeros
+            characters = (characters << (8 * (8 - digitCount))) | (0x3030303030303030 >> (8 * digitCount));
+        }
+
+        value = value * PowersOfTen[digitCount] + ParseEightDigits(characters);
+        current += digitCount;
+        if(digitCount < 8) {
+            return current;
+        }
+    }
+
+    return AccumulateDigits(current, end, value);
+}
+
+// Returns current if there isn't an index there
+const char* ParseIndex(const char* current, const char* end, int64_t& index) {
+    bool negative      = current != end && *current == '-';
+    const char* digits = negative ? current + 1 : current;
+
+    uint64_t magnitude = 0;
+    const char* stop   = AccumulateIndexDigits(digits, end, magnitude);
+    if(stop == digits) {
+        return current;
+    }
+
+    index = negative ? -static_cast<int64_t>(magnitude) : static_cast<int64_t>(magnitude);
+    return stop;
+}
+}    // namespace
+
+namespace Core::Algorithms::String {
+
+
+template <typename ALLOCATOR>
+void SplitIntoBuffer(const std::string_view string,
+                     char delimiter,
+                     Core::Array<std::string_view, ALLOCATOR>& buffer,
+                     Filter filter) {
+    SplitAt(string, ByteSet(std::string_view(&delimiter, 1)), buffer, filter);
+}
+
+template <typename ALLOCATOR>
+Core::Array<std::string_view, ALLOCATOR> Split(const std::string_view string,
+                                               char delimiter,
+                                               Filter filter,
+                                               const ALLOCATOR& allocator) {
+    Core::Array<std::string_view, ALLOCATOR> splits(allocator);
+    SplitIntoBuffer(string, delimiter, splits, filter);
     return splits;
 }
 
-Core::Array<std::string_view> SplitLines(const std::string_view string, Filter filter) {
-    Core::Array<std::string_view> splits;
 
-    std::string_view::size_type start = 0;
-    for(std::string_view::size_type current = start; current < string.size(); current++) {
-        char currentChar = string[current];
-        if(currentChar == '\n' || (currentChar == '\r' && current + 1 < string.size() && string[current] == '\n')) {
-            std::string_view chunk = string.substr(start, current - start);
-            if(passesFilter(chunk, filter)) {
-                splits.insert(chunk);
-            }
+template <typename ALLOCATOR>
+void SplitIntoBuffer(const std::string_view string,
+                     const std::string_view delimiters,
+                     Core::Array<std::string_view, ALLOCATOR>& buffer,
+                     Filter filter) {
+    SplitAt(string, ByteSet(delimiters), buffer, filter);
+}
 
-            if(currentChar == '\r') {
-                current += 2;
-            } else {
-                current++;
-            }
+template <typename ALLOCATOR>
+Core::Array<std::string_view, ALLOCATOR> Split(const std::string_view string,
+                                               const std::string_view delimiters,
+                                               Filter filter,
+                                               const ALLOCATOR& allocator) {
+    Core::Array<std::string_view, ALLOCATOR> splits(allocator);
+    SplitIntoBuffer(string, delimiters, splits, filter);
+    return splits;
+}
 
-            start = current;
+template <typename ALLOCATOR>
+void SplitLinesIntoBuffer(const std::string_view string,
+                          Core::Array<std::string_view, ALLOCATOR>& buffer,
+                          Filter filter) {
+    auto addLine = [&](std::string_view line) {
+        if(!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
         }
-    }
+        if(passesFilter(line, filter)) {
+            buffer.insert(line);
+        }
+    };
+
+    std::string_view::size_type start = 0;
+    ForEachMatch(string, ByteSet("\n"), [&](uint64_t index) {
+        addLine(string.substr(start, index - start));
+        start = index + 1;
+    });
 
     if(start != string.size()) {
-        std::string_view chunk = string.substr(start);
-        if(passesFilter(chunk, filter)) {
-            splits.insert(chunk);
-        }
+        addLine(string.substr(start));
     }
+}
 
+template <typename ALLOCATOR>
+Core::Array<std::string_view, ALLOCATOR> SplitLines(const std::string_view string,
+                                                    Filter filter,
+                                                    const ALLOCATOR& allocator) {
+    Core::Array<std::string_view, ALLOCATOR> splits(allocator);
+    SplitLinesIntoBuffer(string, splits, filter);
     return splits;
-}    // namespace Core::Algorithms::String
+}
+
+// The splitters are only compiled for the allocators that are declared as supported in Strings.h
+#define INSTANTIATE_SPLITTERS(ALLOCATOR)                                                                              \
+    template void SplitIntoBuffer(std::string_view, char, Core::Array<std::string_view, ALLOCATOR>&, Filter);         \
+    template void SplitIntoBuffer(                                                                                    \
+          std::string_view, std::string_view, Core::Array<std::string_view, ALLOCATOR>&, Filter);                     \
+    template Core::Array<std::string_view, ALLOCATOR> Split(std::string_view, char, Filter, const ALLOCATOR&);        \
+    template Core::Array<std::string_view, ALLOCATOR> Split(                                                          \
+          std::string_view, std::string_view, Filter, const ALLOCATOR&);                                              \
+    template void SplitLinesIntoBuffer(std::string_view, Core::Array<std::string_view, ALLOCATOR>&, Filter);          \
+    template Core::Array<std::string_view, ALLOCATOR> SplitLines(std::string_view, Filter, const ALLOCATOR&);
+
+INSTANTIATE_SPLITTERS(Core::Memory::MallocAllocator)
+INSTANTIATE_SPLITTERS(Core::Memory::ResourceAllocator)
+
+#undef INSTANTIATE_SPLITTERS
 
 int64_t ParseInt64(const std::string_view string) {
     const std::string_view sanitized = skipWhitespace(string);
@@ -288,4 +816,55 @@ float ParseFloat(const std::string_view string) {
 double ParseDouble(const std::string_view string) {
     return InternalParseReal<double>(string);
 }
+
+uint64_t FromChars(const std::string_view string, float& value) {
+    return InternalFromChars(string, value);
+}
+uint64_t FromChars(const std::string_view string, double& value) {
+    return InternalFromChars(string, value);
+}
+
+BatchParseResult ParseFloats(const std::string_view string, Core::Span<float> values) {
+    return InternalParseReals(string, values);
+}
+BatchParseResult ParseDoubles(const std::string_view string, Core::Span<double> values) {
+    return InternalParseReals(string, values);
+}
+
+BatchParseResult ParseIndexTriplets(const std::string_view string, Core::Span<IndexTriplet> triplets) {
+    BatchParseResult result;
+
+    const char* begin   = string.data();
+    const char* end     = begin + string.size();
+    const char* current = begin;
+    while(result.count < triplets.count()) {
+        while(current != end && IsWhitespace(*current)) {
+            current++;
+        }
+
+        IndexTriplet triplet;
+        const char* next = ParseIndex(current, end, triplet.first);
+        if(next == current) {
+            break;
+        }
+
+        if(next != end && *next == '/') {
+            next = ParseIndex(next + 1, end, triplet.second);
+            if(next != end && *next == '/') {
+                next = ParseIndex(next + 1, end, triplet.third);
+            }
+        }
+
+        // Anything else stuck to the triplet, like a fourth part, means it isn't one
+        if(next != end && !IsWhitespace(*next)) {
+            break;
+        }
+
+        triplets[result.count++] = triplet;
+        current                  = next;
+        result.length            = current - begin;
+    }
+
+    return result;
+}
 }    // namespace Core::Algorithms::String
\ No newline at end of file
@@ -3,31 +3,80 @@
 #include <string_view>
 
 #include "core/containers/Array.h"
+#include "core/containers/Span.h"
+#include "core/memory/Allocator.h"
 
 namespace Core::Algorithms::String {
 
 enum class Filter { None, Empty, Whitespace };
 
+// The splitters work with arrays using MallocAllocator or ResourceAllocator. Other allocators can be reached through a
+// ResourceAllocator.
+template <typename ALLOCATOR>
 void SplitIntoBuffer(const std::string_view string,
                      char delimiter,
-                     Core::Array<std::string_view>& buffer,
+                     Core::Array<std::string_view, ALLOCATOR>& buffer,
                      Filter filter = Filter::None);
-Core::Array<std::string_view> Split(const std::string_view string, char delimiter, Filter filter = Filter::None);
+template <typename ALLOCATOR = Core::Memory::MallocAllocator>
+Core::Array<std::string_view, ALLOCATOR> Split(const std::string_view string,
+                                               char delimiter,
+                                               Filter filter              = Filter::None,
+                                               const ALLOCATOR& allocator = ALLOCATOR());
 
 
+template <typename ALLOCATOR>
 void SplitIntoBuffer(const std::string_view string,
                      const std::string_view delimiters,
-                     Core::Array<std::string_view>& buffer,
+                     Core::Array<std::string_view, ALLOCATOR>& buffer,
                      Filter filter = Filter::None);
-Core::Array<std::string_view> Split(const std::string_view string,
-                                    std::string_view delimiters,
-                                    Filter filter = Filter::None);
+template <typename ALLOCATOR = Core::Memory::MallocAllocator>
+Core::Array<std::string_view, ALLOCATOR> Split(const std::string_view string,
+                                               std::string_view delimiters,
+                                               Filter filter              = Filter::None,
+                                               const ALLOCATOR& allocator = ALLOCATOR());
 
 
-Core::Array<std::string_view> SplitLines(const std::string_view string, Filter filter = Filter::None);
+// Lines end at \n, and the \r of a \r\n is dropped with it. There are never more lines than \n characters plus one.
+template <typename ALLOCATOR>
+void SplitLinesIntoBuffer(const std::string_view string,
+                          Core::Array<std::string_view, ALLOCATOR>& buffer,
+                          Filter filter = Filter::None);
+template <typename ALLOCATOR = Core::Memory::MallocAllocator>
+Core::Array<std::string_view, ALLOCATOR> SplitLines(const std::string_view string,
+                                                    Filter filter              = Filter::None,
+                                                    const ALLOCATOR& allocator = ALLOCATOR());
 
 int64_t ParseInt64(const std::string_view string);
 uint64_t ParseUInt64(const std::string_view string);
+
+// These skip leading whitespace and give 0 if there is no number after it. Like FromChars, they are correctly rounded.
 float ParseFloat(const std::string_view string);
 double ParseDouble(const std::string_view string);
+
+// Parses the number at the very start of string, in the formats std::strtod accepts apart from hexadecimal, and
+// returns how many characters it used. If string doesn't start with a number, returns 0 and leaves value untouched.
+// The result is correctly rounded, so it is the same as std::strtod's.
+uint64_t FromChars(const std::string_view string, float& value);
+uint64_t FromChars(const std::string_view string, double& value);
+
+// The batch parsers read whitespace separated values from the start of string until values is full or they reach
+// something that isn't a value. count is how many values they wrote, and length is how many characters they used,
+// which is up to the end of the last value, so parsing can carry on from there once values is full.
+struct BatchParseResult {
+    uint64_t count  = 0;
+    uint64_t length = 0;
+};
+
+BatchParseResult ParseFloats(const std::string_view string, Core::Span<float> values);
+BatchParseResult ParseDoubles(const std::string_view string, Core::Span<double> values);
+
+// Groups of one to three integers separated by '/', in the forms a, a/b, a//c and a/b/c, such as the corners of an OBJ
+// face. Parts that are left out are 0.
+struct IndexTriplet {
+    int64_t first  = 0;
+    int64_t second = 0;
+    int64_t third  = 0;
+};
+
+BatchParseResult ParseIndexTriplets(const std::string_view string, Core::Span<IndexTriplet> triplets);
 }    // namespace Core::Algorithms::String
\ No newline at end of file
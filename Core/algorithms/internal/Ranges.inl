@@ -0,0 +1,420 @@
+#pragma once
+
+#include "core/algorithms/Ranges.h"
+
+#include "core/assert/Assert.h"
+#include "core/status/StatusOr.h"
+
+#include <algorithm>
+#include <functional>
+#include <optional>
+#include <variant>
+
+namespace Core::Algorithms {
+
+namespace internal {
+
+template <typename RANGE>
+using RangeIterator = decltype(std::declval<const RANGE&>().begin());
+
+template <typename RANGE>
+using RangeReference = decltype(*std::declval<RangeIterator<RANGE>&>());
+
+template <typename T>
+class SpanRange {
+public:
+    using ElementType = T;
+
+    class Iterator {
+    public:
+        Iterator(T* current, T* last) : current(current), last(last) {}
+
+        T& operator*() const {
+            return *current;
+        }
+
+        Iterator& operator++() {
+            ++current;
+            return *this;
+        }
+
+        bool operator==(ViewEnd) const {
+            return current == last;
+        }
+
+    private:
+        T* current;
+        T* last;
+    };
+
+    explicit SpanRange(Span<T> elements) : elements(elements.rawData()), elementCount(elements.count()) {}
+
+    [[nodiscard]] Iterator begin() const {
+        return Iterator(elements, elements + elementCount);
+    }
+
+    [[nodiscard]] u64 count() const {
+        return elementCount;
+    }
+
+    [[nodiscard]] Span<T> span() const {
+        return Span<T>(elements, elementCount);
+    }
+
+private:
+    T* elements;
+    u64 elementCount;
+};
+
+template <typename BASE, typename FUNCTION>
+class MapRange {
+public:
+    class Iterator {
+    public:
+        Iterator(RangeIterator<BASE> base, const FUNCTION* function) : base(base), function(function) {}
+
+        decltype(auto) operator*() {
+            return std::invoke(*function, *base);
+        }
+
+        Iterator& operator++() {
+            ++base;
+            return *this;
+        }
+
+        bool operator==(ViewEnd) const {
+            return base == ViewEnd{};
+        }
+
+    private:
+        RangeIterator<BASE> base;
+        const FUNCTION* function;
+    };
+
+    MapRange(BASE base, FUNCTION function) : base(std::move(base)), function(std::move(function)) {}
+
+    [[nodiscard]] Iterator begin() const {
+        return Iterator(base.begin(), &function);
+    }
+
+    [[nodiscard]] u64 count() const requires SizedRange<BASE> {
+        return base.count();
+    }
+
+private:
+    BASE base;
+    FUNCTION function;
+};
+
+template <typename BASE, typename PREDICATE>
+class FilterRange {
+public:
+    class Iterator {
+    public:
+        Iterator(RangeIterator<BASE> base, const PREDICATE* predicate) : base(base), predicate(predicate) {
+            skipRejected();
+        }
+
+        decltype(auto) operator*() {
+            if constexpr(KeepsElements) {
+                return std::move(*kept);
+            } else {
+                return *base;
+            }
+        }
+
+        Iterator& operator++() {
+            ++base;
+            skipRejected();
+            return *this;
+        }
+
+        bool operator==(ViewEnd) const {
+            return base == ViewEnd{};
+        }
+
+    private:
+        using BaseReference = RangeReference<BASE>;
+
+        // Elements made on the fly, such as mapped ones, are kept from testing them until they're read, so the
+        // mapping function isn't called twice for them
+        constexpr static bool KeepsElements = !std::is_reference_v<BaseReference>;
+
+        void skipRejected() {
+            for(; base != ViewEnd{}; ++base) {
+                if constexpr(KeepsElements) {
+                    kept.emplace(*base);
+                    if(std::invoke(*predicate, std::as_const(*kept))) {
+                        return;
+                    }
+                } else {
+                    if(std::invoke(*predicate, static_cast<const std::remove_reference_t<BaseReference>&>(*base))) {
+                        return;
+                    }
+                }
+            }
+        }
+
+        RangeIterator<BASE> base;
+        const PREDICATE* predicate;
+        [[no_unique_address]] std::conditional_t<KeepsElements,
+                                                 std::optional<std::remove_cvref_t<BaseReference>>,
+                                                 std::monostate> kept;
+    };
+
+    FilterRange(BASE base, PREDICATE predicate) : base(std::move(base)), predicate(std::move(predicate)) {}
+
+    [[nodiscard]] Iterator begin() const {
+        return Iterator(base.begin(), &predicate);
+    }
+
+private:
+    BASE base;
+    PREDICATE predicate;
+};
+
+template <typename BASE>
+class EnumerateRange {
+public:
+    class Iterator {
+    public:
+        explicit Iterator(RangeIterator<BASE> base) : base(base) {}
+
+        Enumerated<RangeReference<BASE>> operator*() {
+            return Enumerated<RangeReference<BASE>>{.index = index, .element = *base};
+        }
+
+        Iterator& operator++() {
+            ++base;
+            ++index;
+            return *this;
+        }
+
+        bool operator==(ViewEnd) const {
+            return base == ViewEnd{};
+        }
+
+    private:
+        RangeIterator<BASE> base;
+        u64 index = 0;
+    };
+
+    explicit EnumerateRange(BASE base) : base(std::move(base)) {}
+
+    [[nodiscard]] Iterator begin() const {
+        return Iterator(base.begin());
+    }
+
+    [[nodiscard]] u64 count() const requires SizedRange<BASE> {
+        return base.count();
+    }
+
+private:
+    BASE base;
+};
+
+template <typename FIRST, typename SECOND>
+class ZipRange {
+public:
+    class Iterator {
+    public:
+        Iterator(RangeIterator<FIRST> first, RangeIterator<SECOND> second) : first(first), second(second) {}
+
+        std::pair<RangeReference<FIRST>, RangeReference<SECOND>> operator*() {
+            return std::pair<RangeReference<FIRST>, RangeReference<SECOND>>(*first, *second);
+        }
+
+        Iterator& operator++() {
+            ++first;
+            ++second;
+            return *this;
+        }
+
+        bool operator==(ViewEnd) const {
+            return first == ViewEnd{} || second == ViewEnd{};
+        }
+
+    private:
+        RangeIterator<FIRST> first;
+        RangeIterator<SECOND> second;
+    };
+
+    ZipRange(FIRST first, SECOND second) : first(std::move(first)), second(std::move(second)) {}
+
+    [[nodiscard]] Iterator begin() const {
+        return Iterator(first.begin(), second.begin());
+    }
+
+    [[nodiscard]] u64 count() const requires SizedRange<FIRST> && SizedRange<SECOND> {
+        return std::min<u64>(first.count(), second.count());
+    }
+
+private:
+    FIRST first;
+    SECOND second;
+};
+
+template <typename T>
+class ChunkRange {
+public:
+    class Iterator {
+    public:
+        Iterator(T* current, T* last, u64 chunkSize) : current(current), last(last), chunkSize(chunkSize) {}
+
+        Span<T> operator*() const {
+            return Span<T>(current, currentChunkSize());
+        }
+
+        Iterator& operator++() {
+            current += currentChunkSize();
+            return *this;
+        }
+
+        bool operator==(ViewEnd) const {
+            return current == last;
+        }
+
+    private:
+        [[nodiscard]] u64 currentChunkSize() const {
+            return std::min<u64>(chunkSize, static_cast<u64>(last - current));
+        }
+
+        T* current;
+        T* last;
+        u64 chunkSize;
+    };
+
+    ChunkRange(Span<T> elements, u64 chunkSize) : elements(elements), chunkSize(chunkSize) {
+        ASSERT_WITH_MESSAGE(chunkSize > 0, "Chunks need at least one element");
+    }
+
+    [[nodiscard]] Iterator begin() const {
+        Span<T> all = elements;
+        return Iterator(all.rawData(), all.rawData() + all.count(), chunkSize);
+    }
+
+    [[nodiscard]] u64 count() const {
+        return (elements.count() + chunkSize - 1) / chunkSize;
+    }
+
+private:
+    Span<T> elements;
+    u64 chunkSize;
+};
+
+template <typename T>
+struct StatusOrValue;
+
+template <typename T>
+struct StatusOrValue<StatusOr<T>> {
+    using Type = T;
+};
+
+template <typename ELEMENT, typename RANGE, typename ALLOCATOR>
+Core::Array<ELEMENT, ALLOCATOR> ArrayToCollectInto(const RANGE& range, const ALLOCATOR& allocator) {
+    if constexpr(SizedRange<RANGE>) {
+        return Core::Array<ELEMENT, ALLOCATOR>(range.count(), allocator);
+    } else {
+        return Core::Array<ELEMENT, ALLOCATOR>(allocator);
+    }
+}
+
+}    // namespace internal
+
+template <typename RANGE>
+RangeView<RANGE>::RangeView(RANGE range) : range(std::move(range)) {}
+
+template <typename RANGE>
+template <typename FUNCTION>
+auto RangeView<RANGE>::map(FUNCTION function) const {
+    static_assert(std::is_invocable_v<const FUNCTION&, Reference>, "The function has to take the elements of the view");
+    return RangeView<internal::MapRange<RANGE, FUNCTION>>(
+          internal::MapRange<RANGE, FUNCTION>(range, std::move(function)));
+}
+
+template <typename RANGE>
+template <typename PREDICATE>
+auto RangeView<RANGE>::filter(PREDICATE predicate) const {
+    static_assert(std::is_invocable_r_v<bool, const PREDICATE&, const Element&>,
+                  "The predicate has to take the elements of the view and return a bool");
+    return RangeView<internal::FilterRange<RANGE, PREDICATE>>(
+          internal::FilterRange<RANGE, PREDICATE>(range, std::move(predicate)));
+}
+
+template <typename RANGE>
+auto RangeView<RANGE>::enumerate() const {
+    return RangeView<internal::EnumerateRange<RANGE>>(internal::EnumerateRange<RANGE>(range));
+}
+
+template <typename RANGE>
+template <typename OTHER_RANGE>
+auto RangeView<RANGE>::zip(const RangeView<OTHER_RANGE>& other) const {
+    return RangeView<internal::ZipRange<RANGE, OTHER_RANGE>>(
+          internal::ZipRange<RANGE, OTHER_RANGE>(range, other.range));
+}
+
+template <typename RANGE>
+auto RangeView<RANGE>::chunk(u64 chunkSize) const requires internal::ContiguousRange<RANGE> {
+    using T = typename RANGE::ElementType;
+    return RangeView<internal::ChunkRange<T>>(internal::ChunkRange<T>(range.span(), chunkSize));
+}
+
+template <typename RANGE>
+u64 RangeView<RANGE>::count() const requires internal::SizedRange<RANGE> {
+    return range.count();
+}
+
+template <typename RANGE>
+template <typename ALLOCATOR>
+Core::Array<typename RangeView<RANGE>::Element, ALLOCATOR>
+RangeView<RANGE>::collect(const ALLOCATOR& allocator) const {
+    Core::Array<Element, ALLOCATOR> collected = internal::ArrayToCollectInto<Element>(range, allocator);
+    for(Iterator element = range.begin(); element != internal::ViewEnd{}; ++element) {
+        collected.emplace(*element);
+    }
+    return collected;
+}
+
+template <typename RANGE>
+template <typename ALLOCATOR>
+auto RangeView<RANGE>::collectWithStatus(const ALLOCATOR& allocator) const {
+    using Value  = typename internal::StatusOrValue<Element>::Type;
+    using Result = Core::StatusOr<Core::Array<Value, ALLOCATOR>>;
+
+    Core::Array<Value, ALLOCATOR> collected = internal::ArrayToCollectInto<Value>(range, allocator);
+    for(Iterator element = range.begin(); element != internal::ViewEnd{}; ++element) {
+        Element valueOrError = *element;
+        if(valueOrError.peekError()) {
+            return Result(std::move(valueOrError).status());
+        }
+        collected.emplace(std::move(valueOrError).value());
+    }
+    return Result(std::move(collected));
+}
+
+template <typename RANGE>
+typename RangeView<RANGE>::Iterator RangeView<RANGE>::begin() const {
+    return range.begin();
+}
+
+template <typename RANGE>
+internal::ViewEnd RangeView<RANGE>::end() const {
+    return {};
+}
+
+template <typename T>
+RangeView<internal::SpanRange<T>> View(Span<T> elements) {
+    return RangeView<internal::SpanRange<T>>(internal::SpanRange<T>(elements));
+}
+
+template <typename T, typename ALLOCATOR>
+RangeView<internal::SpanRange<T>> View(Core::Array<T, ALLOCATOR>& elements) {
+    return View(Core::ToSpan(elements));
+}
+
+template <typename T, typename ALLOCATOR>
+RangeView<internal::SpanRange<const T>> View(const Core::Array<T, ALLOCATOR>& elements) {
+    return View(Core::ToSpan(elements));
+}
+
+}    // namespace Core::Algorithms
@@ -0,0 +1,154 @@
+#pragma once
+
+#include "core/algorithms/Sorting.h"
+
+#include "core/assert/Assert.h"
+
+#include <bit>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <utility>
+
+namespace Core::Algorithms {
+
+namespace internal {
+
+// Below this many elements clearing and walking the histograms costs more than an insertion sort
+constexpr u64 RadixSortMinimumCount = 64;
+
+template <u64 SIZE>
+using UnsignedOfSize = std::conditional_t<
+      SIZE == 1,
+      u8,
+      std::conditional_t<SIZE == 2, u16, std::conditional_t<SIZE == 4, u32, u64>>>;
+
+// Maps a key to an unsigned integer of the same size that sorts in the same order
+template <typename KEY>
+UnsignedOfSize<sizeof(KEY)> RadixKeyBits(KEY key) {
+    using Bits             = UnsignedOfSize<sizeof(KEY)>;
+    constexpr Bits SignBit = Bits(1) << (sizeof(Bits) * 8 - 1);
+
+    if constexpr(std::is_floating_point_v<KEY>) {
+        // Flipping every bit of a negative number reverses its order, and setting the sign bit of a positive one moves
+        // it above all the negative ones
+        Bits bits = std::bit_cast<Bits>(key);
+        return (bits & SignBit) != 0 ? Bits(~bits) : Bits(bits | SignBit);
+    } else if constexpr(std::is_signed_v<KEY>) {
+        return Bits(static_cast<Bits>(key) ^ SignBit);
+    } else {
+        return key;
+    }
+}
+
+template <typename T, typename KEY_FUNCTION>
+void InsertionSortByKey(Span<T> elements, const KEY_FUNCTION& key) {
+    for(u64 i = 1; i < elements.count(); i++) {
+        T element = elements[i];
+        auto bits = RadixKeyBits(key(element));
+
+        u64 j = i;
+        for(; j > 0 && RadixKeyBits(key(elements[j - 1])) > bits; j--) {
+            elements[j] = elements[j - 1];
+        }
+        elements[j] = element;
+    }
+}
+
+}    // namespace internal
+
+template <typename T, typename KEY_FUNCTION>
+void RadixSort(Span<T> elements, const KEY_FUNCTION& key) {
+    if(elements.count() < internal::RadixSortMinimumCount) {
+        internal::InsertionSortByKey(elements, key);
+        return;
+    }
+
+    Core::Array<T> scratch(elements.count());
+    RadixSort(elements, scratch.insertUninitialized(elements.count()), key);
+}
+
+template <typename T, typename KEY_FUNCTION>
+void RadixSort(Span<T> elements, Span<T> scratch, const KEY_FUNCTION& key) {
+    using Key  = std::remove_cvref_t<std::invoke_result_t<const KEY_FUNCTION&, const T&>>;
+    using Bits = internal::UnsignedOfSize<sizeof(Key)>;
+    static_assert(RadixSortKey<Key>, "Radix sort keys are integers or floating point numbers");
+    static_assert(std::is_trivially_copyable_v<T>, "Elements are copied back and forth between elements and scratch");
+
+    constexpr u64 DigitCount = sizeof(Key);
+    constexpr u64 RadixSize  = 256;
+
+    u64 count = elements.count();
+    ASSERT_WITH_MESSAGE(scratch.count() >= count, "Radix sort needs as much scratch space as there are elements");
+
+    if(count < internal::RadixSortMinimumCount) {
+        internal::InsertionSortByKey(elements, key);
+        return;
+    }
+
+    // Every digit is counted in one pass over the keys, rather than a pass per digit
+    u64 histograms[DigitCount][RadixSize] = {};
+    for(const T& element : elements) {
+        Bits bits = internal::RadixKeyBits(key(element));
+        for(u64 digit = 0; digit < DigitCount; digit++) {
+            histograms[digit][(bits >> (digit * 8)) & 0xFF]++;
+        }
+    }
+
+    Bits firstBits = internal::RadixKeyBits(key(elements[0]));
+    T* source      = elements.begin();
+    T* destination = scratch.begin();
+    for(u64 digit = 0; digit < DigitCount; digit++) {
+        u64* histogram = histograms[digit];
+
+        // A digit that's the same for every key can't change the order. This skips most of the passes for small keys
+        // stored in large types.
+        if(histogram[(firstBits >> (digit * 8)) & 0xFF] == count) {
+            continue;
+        }
+
+        u64 offset = 0;
+        for(u64 value = 0; value < RadixSize; value++) {
+            u64 valueCount   = histogram[value];
+            histogram[value] = offset;
+            offset += valueCount;
+        }
+
+        for(u64 i = 0; i < count; i++) {
+            Bits bits = internal::RadixKeyBits(key(source[i]));
+            destination[histogram[(bits >> (digit * 8)) & 0xFF]++] = source[i];
+        }
+        std::swap(source, destination);
+    }
+
+    if(source != elements.begin()) {
+        std::memcpy(elements.begin(), source, count * sizeof(T));
+    }
+}
+
+template <typename KEY>
+void RadixSort(Span<KeyIndexPair<KEY>> pairs) {
+    RadixSort(pairs, [](const KeyIndexPair<KEY>& pair) {
+        return pair.key;
+    });
+}
+
+template <typename KEY>
+Core::Array<u32> RadixSortedOrder(Span<KEY> keys) {
+    using Key = std::remove_const_t<KEY>;
+    ASSERT_WITH_MESSAGE(keys.count() <= std::numeric_limits<u32>::max(), "Too many keys for 32-bit indices");
+
+    Core::Array<KeyIndexPair<Key>> pairs(keys.count());
+    for(u64 i = 0; i < keys.count(); i++) {
+        pairs.insert(KeyIndexPair<Key>{.key = keys[i], .index = static_cast<u32>(i)});
+    }
+    RadixSort(Core::ToSpan(pairs));
+
+    Core::Array<u32> order(keys.count());
+    for(const KeyIndexPair<Key>& pair : pairs) {
+        order.insert(pair.index);
+    }
+    return order;
+}
+
+}    // namespace Core::Algorithms
@@ -0,0 +1,179 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/Types.h"
+#include "core/algorithms/Hashing.h"
+
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+using namespace Core::Algorithms;
+
+namespace {
+// The same input as the xxhash sanity checks, so the expected values below can be checked against the reference
+std::vector<byte> SanityBuffer(u64 size) {
+    std::vector<byte> buffer(size);
+    u64 generator = 2654435761;
+    for(byte& value : buffer) {
+        value = static_cast<byte>(generator >> 56);
+        generator *= 11400714785074694797ull;
+    }
+    return buffer;
+}
+
+Core::Span<const byte> Prefix(const std::vector<byte>& buffer, u64 length) {
+    return Core::Span<const byte>(buffer.data(), length);
+}
+
+struct ReferenceHash {
+    u64 length;
+    u64 hash;
+    u64 seededHash;
+    Hash128 hash128;
+    Hash128 seededHash128;
+};
+
+constexpr u64 Seed = 0x9E3779B185EBCA8D;
+
+// From the reference XXH3_64bits_withSeed and XXH3_128bits_withSeed, with lengths at the edges of each size class
+const ReferenceHash ReferenceHashes[] = {
+      {0,
+       0x2d06800538d394c2,
+       0xa8a6b918b2f0364a,
+       {0x6001c324468d497f, 0x99aa06d3014798d8},
+       {0xa986dfc5d7605bfe, 0x00feaa732a3ce25e}},
+      {1,
+       0xc44bdff4074eecdb,
+       0x032be332dd766ef8,
+       {0xc44bdff4074eecdb, 0xa6cd5e9392000f6a},
+       {0x032be332dd766ef8, 0x20e49abcc53b3842}},
+      {3,
+       0x54247382a8d6b94d,
+       0x634b8990b4976373,
+       {0x54247382a8d6b94d, 0x20efc49ff02422ea},
+       {0x634b8990b4976373, 0x1c7ecf6a308cf00e}},
+      {4,
+       0xe5dc74bc51848a51,
+       0xaa2e7eccb0c8f747,
+       {0x2e7d8d6876a39fe9, 0x970d585ac632bf8e},
+       {0xbfaf51f1e67e0b0f, 0x3d53e5dfd837d927}},
+      {8,
+       0x24ccc9acaa9f65e4,
+       0x8f973410999b8f6b,
+       {0x64c69cab4bb21dc5, 0x47a7f080d82bb456},
+       {0x7b29471dc729b5ff, 0xf50cec145bcd5c5a}},
+      {9,
+       0x14d5001c15dd3f2b,
+       0xb3ae7333d9013f60,
+       {0xed7ccbc501eb7501, 0x564ef6078950d457},
+       {0xaef5dfc0ac9f9044, 0x6b380b43ffa61042}},
+      {16,
+       0x981b17d36c7498c9,
+       0x663f29333b4db6b1,
+       {0x562980258a998629, 0xc68c368ecf8a9c05},
+       {0x0346d13a7a5498c7, 0x6ffcb80cd33085c8}},
+      {17,
+       0x796f5acd3a60f862,
+       0xf3ec5067f4306db3,
+       {0xabbc12d11973d7db, 0x955fa78643ed3669},
+       {0x980a14119985a7df, 0xd77681219e464828}},
+      {64,
+       0x9cb48487720ec49d,
+       0x4fe8895db9b8c077,
+       {0xefdb6a44690721a9, 0x6d90e81a9b0fd622},
+       {0x9405ba2affa95ceb, 0x37b738968d40bda5}},
+      {65,
+       0xfd81aac4bebc3883,
+       0xad80aeec1fc9e0a7,
+       {0xfe2f650fa500ec6e, 0x6c074d65e54db85a},
+       {0x9d60c345e5c297cd, 0x72503a6fa8d07adb}},
+      {128,
+       0xfcff24126754d861,
+       0x73fde75280646649,
+       {0xebb15e34a7fb5ab1, 0x39992220e045260a},
+       {0x8394f5c51f1d8246, 0xa0f7ccb68ee02add}},
+      {129,
+       0x98f1b0a679a2ca29,
+       0x21fffdbca099c844,
+       {0x86c9e3bc8f0a3b5c, 0x03815fc91f1b30b6},
+       {0xd4aae26fcec7dc03, 0xad559266067c0bf3}},
+      {240,
+       0x81c3c2b67f568ccf,
+       0xcc0f58c27ef3d8ee,
+       {0x5c9aae94c8ebe5a0, 0xaa4202daa2769dc8},
+       {0x604e98db085c1864, 0x29d2133d6ea58c5b}},
+      {241,
+       0xc5a639ecd2030e5e,
+       0xdda9b0a161d4829a,
+       {0xc5a639ecd2030e5e, 0x99a80ecf0ecfc647},
+       {0xdda9b0a161d4829a, 0xec64afae6a137582}},
+      {1024,
+       0xdd85c9b5c1109c5c,
+       0xef368a8a2ebabaef,
+       {0xdd85c9b5c1109c5c, 0x0d30d24071c64c57},
+       {0xef368a8a2ebabaef, 0x17600efe2b493a18}},
+      {1025,
+       0xd870c0fa13211c6a,
+       0x96792bcf9af88519,
+       {0xd870c0fa13211c6a, 0xfd3ee4fe7f2954c6},
+       {0x96792bcf9af88519, 0x2c383949f57bf7e1}},
+      {4107,
+       0xcb55589b16b7596e,
+       0x822fd6cbd55deaf3,
+       {0xcb55589b16b7596e, 0xb84d4a7645cab431},
+       {0x822fd6cbd55deaf3, 0x24722a518495a1b5}},
+};
+}    // namespace
+
+TEST_CASE("Hash Bytes Matches The Reference") {
+    std::vector<byte> buffer = SanityBuffer(4200);
+
+    for(const ReferenceHash& reference : ReferenceHashes) {
+        INFO(reference.length);
+        REQUIRE(HashBytes(Prefix(buffer, reference.length)) == reference.hash);
+        REQUIRE(HashBytes(Prefix(buffer, reference.length), Seed) == reference.seededHash);
+        REQUIRE(HashBytes128(Prefix(buffer, reference.length)) == reference.hash128);
+        REQUIRE(HashBytes128(Prefix(buffer, reference.length), Seed) == reference.seededHash128);
+    }
+}
+
+TEST_CASE("Streaming Hasher Matches Hashing At Once") {
+    std::vector<byte> buffer = SanityBuffer(5000);
+    std::mt19937_64 random(5);
+
+    for(u64 length : {0, 1, 100, 240, 241, 256, 257, 320, 1023, 1024, 1025, 2048, 3000, 5000}) {
+        for(u64 seed : {u64(0), Seed}) {
+            for(u64 maximumPiece : {1, 7, 64, 255, 256, 257, 5000}) {
+                StreamingHasher hasher(seed);
+                for(u64 position = 0; position < length;) {
+                    u64 piece = std::min(random() % maximumPiece + 1, length - position);
+                    hasher.update(Core::Span<const byte>(buffer.data() + position, piece));
+                    position += piece;
+                }
+
+                INFO(length << " " << seed << " " << maximumPiece);
+                REQUIRE(hasher.finish() == HashBytes(Prefix(buffer, length), seed));
+                REQUIRE(hasher.finish128() == HashBytes128(Prefix(buffer, length), seed));
+            }
+        }
+    }
+
+    StreamingHasher hasher;
+    hasher.update(Prefix(buffer, 1000));
+    hasher.reset(Seed);
+    hasher.update(Prefix(buffer, 10));
+    REQUIRE(hasher.finish() == HashBytes(Prefix(buffer, 10), Seed));
+}
+
+TEST_CASE("Mix Integer Spreads Small Integers") {
+    std::unordered_set<u64> topBytes;
+    for(u64 i = 0; i < 256; i++) {
+        topBytes.insert(MixInteger(i) >> 56);
+    }
+    // Identity hashes of small integers would all be 0 here
+    REQUIRE(topBytes.size() > 128);
+
+    REQUIRE(CombineHashes(1, 2) != CombineHashes(2, 1));
+    REQUIRE(CombineHashes(7, 7) != CombineHashes(8, 8));
+    REQUIRE(CombineHashes(7, 7) != 0);
+}
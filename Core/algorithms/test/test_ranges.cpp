@@ -0,0 +1,197 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/Types.h"
+#include "core/algorithms/Containers.h"
+#include "core/algorithms/Ranges.h"
+#include "core/containers/Array.h"
+#include "core/memory/Allocator.h"
+#include "core/status/StatusOr.h"
+
+#include <string>
+
+namespace {
+
+// Counts how often it allocates, to check that views don't
+class CountingAllocator {
+public:
+    explicit CountingAllocator(u64& allocations) : allocations(&allocations) {}
+
+    [[nodiscard]] void* allocate(u64 size, u64 alignment) {
+        (*allocations)++;
+        return Core::Memory::MallocAllocator().allocate(size, alignment);
+    }
+
+    void deallocate(void* memory, u64 size) {
+        Core::Memory::MallocAllocator().deallocate(memory, size);
+    }
+
+    bool operator==(const CountingAllocator& other) const = default;
+
+private:
+    u64* allocations;
+};
+
+Core::Array<u64> Numbers(u64 count) {
+    Core::Array<u64> numbers(count);
+    for(u64 i = 0; i < count; i++) {
+        numbers.insert(i);
+    }
+    return numbers;
+}
+
+Core::StatusOr<u64> ParseDigit(char c) {
+    if(c < '0' || c > '9') {
+        return Core::Status::Error("'{}' is not a digit", c);
+    }
+    return static_cast<u64>(c - '0');
+}
+
+}    // namespace
+
+TEST_CASE("Ranges Map And Filter Fuse Into One Pass") {
+    Core::Array<u64> numbers = Numbers(10);
+
+    u64 mapped  = 0;
+    auto square = [&mapped](u64 number) {
+        mapped++;
+        return number * number;
+    };
+    auto isEven = [](u64 number) { return number % 2 == 0; };
+
+    u64 sum = 0;
+    for(u64 square : Core::Algorithms::View(numbers).map(square).filter(isEven)) {
+        sum += square;
+    }
+    REQUIRE(sum == 0 + 4 + 16 + 36 + 64);
+
+    // The filter keeps mapped elements instead of mapping them again when they're read
+    REQUIRE(mapped == 10);
+
+    Core::Array<u64> evenSquares = Core::Algorithms::View(numbers).filter(isEven).map(square).collect();
+    REQUIRE(evenSquares.count() == 5);
+    REQUIRE(evenSquares[0] == 0);
+    REQUIRE(evenSquares[4] == 64);
+}
+
+TEST_CASE("Ranges Views Can Change The Elements They Were Made From") {
+    Core::Array<u64> numbers = Numbers(5);
+    for(u64& number : Core::Algorithms::View(numbers).filter([](u64 number) { return number >= 3; })) {
+        number = 0;
+    }
+
+    REQUIRE(numbers[2] == 2);
+    REQUIRE(numbers[3] == 0);
+    REQUIRE(numbers[4] == 0);
+}
+
+TEST_CASE("Ranges Enumerate And Zip") {
+    Core::Array<std::string> names = {"a", "b", "c"};
+    Core::Array<u64> numbers       = Numbers(5);
+
+    u64 positions = 0;
+    for(auto [index, name] : Core::Algorithms::View(names).enumerate()) {
+        REQUIRE(name == names[index]);
+        positions += index;
+    }
+    REQUIRE(positions == 3);
+
+    auto zipped = Core::Algorithms::View(names).zip(Core::Algorithms::View(numbers));
+    REQUIRE(zipped.count() == 3);
+
+    Core::Array<std::string> labels =
+          zipped.map([](const auto& pair) { return pair.first + std::to_string(pair.second); }).collect();
+    REQUIRE(labels.count() == 3);
+    REQUIRE(labels[0] == "a0");
+    REQUIRE(labels[2] == "c2");
+}
+
+TEST_CASE("Ranges Chunk") {
+    Core::Array<u64> numbers = Numbers(10);
+
+    auto chunks = Core::Algorithms::View(numbers).chunk(4);
+    REQUIRE(chunks.count() == 3);
+
+    Core::Array<u64> sums = chunks
+                                  .map([](Core::Span<const u64> chunk) {
+                                      u64 sum = 0;
+                                      for(u64 number : chunk) {
+                                          sum += number;
+                                      }
+                                      return sum;
+                                  })
+                                  .collect();
+    REQUIRE(sums.count() == 3);
+    REQUIRE(sums[0] == 0 + 1 + 2 + 3);
+    REQUIRE(sums[1] == 4 + 5 + 6 + 7);
+    REQUIRE(sums[2] == 8 + 9);
+
+    Core::Array<u64> empty;
+    REQUIRE(Core::Algorithms::View(empty).chunk(4).count() == 0);
+}
+
+TEST_CASE("Ranges Collect Allocates Once When The Count Is Known") {
+    u64 allocations = 0;
+    CountingAllocator allocator(allocations);
+
+    Core::Array<u64> numbers = Numbers(1000);
+    Core::Array<u64, CountingAllocator> doubled =
+          Core::Algorithms::View(numbers).map([](u64 number) { return number * 2; }).collect(allocator);
+    REQUIRE(doubled.count() == 1000);
+    REQUIRE(doubled[999] == 1998);
+    REQUIRE(allocations == 1);
+
+    // Iterating doesn't allocate at all
+    allocations = 0;
+    u64 sum     = 0;
+    for(const auto& [index, number] : Core::Algorithms::View(doubled).enumerate().filter([](const auto& element) {
+            return element.index % 2 == 0;
+        })) {
+        sum += number;
+    }
+    REQUIRE(sum == 499000);
+    REQUIRE(allocations == 0);
+}
+
+TEST_CASE("Ranges Collect With Status") {
+    std::string digits = "4711";
+    Core::Span<char> characters(digits.data(), digits.size());
+
+    Core::StatusOr<Core::Array<u64>> parsed = Core::Algorithms::View(characters).map(ParseDigit).collectWithStatus();
+    REQUIRE(parsed.isOk());
+    REQUIRE(parsed.value().count() == 4);
+    REQUIRE(parsed.value()[0] == 4);
+    REQUIRE(parsed.value()[3] == 1);
+
+    std::string notDigits = "4x1y";
+    u64 read              = 0;
+    auto parseAndCount    = [&read](char c) {
+        read++;
+        return ParseDigit(c);
+    };
+    Core::StatusOr<Core::Array<u64>> failed =
+          Core::Algorithms::View(Core::Span<char>(notDigits.data(), notDigits.size()))
+                .map(parseAndCount)
+                .collectWithStatus();
+    REQUIRE(failed.isError());
+    REQUIRE(failed.message() == "'x' is not a digit");
+    REQUIRE(read == 2);
+}
+
+TEST_CASE("Ranges Eager Algorithms") {
+    Core::Array<u64> numbers = Numbers(6);
+
+    Core::Array<u64> tripled = Core::Algorithms::Map(numbers, [](u64 number) { return number * 3; });
+    REQUIRE(tripled.count() == 6);
+    REQUIRE(tripled[5] == 15);
+
+    Core::Array<u64> odd = Core::Algorithms::Filter(numbers, [](u64 number) { return number % 2 == 1; });
+    REQUIRE(odd.count() == 3);
+    REQUIRE(odd[2] == 5);
+
+    // Used to keep the elements from before they were transformed
+    Core::StatusOr<Core::Array<u64>> plusOne = Core::Algorithms::MapWithStatus(
+          numbers, [](u64 number) -> Core::StatusOr<u64> { return number + 1; });
+    REQUIRE(plusOne.isOk());
+    REQUIRE(plusOne.value()[0] == 1);
+    REQUIRE(plusOne.value()[5] == 6);
+}
@@ -0,0 +1,156 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/Types.h"
+#include "core/algorithms/Sorting.h"
+#include "core/containers/Array.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <random>
+
+namespace {
+
+template <typename KEY>
+Core::Array<KEY> RandomKeys(u64 count, u64 seed) {
+    std::mt19937_64 random(seed);
+
+    Core::Array<KEY> keys(count);
+    for(u64 i = 0; i < count; i++) {
+        if constexpr(std::is_floating_point_v<KEY>) {
+            std::uniform_real_distribution<KEY> distribution(-1e6, 1e6);
+            keys.insert(distribution(random));
+        } else {
+            keys.insert(static_cast<KEY>(random()));
+        }
+    }
+    return keys;
+}
+
+template <typename KEY>
+bool SortsLikeStableSort(Core::Array<KEY> keys) {
+    Core::Array<Core::Algorithms::KeyIndexPair<KEY>> pairs;
+    for(u64 i = 0; i < keys.count(); i++) {
+        pairs.insert(Core::Algorithms::KeyIndexPair<KEY>{.key = keys[i], .index = static_cast<u32>(i)});
+    }
+    Core::Array<Core::Algorithms::KeyIndexPair<KEY>> expected = pairs;
+
+    Core::Algorithms::RadixSort(Core::ToSpan(pairs));
+    std::stable_sort(expected.begin(), expected.end(), [](const auto& a, const auto& b) {
+        return a.key < b.key;
+    });
+
+    for(u64 i = 0; i < pairs.count(); i++) {
+        if(pairs[i].index != expected[i].index) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename KEY>
+void CheckAllSizes() {
+    for(u64 count : {0, 1, 2, 63, 64, 65, 1000, 100000}) {
+        REQUIRE(SortsLikeStableSort(RandomKeys<KEY>(count, count)));
+    }
+
+    // Few distinct values, so equal keys have to keep their order
+    Core::Array<KEY> repeated = RandomKeys<KEY>(5000, 7);
+    for(KEY& key : repeated) {
+        key = static_cast<KEY>(static_cast<i64>(key) % 5);
+    }
+    REQUIRE(SortsLikeStableSort(repeated));
+}
+
+}    // namespace
+
+TEST_CASE("Radix Sort Unsigned Keys") {
+    CheckAllSizes<u8>();
+    CheckAllSizes<u16>();
+    CheckAllSizes<u32>();
+    CheckAllSizes<u64>();
+}
+
+TEST_CASE("Radix Sort Signed Keys") {
+    CheckAllSizes<i8>();
+    CheckAllSizes<i16>();
+    CheckAllSizes<i32>();
+    CheckAllSizes<i64>();
+
+    Core::Array<i64> extremes{0, std::numeric_limits<i64>::max(), -1, std::numeric_limits<i64>::min(), 1};
+    for(u64 i = 0; i < 100; i++) {
+        extremes.insert(static_cast<i64>(i) - 50);
+    }
+    REQUIRE(SortsLikeStableSort(extremes));
+}
+
+TEST_CASE("Radix Sort Floating Point Keys") {
+    CheckAllSizes<f32>();
+    CheckAllSizes<f64>();
+
+    Core::Array<f32> special{std::numeric_limits<f32>::infinity(),
+                             -std::numeric_limits<f32>::infinity(),
+                             std::numeric_limits<f32>::denorm_min(),
+                             -std::numeric_limits<f32>::denorm_min(),
+                             std::numeric_limits<f32>::max(),
+                             std::numeric_limits<f32>::lowest(),
+                             0.0f,
+                             1.0f,
+                             -1.0f};
+    for(u64 i = 0; i < 100; i++) {
+        special.insert(static_cast<f32>(i) * 0.37f - 18.0f);
+    }
+    REQUIRE(SortsLikeStableSort(special));
+}
+
+TEST_CASE("Radix Sort Negative Zero Comes First") {
+    Core::Array<f64> zeros;
+    for(u64 i = 0; i < 100; i++) {
+        zeros.insert(i % 2 == 0 ? 0.0 : -0.0);
+    }
+
+    Core::Algorithms::RadixSort(Core::ToSpan(zeros), [](f64 value) {
+        return value;
+    });
+    for(u64 i = 0; i < 100; i++) {
+        REQUIRE(std::signbit(zeros[i]) == (i < 50));
+    }
+}
+
+TEST_CASE("Radix Sort By Key Function") {
+    struct DrawCall {
+        u64 sortKey;
+        u32 mesh;
+        u32 material;
+    };
+
+    Core::Array<u64> keys = RandomKeys<u64>(10000, 3);
+    Core::Array<DrawCall> drawCalls;
+    for(u64 i = 0; i < keys.count(); i++) {
+        drawCalls.insert(DrawCall{.sortKey = keys[i] >> 20, .mesh = static_cast<u32>(i), .material = 0});
+    }
+
+    Core::Array<DrawCall> scratch(DrawCall{}, drawCalls.count());
+    Core::Algorithms::RadixSort(Core::ToSpan(drawCalls), Core::ToSpan(scratch), [](const DrawCall& drawCall) {
+        return drawCall.sortKey;
+    });
+
+    bool sorted = true;
+    for(u64 i = 1; i < drawCalls.count(); i++) {
+        sorted = sorted && drawCalls[i - 1].sortKey <= drawCalls[i].sortKey;
+    }
+    REQUIRE(sorted);
+}
+
+TEST_CASE("Radix Sorted Order") {
+    Core::Array<f32> keys{3.0f, -1.0f, 2.0f, -1.0f, 0.5f};
+    Core::Array<u32> order = Core::Algorithms::RadixSortedOrder(Core::ToSpan(keys));
+
+    REQUIRE(order.count() == 5);
+    REQUIRE(order[0] == 1);
+    REQUIRE(order[1] == 3);
+    REQUIRE(order[2] == 4);
+    REQUIRE(order[3] == 2);
+    REQUIRE(order[4] == 0);
+}
@@ -0,0 +1,342 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/Types.h"
+#include "core/algorithms/Strings.h"
+#include "core/containers/Array.h"
+
+#include <bit>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Core::Algorithms;
+
+namespace {
+std::vector<std::string_view> ReferenceSplit(std::string_view string, std::string_view delimiters) {
+    std::vector<std::string_view> splits;
+    std::string_view::size_type start = 0;
+    for(std::string_view::size_type i = 0; i < string.size(); i++) {
+        if(delimiters.find(string[i]) != std::string_view::npos) {
+            splits.push_back(string.substr(start, i - start));
+            start = i + 1;
+        }
+    }
+    if(start != string.size()) {
+        splits.push_back(string.substr(start));
+    }
+    return splits;
+}
+
+bool SameSplits(const Core::Array<std::string_view>& actual, const std::vector<std::string_view>& expected) {
+    if(actual.count() != expected.size()) {
+        return false;
+    }
+    for(u64 i = 0; i < actual.count(); i++) {
+        if(actual[i].data() != expected[i].data() || actual[i].size() != expected[i].size()) {
+            return false;
+        }
+    }
+    return true;
+}
+}    // namespace
+
+TEST_CASE("Split On A Single Delimiter") {
+    Core::Array<std::string_view> splits = String::Split("f 1/2/3 4//6 7/8/", '/');
+
+    REQUIRE(splits.count() == 6);
+    REQUIRE(splits[0] == "f 1");
+    REQUIRE(splits[1] == "2");
+    REQUIRE(splits[2] == "3 4");
+    REQUIRE(splits[3] == "");
+    REQUIRE(splits[4] == "6 7");
+    REQUIRE(splits[5] == "8");
+}
+
+TEST_CASE("Split Filters") {
+    std::string_view text = "a,,  ,b,\t,c";
+
+    REQUIRE(String::Split(text, ',', String::Filter::None).count() == 6);
+    REQUIRE(String::Split(text, ',', String::Filter::Empty).count() == 5);
+    REQUIRE(String::Split(text, ',', String::Filter::Whitespace).count() == 3);
+}
+
+TEST_CASE("Split Matches A Byte At A Time Split") {
+    // Delimiter sets that fit in the vector paths, and ones that don't, including bytes past ASCII
+    std::vector<std::string> delimiterSets{
+          " ",
+          " \t",
+          "/\n\r",
+          "abcdefgh",
+          std::string("\x00\x10\x20\x30\x40\x50\x60\x70\x80\x90\xA0", 11),
+          std::string("\xA0\xFF", 2),
+    };
+
+    std::mt19937_64 random(3);
+    for(const std::string& delimiters : delimiterSets) {
+        for(u64 length : {0, 1, 15, 16, 17, 31, 32, 33, 64, 100, 1000}) {
+            std::string text(length, '\0');
+            for(char& c : text) {
+                c = random() % 4 == 0 ? delimiters[random() % delimiters.size()] : static_cast<char>(random() % 256);
+            }
+
+            Core::Array<std::string_view> splits = String::Split(text, delimiters);
+            REQUIRE(SameSplits(splits, ReferenceSplit(text, delimiters)));
+
+            Core::Array<std::string_view> singleSplits = String::Split(text, delimiters[0]);
+            REQUIRE(SameSplits(singleSplits, ReferenceSplit(text, delimiters.substr(0, 1))));
+        }
+    }
+}
+
+TEST_CASE("Split Lines") {
+    std::string text =
+          "v 1 2 3\r\n\nvt 0 1\n\r\nf 1/1 2/2 3/3\r\n# a comment that is longer than a block of bytes\nlast";
+
+    Core::Array<std::string_view> lines = String::SplitLines(text);
+    REQUIRE(lines.count() == 7);
+    REQUIRE(lines[0] == "v 1 2 3");
+    REQUIRE(lines[1] == "");
+    REQUIRE(lines[2] == "vt 0 1");
+    REQUIRE(lines[3] == "");
+    REQUIRE(lines[4] == "f 1/1 2/2 3/3");
+    REQUIRE(lines[5] == "# a comment that is longer than a block of bytes");
+    REQUIRE(lines[6] == "last");
+
+    REQUIRE(String::SplitLines(text, String::Filter::Empty).count() == 5);
+    REQUIRE(String::SplitLines("one\ntwo\n").count() == 2);
+
+    Core::Array<std::string_view> buffer{"first"};
+    String::SplitLinesIntoBuffer("one\r\ntwo", buffer);
+    REQUIRE(buffer.count() == 3);
+    REQUIRE(buffer[0] == "first");
+    REQUIRE(buffer[1] == "one");
+    REQUIRE(buffer[2] == "two");
+}
+
+namespace {
+bool SameBits(double a, double b) {
+    return std::bit_cast<u64>(a) == std::bit_cast<u64>(b);
+}
+
+bool SameBits(float a, float b) {
+    return std::bit_cast<u32>(a) == std::bit_cast<u32>(b);
+}
+
+// Checks FromChars against strtod and strtof, including how much of the text they use
+bool MatchesStrtod(const std::string& text) {
+    char* end             = nullptr;
+    double expectedDouble = std::strtod(text.c_str(), &end);
+    float expectedFloat   = std::strtof(text.c_str(), nullptr);
+    u64 expectedLength    = end - text.c_str();
+
+    double actualDouble = 0.0;
+    float actualFloat   = 0.0f;
+    if(String::FromChars(text, actualDouble) != expectedLength ||
+       String::FromChars(text, actualFloat) != expectedLength) {
+        return false;
+    }
+    if(std::isnan(expectedDouble)) {
+        return std::isnan(actualDouble) && std::isnan(actualFloat);
+    }
+    return SameBits(actualDouble, expectedDouble) && SameBits(actualFloat, expectedFloat);
+}
+}    // namespace
+
+TEST_CASE("Parse Real Numbers") {
+    REQUIRE(String::ParseDouble("  -1.5e3 ") == -1500.0);
+    REQUIRE(String::ParseFloat("0.25") == 0.25f);
+    REQUIRE(String::ParseDouble("") == 0.0);
+    REQUIRE(String::ParseDouble("x") == 0.0);
+
+    double value = 7.0;
+    REQUIRE(String::FromChars("abc", value) == 0);
+    REQUIRE(value == 7.0);
+    REQUIRE(String::FromChars(" 1", value) == 0);
+    REQUIRE(String::FromChars("1.5/2/3", value) == 3);
+    REQUIRE(value == 1.5);
+    REQUIRE(String::FromChars("2e", value) == 1);
+    REQUIRE(String::FromChars("2e+x", value) == 1);
+    REQUIRE(String::FromChars(".5", value) == 2);
+    REQUIRE(String::FromChars("5.", value) == 2);
+    REQUIRE(String::FromChars(".", value) == 0);
+    REQUIRE(String::FromChars("-", value) == 0);
+}
+
+TEST_CASE("Parse Real Numbers Matches Strtod") {
+    std::vector<std::string> cases{
+          "0",
+          "-0",
+          "1",
+          "0.1",
+          "3.14159265358979323846264338327950288",
+          "1e308",
+          "1.7976931348623157e308",
+          "1.7976931348623159e308",
+          "2e308",
+          "4.9406564584124654e-324",
+          "2.4703282292062328e-324",
+          "2.4703282292062327e-324",
+          "2.2250738585072011e-308",
+          "2.2250738585072014e-308",
+          "1e-400",
+          "3.4028235e38",
+          "3.4028236e38",
+          "1.17549435e-38",
+          "1.4e-45",
+          "7.0064923216240854e-46",
+          "9007199254740993",
+          "9007199254740992.5",
+          "9007199254740993.0000000000000000000000001",
+          "123456789012345678901234567890",
+          "0.000000000000000000000000000000000000000000001234567890123456789012",
+          "1.00000000000000011102230246251565404236316680908203125",
+          "1.00000000000000011102230246251565404236316680908203124",
+          "1.00000000000000011102230246251565404236316680908203126",
+          "inf",
+          "-Infinity",
+          "INFINITY",
+          "infinit",
+          "nan",
+          "-NaN",
+          "nan(123)",
+          "1e0000000000000000000001",
+          "1e-0000000000000000000001",
+          "0e999999999999",
+          "1e999999999999",
+          "1e-999999999999",
+          "00000000000000000000000000000001.5",
+    };
+    for(const std::string& text : cases) {
+        INFO(text);
+        REQUIRE(MatchesStrtod(text));
+    }
+}
+
+TEST_CASE("Parse Real Numbers Matches Strtod On Random Input") {
+    std::mt19937_64 random(7);
+
+    for(u64 i = 0; i < 20000; i++) {
+        // Random bit patterns printed with enough digits to round trip, and with a few too few or too many
+        double original = std::bit_cast<double>(random());
+        if(!std::isfinite(original)) {
+            continue;
+        }
+        char buffer[64];
+        int precision = static_cast<int>(random() % 25) + 1;
+        std::snprintf(buffer, sizeof(buffer), "%.*g", precision, original);
+
+        INFO(buffer);
+        REQUIRE(MatchesStrtod(buffer));
+    }
+
+    for(u64 i = 0; i < 20000; i++) {
+        // Random digit strings, which often have more digits than fit in 64 bits
+        std::string text = random() % 2 == 0 ? "-" : "";
+        u64 digits       = random() % 30 + 1;
+        for(u64 d = 0; d < digits; d++) {
+            text += static_cast<char>('0' + random() % 10);
+        }
+        if(random() % 2 == 0) {
+            text.insert(text.size() - random() % text.size(), ".");
+        }
+        if(random() % 2 == 0) {
+            text += "e" + std::to_string(static_cast<int>(random() % 700) - 350);
+        }
+
+        INFO(text);
+        REQUIRE(MatchesStrtod(text));
+    }
+}
+
+TEST_CASE("Parse Floats In A Batch") {
+    float values[4] = {};
+
+    String::BatchParseResult result = String::ParseFloats("  1.5 -2\t3e2  ", Core::Span<float>(values, 4));
+    REQUIRE(result.count == 3);
+    REQUIRE(result.length == 12);
+    REQUIRE(values[0] == 1.5f);
+    REQUIRE(values[1] == -2.0f);
+    REQUIRE(values[2] == 300.0f);
+
+    result = String::ParseFloats("1 2 3 4 5", Core::Span<float>(values, 2));
+    REQUIRE(result.count == 2);
+    REQUIRE(result.length == 3);
+
+    result = String::ParseFloats("0.5 x 6", Core::Span<float>(values, 4));
+    REQUIRE(result.count == 1);
+    REQUIRE(result.length == 3);
+
+    REQUIRE(String::ParseFloats("", Core::Span<float>(values, 4)).count == 0);
+
+    double doubles[2] = {};
+    result            = String::ParseDoubles("0.1 0.2", Core::Span<double>(doubles, 2));
+    REQUIRE(result.count == 2);
+    REQUIRE(doubles[0] == 0.1);
+    REQUIRE(doubles[1] == 0.2);
+}
+
+TEST_CASE("Parse Index Triplets") {
+    String::IndexTriplet triplets[8];
+
+    std::string_view text           = " 1 2/3 4//5 6/7/8 -9/-10/-11 123456789/1234567890123/0";
+    String::BatchParseResult result = String::ParseIndexTriplets(text, Core::Span<String::IndexTriplet>(triplets, 8));
+    REQUIRE(result.count == 6);
+    REQUIRE(result.length == text.size());
+
+    auto same = [](const String::IndexTriplet& triplet, int64_t first, int64_t second, int64_t third) {
+        return triplet.first == first && triplet.second == second && triplet.third == third;
+    };
+    REQUIRE(same(triplets[0], 1, 0, 0));
+    REQUIRE(same(triplets[1], 2, 3, 0));
+    REQUIRE(same(triplets[2], 4, 0, 5));
+    REQUIRE(same(triplets[3], 6, 7, 8));
+    REQUIRE(same(triplets[4], -9, -10, -11));
+    REQUIRE(same(triplets[5], 123456789, 1234567890123, 0));
+
+    result = String::ParseIndexTriplets("1/2/3 4/5/6", Core::Span<String::IndexTriplet>(triplets, 1));
+    REQUIRE(result.count == 1);
+    REQUIRE(result.length == 5);
+
+    REQUIRE(String::ParseIndexTriplets("1/2/3/4", Core::Span<String::IndexTriplet>(triplets, 8)).count == 0);
+    REQUIRE(String::ParseIndexTriplets("1 x", Core::Span<String::IndexTriplet>(triplets, 8)).count == 1);
+    REQUIRE(String::ParseIndexTriplets("/1", Core::Span<String::IndexTriplet>(triplets, 8)).count == 0);
+}
+
+TEST_CASE("Parse Index Triplets Matches Parsing Each Number") {
+    std::mt19937_64 random(11);
+
+    for(u64 i = 0; i < 10000; i++) {
+        std::vector<String::IndexTriplet> expected(random() % 6 + 1);
+        std::string text;
+        for(String::IndexTriplet& triplet : expected) {
+            // Anything from one digit to more than fit in a word
+            u64 magnitude = 1;
+            for(u64 digits = random() % 12; digits > 0; digits--) {
+                magnitude *= 10;
+            }
+
+            triplet.first  = static_cast<int64_t>(random() % magnitude) + 1;
+            triplet.second = random() % 2 == 0 ? 0 : -static_cast<int64_t>(random() % 1000) - 1;
+            triplet.third  = static_cast<int64_t>(random() % 100000);
+
+            text += std::string(random() % 3 + 1, ' ') + std::to_string(triplet.first) + "/";
+            text += (triplet.second != 0 ? std::to_string(triplet.second) : "") + "/" + std::to_string(triplet.third);
+        }
+
+        String::IndexTriplet triplets[6];
+        String::BatchParseResult result =
+              String::ParseIndexTriplets(text, Core::Span<String::IndexTriplet>(triplets, 6));
+
+        INFO(text);
+        REQUIRE(result.count == expected.size());
+        REQUIRE(result.length == text.size());
+        for(u64 t = 0; t < expected.size(); t++) {
+            REQUIRE(triplets[t].first == expected[t].first);
+            REQUIRE(triplets[t].second == expected[t].second);
+            REQUIRE(triplets[t].third == expected[t].third);
+        }
+    }
+}
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "core/Types.h"
+#include "core/algorithms/Memory.h"
 #include "core/assert/Assert.h"
+#include "core/memory/Allocator.h"
 
 #include "core/io/serialization/InputStream.h"
 #include "core/io/serialization/OutputStream.h"
@@ -17,26 +19,37 @@ namespace Core {
 template <typename T, u64 SIZE>
 using FixedArray = std::array<T, SIZE>;
 
-template <typename T>
+// A growable array. Memory comes from ALLOCATOR, which is copied along with the array and carried over when it is
+// moved. Copy assignment keeps the allocator of the array being assigned to.
+//
+// Elements that are trivially relocatable (see Core::IsTriviallyRelocatable) are moved around as raw bytes, and when
+// the allocator can reallocate the array grows in place where possible instead of copying into a new block.
+template <typename T, typename ALLOCATOR = Core::Memory::MallocAllocator>
 class Array {
 public:
+    static_assert(Core::Memory::Allocator<ALLOCATOR>);
+
     constexpr static u64 MinimumCapacity = 4;
     constexpr static u64 ElementSize     = sizeof(T);
     constexpr static f32 GrowthFactor    = 1.5f;
 
-    using ElementType = T;
+    using ElementType   = T;
+    using AllocatorType = ALLOCATOR;
 
     explicit Array(u64 initialCapacity = 4);
+    explicit Array(const ALLOCATOR& allocator);
+    Array(u64 initialCapacity, const ALLOCATOR& allocator);
 
     explicit Array(Core::Span<T> elementsToCopy);
+    Array(Core::Span<T> elementsToCopy, const ALLOCATOR& allocator);
 
     Array(const T& original, u64 repeatCount);
     Array(std::initializer_list<T> initializerList);
-    Array(const Array<T>& other);
-    Array(Array<T>&& other);
+    Array(const Array& other);
+    Array(Array&& other);
 
-    Array<T>& operator=(const Array<T>& other);
-    Array<T>& operator=(Array<T>&& other);
+    Array& operator=(const Array& other);
+    Array& operator=(Array&& other);
 
     ~Array();
 
@@ -62,6 +75,9 @@ public:
 
     void eraseAt(u64 index, u64 elementsToErase = 1);
 
+    // Removes an element by moving the last element into its place, so it doesn't keep the order of the elements
+    void swapErase(u64 index);
+
     void clear();
 
     [[nodiscard]] u64 count() const;
@@ -77,7 +93,12 @@ public:
 
     void ensureCapacity(u64 requiredCapacity);
 
+    [[nodiscard]] const ALLOCATOR& allocator() const;
+
 protected:
+    [[nodiscard]] T* allocateElements(u64 elementCount);
+    void deallocateElements(T* elements, u64 elementCount);
+
     void destructAllElements();
 
     static void CopyElementMemory(T* destination, const T* source, u64 elementCount);
@@ -89,15 +110,20 @@ protected:
     u64 capacity;
     u64 elementCount = 0;
     T* data          = nullptr;
+    CORE_NO_UNIQUE_ADDRESS ALLOCATOR allocatorInstance;
 };
 
-template <typename T>
-Core::Span<T> ToSpan(Core::Array<T>& array) {
+// An Array only points at its elements, so it can be relocated whenever its allocator can
+template <typename T, typename ALLOCATOR>
+constexpr bool IsTriviallyRelocatable<Core::Array<T, ALLOCATOR>> = IsTriviallyRelocatable<ALLOCATOR>;
+
+template <typename T, typename ALLOCATOR>
+Core::Span<T> ToSpan(Core::Array<T, ALLOCATOR>& array) {
     return Core::Span<T>(array.rawData(), array.count());
 }
 
-template <typename T>
-Core::Span<const T> ToSpan(const Core::Array<T>& array) {
+template <typename T, typename ALLOCATOR>
+Core::Span<const T> ToSpan(const Core::Array<T, ALLOCATOR>& array) {
     return Core::Span<const T>(array.rawData(), array.count());
 }
 
@@ -111,13 +137,13 @@ Core::Span<const T> ToSpan(const Core::FixedArray<T, SIZE>& array) {
     return Core::Span<T>(array.data(), SIZE);
 }
 
-template <typename T>
-Core::Span<std::byte> AsBytes(Core::Array<T>& array) requires std::is_trivially_copyable_v<T> {
+template <typename T, typename ALLOCATOR>
+Core::Span<std::byte> AsBytes(Core::Array<T, ALLOCATOR>& array) requires std::is_trivially_copyable_v<T> {
     return Core::AsWritableBytes(ToSpan(array));
 }
 
-template <typename T>
-Core::Span<const std::byte> AsBytes(const Core::Array<T>& array) requires std::is_trivially_copyable_v<T> {
+template <typename T, typename ALLOCATOR>
+Core::Span<const std::byte> AsBytes(const Core::Array<T, ALLOCATOR>& array) requires std::is_trivially_copyable_v<T> {
     return Core::AsBytes(ToSpan(array));
 }
 
@@ -135,9 +161,9 @@ Core::Span<const std::byte> AsBytes(const Core::FixedArray<T, SIZE>& array) requ
 
 namespace Core::IO {
 
-template <typename T>
-struct Serializer<Core::Array<T>> {
-    static void serialize(OutputStream& stream, const Core::Array<T>& values) {
+template <typename T, typename ALLOCATOR>
+struct Serializer<Core::Array<T, ALLOCATOR>> {
+    static void serialize(OutputStream& stream, const Core::Array<T, ALLOCATOR>& values) {
         stream.write(values.count());
         if constexpr(BinarySerializable<T>) {
             stream.write(Core::AsBytes(Core::ToSpan(values)));
@@ -163,11 +189,11 @@ struct Serializer<Core::FixedArray<T, SIZE>> {
     }
 };
 
-template <typename T>
-struct Deserializer<Core::Array<T>> {
-    static Core::Array<T> deserialize(InputStream& stream) {
+template <typename T, typename ALLOCATOR>
+struct Deserializer<Core::Array<T, ALLOCATOR>> {
+    static Core::Array<T, ALLOCATOR> deserialize(InputStream& stream) {
         u64 elementCount = stream.read<u64>();
-        Core::Array<T> value;
+        Core::Array<T, ALLOCATOR> value(elementCount);
 
         if constexpr(BinarySerializable<T>) {
             stream.readInto<T>(value.insertUninitialized(elementCount));
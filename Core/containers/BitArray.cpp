@@ -0,0 +1,225 @@
+#include "core/containers/BitArray.h"
+
+#include <algorithm>
+#include <bit>
+
+#if CORE_BIT_ARRAY_AVX2
+#include <immintrin.h>
+#endif
+
+namespace {
+using Word = Core::BitArray::WordType;
+
+enum class Operation { And, Or, Xor, AndNot };
+
+template <Operation OPERATION>
+Word CombineWord(Word target, Word source) {
+    if constexpr(OPERATION == Operation::And) {
+        return target & source;
+    } else if constexpr(OPERATION == Operation::Or) {
+        return target | source;
+    } else if constexpr(OPERATION == Operation::Xor) {
+        return target ^ source;
+    } else {
+        return target & ~source;
+    }
+}
+
+#if CORE_BIT_ARRAY_AVX2
+template <Operation OPERATION>
+__m256i CombineVector(__m256i target, __m256i source) {
+    if constexpr(OPERATION == Operation::And) {
+        return _mm256_and_si256(target, source);
+    } else if constexpr(OPERATION == Operation::Or) {
+        return _mm256_or_si256(target, source);
+    } else if constexpr(OPERATION == Operation::Xor) {
+        return _mm256_xor_si256(target, source);
+    } else {
+        return _mm256_andnot_si256(source, target);
+    }
+}
+#endif
+
+template <Operation OPERATION>
+void CombineWords(Word* target, const Word* source, u64 wordCount) {
+    u64 i = 0;
+
+#if CORE_BIT_ARRAY_AVX2
+    for(; i + 4 <= wordCount; i += 4) {
+        __m256i targetWords = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(target + i));
+        __m256i sourceWords = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(target + i),
+                            CombineVector<OPERATION>(targetWords, sourceWords));
+    }
+#endif
+
+    for(; i < wordCount; i++) {
+        target[i] = CombineWord<OPERATION>(target[i], source[i]);
+    }
+}
+
+u64 CountSetBits(const Word* words, u64 wordCount) {
+    u64 total = 0;
+    u64 i     = 0;
+
+#if CORE_BIT_ARRAY_AVX2
+    // Looks up the number of set bits in each nibble with a byte shuffle, then sums the bytes of each 64 bit lane
+    const __m256i nibbleCounts = _mm256_setr_epi8(
+          0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i lowNibbles = _mm256_set1_epi8(0x0F);
+
+    __m256i laneTotals = _mm256_setzero_si256();
+    for(; i + 4 <= wordCount; i += 4) {
+        __m256i vector     = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + i));
+        __m256i low        = _mm256_and_si256(vector, lowNibbles);
+        __m256i high       = _mm256_and_si256(_mm256_srli_epi16(vector, 4), lowNibbles);
+        __m256i byteCounts = _mm256_add_epi8(_mm256_shuffle_epi8(nibbleCounts, low),
+                                             _mm256_shuffle_epi8(nibbleCounts, high));
+        laneTotals         = _mm256_add_epi64(laneTotals, _mm256_sad_epu8(byteCounts, _mm256_setzero_si256()));
+    }
+
+    total += static_cast<u64>(_mm256_extract_epi64(laneTotals, 0)) +
+             static_cast<u64>(_mm256_extract_epi64(laneTotals, 1)) +
+             static_cast<u64>(_mm256_extract_epi64(laneTotals, 2)) +
+             static_cast<u64>(_mm256_extract_epi64(laneTotals, 3));
+#endif
+
+    for(; i < wordCount; i++) {
+        total += static_cast<u64>(std::popcount(words[i]));
+    }
+
+    return total;
+}
+
+// The index of the first word at or after start that has any bit set, or wordCount
+u64 FindNonZeroWord(const Word* words, u64 start, u64 wordCount) {
+    u64 i = start;
+
+#if CORE_BIT_ARRAY_AVX2
+    for(; i + 4 <= wordCount; i += 4) {
+        __m256i vector = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + i));
+        if(!_mm256_testz_si256(vector, vector)) {
+            break;
+        }
+    }
+#endif
+
+    for(; i < wordCount; i++) {
+        if(words[i] != 0) {
+            return i;
+        }
+    }
+
+    return wordCount;
+}
+}    // namespace
+
+namespace Core {
+
+BitArray::BitArray(u64 initialBitCount, bool value) : wordStorage(WordsFor(initialBitCount)) {
+    resize(initialBitCount, value);
+}
+
+void BitArray::setAll() {
+    std::fill(wordStorage.begin(), wordStorage.end(), ~WordType(0));
+    clearUnusedBits();
+}
+
+void BitArray::resetAll() {
+    std::fill(wordStorage.begin(), wordStorage.end(), WordType(0));
+}
+
+void BitArray::resize(u64 newBitCount, bool value) {
+    u64 oldWordCount = wordStorage.count();
+    u64 newWordCount = WordsFor(newBitCount);
+
+    // The bits of the old last word past the old count are zero, so they only need filling in when adding ones
+    if(value && newBitCount > bitCount && bitCount % BitsPerWord != 0) {
+        wordStorage[bitCount / BitsPerWord] |= ~WordType(0) << (bitCount % BitsPerWord);
+    }
+
+    if(newWordCount > oldWordCount) {
+        Core::Span<WordType> newWords = wordStorage.insertUninitialized(newWordCount - oldWordCount);
+        std::fill(newWords.begin(), newWords.end(), value ? ~WordType(0) : WordType(0));
+    } else if(newWordCount < oldWordCount) {
+        wordStorage.eraseAt(newWordCount, oldWordCount - newWordCount);
+    }
+
+    bitCount = newBitCount;
+    clearUnusedBits();
+}
+
+void BitArray::clear() {
+    wordStorage.clear();
+    bitCount = 0;
+}
+
+BitArray& BitArray::operator&=(const BitArray& other) {
+    ASSERT_WITH_MESSAGE(bitCount == other.bitCount, "Counts differ: {} and {}", bitCount, other.bitCount);
+    CombineWords<Operation::And>(wordStorage.rawData(), other.wordStorage.rawData(), wordStorage.count());
+    return *this;
+}
+
+BitArray& BitArray::operator|=(const BitArray& other) {
+    ASSERT_WITH_MESSAGE(bitCount == other.bitCount, "Counts differ: {} and {}", bitCount, other.bitCount);
+    CombineWords<Operation::Or>(wordStorage.rawData(), other.wordStorage.rawData(), wordStorage.count());
+    return *this;
+}
+
+BitArray& BitArray::operator^=(const BitArray& other) {
+    ASSERT_WITH_MESSAGE(bitCount == other.bitCount, "Counts differ: {} and {}", bitCount, other.bitCount);
+    CombineWords<Operation::Xor>(wordStorage.rawData(), other.wordStorage.rawData(), wordStorage.count());
+    return *this;
+}
+
+BitArray& BitArray::andNot(const BitArray& other) {
+    ASSERT_WITH_MESSAGE(bitCount == other.bitCount, "Counts differ: {} and {}", bitCount, other.bitCount);
+    CombineWords<Operation::AndNot>(wordStorage.rawData(), other.wordStorage.rawData(), wordStorage.count());
+    return *this;
+}
+
+u64 BitArray::countSet() const {
+    return CountSetBits(wordStorage.rawData(), wordStorage.count());
+}
+
+bool BitArray::any() const {
+    return FindNonZeroWord(wordStorage.rawData(), 0, wordStorage.count()) != wordStorage.count();
+}
+
+bool BitArray::none() const {
+    return !any();
+}
+
+u64 BitArray::findNextSet(u64 start) const {
+    if(start >= bitCount) {
+        return NotFound;
+    }
+
+    u64 wordIndex = start / BitsPerWord;
+    WordType word = wordStorage[wordIndex] & (~WordType(0) << (start % BitsPerWord));
+    if(word == 0) {
+        wordIndex = FindNonZeroWord(wordStorage.rawData(), wordIndex + 1, wordStorage.count());
+        if(wordIndex == wordStorage.count()) {
+            return NotFound;
+        }
+        word = wordStorage[wordIndex];
+    }
+
+    return wordIndex * BitsPerWord + static_cast<u64>(std::countr_zero(word));
+}
+
+u64 BitArray::findFirstSet() const {
+    return findNextSet(0);
+}
+
+bool BitArray::operator==(const BitArray& other) const {
+    return bitCount == other.bitCount && std::equal(wordStorage.begin(), wordStorage.end(), other.wordStorage.begin());
+}
+
+void BitArray::clearUnusedBits() {
+    if(bitCount % BitsPerWord != 0) {
+        wordStorage[bitCount / BitsPerWord] &= ~(~WordType(0) << (bitCount % BitsPerWord));
+    }
+}
+
+}    // namespace Core
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "core/Types.h"
+#include "core/assert/Assert.h"
+#include "core/containers/Array.h"
+#include "core/containers/Span.h"
+
+#include "core/io/serialization/InputStream.h"
+#include "core/io/serialization/OutputStream.h"
+
+#include <limits>
+
+// The AVX2 paths are only built when the compiler is allowed to use AVX2 (/arch:AVX2 or -mavx2). Otherwise the same
+// operations run one 64 bit word at a time, which compilers vectorize with whatever instructions they may use.
+#if defined(__AVX2__)
+#define CORE_BIT_ARRAY_AVX2 1
+#else
+#define CORE_BIT_ARRAY_AVX2 0
+#endif
+
+namespace Core {
+
+// A growable array of bits packed 64 to a word, for flags such as culling results, dirty masks or residency. Whole
+// arrays are combined a word (or with AVX2, four words) at a time, and set bits are found by skipping zero words and
+// counting trailing zeros rather than testing bits one by one.
+//
+// Bits past count() in the last word are always zero, so counting and comparing never have to mask them out.
+class BitArray {
+public:
+    using WordType = u64;
+
+    constexpr static u64 BitsPerWord = 64;
+    constexpr static u64 NotFound    = std::numeric_limits<u64>::max();
+
+    BitArray() = default;
+    explicit BitArray(u64 initialBitCount, bool value = false);
+
+    [[nodiscard]] bool operator[](u64 index) const;
+    [[nodiscard]] bool test(u64 index) const;
+
+    void set(u64 index);
+    void set(u64 index, bool value);
+    void reset(u64 index);
+    void toggle(u64 index);
+
+    void setAll();
+    void resetAll();
+
+    // New bits take value, bits past the new count are dropped
+    void resize(u64 newBitCount, bool value = false);
+    void clear();
+
+    // These combine two arrays bit by bit and need both to have the same count
+    BitArray& operator&=(const BitArray& other);
+    BitArray& operator|=(const BitArray& other);
+    BitArray& operator^=(const BitArray& other);
+
+    // Clears every bit that is set in other
+    BitArray& andNot(const BitArray& other);
+
+    [[nodiscard]] u64 countSet() const;
+    [[nodiscard]] bool any() const;
+    [[nodiscard]] bool none() const;
+
+    // The index of the first set bit at or after start, or NotFound
+    [[nodiscard]] u64 findNextSet(u64 start) const;
+    [[nodiscard]] u64 findFirstSet() const;
+
+    // Calls visitor with the index of every set bit, in increasing order
+    template <typename VISITOR>
+    void forEachSetBit(VISITOR&& visitor) const;
+
+    [[nodiscard]] u64 count() const;
+    [[nodiscard]] bool isEmpty() const;
+
+    [[nodiscard]] Core::Span<const WordType> words() const;
+
+    bool operator==(const BitArray& other) const;
+
+private:
+    friend struct Core::IO::Deserializer<BitArray>;
+
+    [[nodiscard]] static u64 WordsFor(u64 bitCount);
+
+    // Zeroes the bits of the last word that are past bitCount
+    void clearUnusedBits();
+
+    Core::Array<WordType> wordStorage;
+    u64 bitCount = 0;
+};
+
+}    // namespace Core
+
+namespace Core::IO {
+
+template <>
+struct Serializer<Core::BitArray> {
+    static void serialize(OutputStream& stream, const Core::BitArray& bits) {
+        stream.write(bits.count());
+        stream.write(Core::AsBytes(bits.words()));
+    }
+};
+
+template <>
+struct Deserializer<Core::BitArray> {
+    static Core::BitArray deserialize(InputStream& stream) {
+        Core::BitArray bits(stream.read<u64>());
+        stream.readInto<u64>(Core::ToSpan(bits.wordStorage));
+        bits.clearUnusedBits();
+        return bits;
+    }
+};
+
+}    // namespace Core::IO
+
+#include "core/containers/internal/BitArray.inl"
@@ -0,0 +1,186 @@
+#pragma once
+
+#include "core/Types.h"
+#include "core/assert/Assert.h"
+#include "core/memory/Allocator.h"
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+namespace Core {
+
+// An unordered container whose elements never move: a pointer or reference to an element stays valid until that
+// element is erased, however many elements are inserted or erased around it. Use it for resource or entity like data
+// that other objects point at directly instead of going through a handle.
+//
+// Elements live in a list of blocks whose capacities are powers of two, doubling from FirstBlockCapacity up to
+// MaxBlockCapacity. Erasing leaves a hole that a skipfield records, so erasing is constant time and iteration jumps
+// over runs of holes in a single step. Later insertions fill the holes before any new block is allocated, and a block
+// is freed as soon as its last element is erased. Blocks come from ALLOCATOR, which is handled the same way as for
+// Core::Array.
+template <typename T, typename ALLOCATOR = Core::Memory::MallocAllocator>
+class Colony {
+    struct Block;
+
+public:
+    static_assert(Core::Memory::Allocator<ALLOCATOR>);
+
+    using AllocatorType = ALLOCATOR;
+
+    using SkipType = u16;
+
+    constexpr static u64 FirstBlockCapacity = 8;
+    constexpr static u64 MaxBlockCapacity   = 8192;
+
+    static_assert(MaxBlockCapacity < std::numeric_limits<SkipType>::max(), "Skipfield entries can't hold a block size");
+    static_assert(alignof(T) <= alignof(std::max_align_t), "Over aligned element types are not supported");
+
+    template <typename ELEMENT>
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = ELEMENT*;
+        using reference         = ELEMENT&;
+
+        Iterator() = default;
+
+        // Allows converting an iterator to a const_iterator
+        template <typename OTHER>
+        Iterator(const Iterator<OTHER>& other)
+            requires(std::is_same_v<const OTHER, ELEMENT> && !std::is_const_v<OTHER>);
+
+        [[nodiscard]] ELEMENT& operator*() const;
+        [[nodiscard]] ELEMENT* operator->() const;
+
+        Iterator& operator++();
+        Iterator operator++(int);
+
+        bool operator==(const Iterator& other) const = default;
+
+    private:
+        friend class Colony;
+        template <typename OTHER>
+        friend class Iterator;
+
+        Iterator(Block* block, SkipType index);
+
+        Block* block   = nullptr;
+        SkipType index = 0;
+    };
+
+    using iterator       = Iterator<T>;
+    using const_iterator = Iterator<const T>;
+
+    Colony() = default;
+    explicit Colony(const ALLOCATOR& allocator);
+    Colony(const Colony& other);
+    Colony(Colony&& other);
+
+    Colony& operator=(const Colony& other);
+    Colony& operator=(Colony&& other);
+
+    ~Colony();
+
+    // The returned reference stays valid until the element is erased
+    template <typename... ARGS>
+    T& emplace(ARGS&&... args);
+
+    T& insert(const T& element);
+    T& insert(T&& element);
+
+    // Returns an iterator to the element after the erased one
+    iterator erase(const_iterator position);
+
+    // Finds the block holding element first, so this takes time proportional to the number of blocks
+    void erase(const T* element);
+
+    // The iterator for an element of this colony, found by searching the blocks for the one holding it
+    [[nodiscard]] iterator iteratorTo(const T* element);
+
+    void clear();
+
+    [[nodiscard]] u64 count() const;
+    [[nodiscard]] bool isEmpty() const;
+
+    [[nodiscard]] iterator begin();
+    [[nodiscard]] const_iterator begin() const;
+    [[nodiscard]] iterator end();
+    [[nodiscard]] const_iterator end() const;
+
+    [[nodiscard]] const ALLOCATOR& allocator() const;
+
+private:
+    constexpr static SkipType NoFreeRun = std::numeric_limits<SkipType>::max();
+
+    // The links of a run of holes in its block's list of free runs. They are kept in the storage of the first hole of
+    // the run, as that slot holds no element.
+    struct FreeRun {
+        SkipType previous;
+        SkipType next;
+    };
+
+    union Slot {
+        Slot() {}
+        ~Slot() {}
+
+        T element;
+        FreeRun freeRun;
+    };
+
+    // The header of a block, followed by its slots and then its skipfield in the same allocation.
+    //
+    // skipfield[i] is 0 if slot i holds an element. The first and last slot of each run of holes both hold the length
+    // of the run, so stepping forwards from a hole at the start of a run skips the whole run at once. The values in the
+    // middle of a run are never read. There is one more skipfield entry than there are slots, which is always 0.
+    struct Block {
+        Block* next              = nullptr;
+        Block* previous          = nullptr;
+        Block* nextWithHoles     = nullptr;
+        Block* previousWithHoles = nullptr;
+
+        Slot* slots         = nullptr;
+        SkipType* skipfield = nullptr;
+
+        SkipType capacity     = 0;
+        SkipType highWater    = 0;    // Slots past this have never held an element
+        SkipType liveCount    = 0;
+        SkipType firstFreeRun = NoFreeRun;
+    };
+
+    // Where the slots and the skipfield start in the allocation of a block, and how large that allocation is
+    constexpr static u64 SlotsOffset = (sizeof(Block) + alignof(Slot) - 1) & ~(alignof(Slot) - 1);
+    [[nodiscard]] static u64 SkipfieldOffset(u64 capacity);
+    [[nodiscard]] static u64 BlockSize(u64 capacity);
+
+    [[nodiscard]] Block* allocateBlock(u64 capacity);
+    void freeBlock(Block* block);
+
+    // Finds a slot for a new element, which is either the first hole of a block with holes, the next unused slot of
+    // the last block or the first slot of a new block
+    [[nodiscard]] Slot* claimSlot();
+
+    void addRun(Block* block, SkipType start);
+    void removeRun(Block* block, SkipType start);
+    void moveRunStart(Block* block, SkipType oldStart, SkipType newStart);
+
+    // Takes a block out of the list of all blocks and, if it has holes, the list of blocks with holes
+    void unlinkBlock(Block* block);
+    void unlinkBlockWithHoles(Block* block);
+
+    void copyElementsFrom(const Colony& other);
+    void releaseBlocks();
+
+    Block* firstBlock         = nullptr;
+    Block* lastBlock          = nullptr;
+    Block* firstBlockWithHole = nullptr;
+    u64 elementCount          = 0;
+    CORE_NO_UNIQUE_ADDRESS ALLOCATOR allocatorInstance;
+};
+
+}    // namespace Core
+
+#include "core/containers/internal/Colony.inl"
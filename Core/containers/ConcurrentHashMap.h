@@ -0,0 +1,91 @@
+#pragma once
+
+#include "core/Types.h"
+#include "core/containers/HashMap.h"
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+
+namespace Core {
+
+// A hash map that many threads can use at once. Keys are spread over a power of two number of shards, each a HashMap
+// behind its own reader-writer lock, so threads only wait for each other when they touch the same shard and lookups
+// only wait for writers.
+//
+// Nothing hands out references into the map, as they would outlive the lock that protects them. Lookups return copies,
+// and visit and upsert run a callback on the value while its shard is locked. Callbacks must not use the map again, as
+// the shard locks are not reentrant.
+template <typename KEY, typename VALUE, typename HASHER = std::hash<KEY>, typename EQUALITY = std::equal_to<KEY>>
+class ConcurrentHashMap {
+public:
+    constexpr static u64 DefaultShardCount = 32;
+
+    using key_type    = KEY;
+    using mapped_type = VALUE;
+
+    // shardCount is rounded up to a power of two
+    explicit ConcurrentHashMap(u64 shardCount = DefaultShardCount);
+
+    ConcurrentHashMap(const ConcurrentHashMap&)            = delete;
+    ConcurrentHashMap& operator=(const ConcurrentHashMap&) = delete;
+
+    // Returns the value for key, first inserting the result of create() if the key is missing. create is called at
+    // most once, and only by the thread whose value ends up in the map.
+    template <typename FACTORY>
+    VALUE getOrInsert(const KEY& key, FACTORY&& create);
+
+    [[nodiscard]] std::optional<VALUE> find(const KEY& key) const;
+    [[nodiscard]] bool contains(const KEY& key) const;
+
+    // Calls visitor with the value for key while holding a shared lock. Returns false if the key is missing.
+    template <typename VISITOR>
+    bool visit(const KEY& key, VISITOR&& visitor) const;
+
+    // Calls modifier with the value for key while holding an exclusive lock, default constructing the value first if
+    // the key is missing
+    template <typename MODIFIER>
+    void upsert(const KEY& key, MODIFIER&& modifier);
+
+    // Returns false, leaving the map unchanged, if the key is already present
+    bool insert(const KEY& key, VALUE value);
+    void insertOrAssign(const KEY& key, VALUE value);
+
+    bool erase(const KEY& key);
+    // Erases key and returns the value it had, or nothing if it was missing
+    std::optional<VALUE> extract(const KEY& key);
+    void clear();
+
+    // Calls visitor with each key and value, locking one shard at a time, so it does not see a single snapshot of the
+    // whole map
+    template <typename VISITOR>
+    void forEach(VISITOR&& visitor) const;
+
+    // Locks every shard in turn, so the result may be out of date as soon as it is returned
+    [[nodiscard]] u64 size() const;
+    [[nodiscard]] bool empty() const;
+
+    [[nodiscard]] u64 shardCount() const;
+
+private:
+    using Map = Core::HashMap<KEY, VALUE, HASHER, EQUALITY>;
+
+    // Each shard gets its own cache lines so that threads locking neighbouring shards don't slow each other down
+    struct alignas(CacheLineSize) Shard {
+        mutable std::shared_mutex lock;
+        Map map;
+    };
+
+    [[nodiscard]] Shard& shardFor(const KEY& key);
+    [[nodiscard]] const Shard& shardFor(const KEY& key) const;
+
+    std::unique_ptr<Shard[]> shards;
+    u64 shardMask;
+
+    CORE_NO_UNIQUE_ADDRESS HASHER hasherInstance;
+};
+
+}    // namespace Core
+
+#include "core/containers/internal/ConcurrentHashMap.inl"
@@ -1,15 +1,282 @@
 #pragma once
 
-#include <unordered_map>
+#include "core/Types.h"
+#include "core/assert/Assert.h"
 
 #include "core/io/serialization/InputStream.h"
 #include "core/io/serialization/OutputStream.h"
 
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define CORE_HASH_MAP_SSE2 1
+#include <emmintrin.h>
+#else
+#define CORE_HASH_MAP_SSE2 0
+#endif
+
 namespace Core {
-template <typename KEY, typename VALUE>
-using HashMap = std::unordered_map<KEY, VALUE>;
+
+namespace internal::HashTable {
+
+// Each slot in the table has a matching control byte. Full slots store the low 7 bits of the key's hash (H2) so that a
+// whole group of slots can be filtered with a single comparison before any keys are touched.
+using ControlByte = i8;
+
+constexpr ControlByte Empty    = -128;    // 0b10000000
+constexpr ControlByte Deleted  = -2;      // 0b11111110
+constexpr ControlByte Sentinel = -1;      // 0b11111111
+
+constexpr bool IsFull(ControlByte control) {
+    return control >= 0;
+}
+
+constexpr bool IsEmptyOrDeleted(ControlByte control) {
+    return control < Sentinel;
 }
 
+// A set of matching slots within a group. Each match is represented by one bit (SSE2) or by the high bit of one byte
+// (portable), so SHIFT converts from a bit index to a slot index.
+template <u64 SIGNIFICANT_BITS, u64 SHIFT>
+struct GroupMask {
+    u64 mask;
+
+    explicit operator bool() const {
+        return mask != 0;
+    }
+
+    [[nodiscard]] u64 lowestMatch() const;
+    [[nodiscard]] u64 trailingZeros() const;
+    [[nodiscard]] u64 leadingZeros() const;
+
+    GroupMask& operator++();
+
+    GroupMask begin() const {
+        return *this;
+    }
+
+    GroupMask end() const {
+        return GroupMask{0};
+    }
+
+    u64 operator*() const {
+        return lowestMatch();
+    }
+
+    bool operator!=(const GroupMask& other) const {
+        return mask != other.mask;
+    }
+};
+
+#if CORE_HASH_MAP_SSE2
+struct Group {
+    constexpr static u64 Width = 16;
+    using Mask                 = GroupMask<16, 0>;
+
+    explicit Group(const ControlByte* controlBytes);
+
+    [[nodiscard]] Mask match(u8 h2) const;
+    [[nodiscard]] Mask matchEmpty() const;
+    [[nodiscard]] Mask matchEmptyOrDeleted() const;
+    [[nodiscard]] u64 countLeadingEmptyOrDeleted() const;
+
+    __m128i controls;
+};
+#else
+struct Group {
+    constexpr static u64 Width = 8;
+    using Mask                 = GroupMask<64, 3>;
+
+    explicit Group(const ControlByte* controlBytes);
+
+    [[nodiscard]] Mask match(u8 h2) const;
+    [[nodiscard]] Mask matchEmpty() const;
+    [[nodiscard]] Mask matchEmptyOrDeleted() const;
+    [[nodiscard]] u64 countLeadingEmptyOrDeleted() const;
+
+    u64 controls;
+};
+#endif
+
+// The control bytes of a table with no allocation. Lookups see an empty group and iteration stops at the sentinel.
+inline const ControlByte* EmptyGroup();
+
+// std::hash is the identity function for integers and pointers on the platforms we care about, which would put all of
+// the entropy in the bits that H2 ignores. Mixing first spreads it over the whole word.
+inline u64 MixHash(u64 hash);
+
+// The slot type lets us move keys out of the otherwise const value_type when the table is resized.
+template <typename KEY, typename VALUE>
+union Slot {
+    std::pair<const KEY, VALUE> value;
+    std::pair<KEY, VALUE> mutableValue;
+
+    Slot() {}
+    ~Slot() {}
+};
+
+}    // namespace internal::HashTable
+
+// An open addressing hash map in the style of Swiss tables. Elements are stored inline in a single allocation along
+// with one control byte per slot, and lookups probe a group of control bytes at a time using SIMD comparisons.
+//
+// Unlike std::unordered_map, references and iterators are invalidated whenever an insertion causes the table to grow.
+template <typename KEY, typename VALUE, typename HASHER = std::hash<KEY>, typename EQUALITY = std::equal_to<KEY>>
+class HashMap {
+    using ControlByte = internal::HashTable::ControlByte;
+    using Group       = internal::HashTable::Group;
+    using Slot        = internal::HashTable::Slot<KEY, VALUE>;
+
+public:
+    constexpr static u64 MinimumCapacity = Group::Width - 1;
+
+    using key_type    = KEY;
+    using mapped_type = VALUE;
+    using value_type  = std::pair<const KEY, VALUE>;
+    using size_type   = u64;
+    using hasher      = HASHER;
+    using key_equal   = EQUALITY;
+
+    template <bool IS_CONST>
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = HashMap::value_type;
+        using difference_type   = std::ptrdiff_t;
+        using reference         = std::conditional_t<IS_CONST, const value_type&, value_type&>;
+        using pointer           = std::conditional_t<IS_CONST, const value_type*, value_type*>;
+
+        Iterator() = default;
+
+        template <bool OTHER_IS_CONST, typename = std::enable_if_t<IS_CONST && !OTHER_IS_CONST>>
+        Iterator(const Iterator<OTHER_IS_CONST>& other) : control(other.control), slot(other.slot) {}
+
+        reference operator*() const {
+            return slot->value;
+        }
+
+        pointer operator->() const {
+            return &slot->value;
+        }
+
+        Iterator& operator++();
+        Iterator operator++(int);
+
+        bool operator==(const Iterator& other) const {
+            return control == other.control;
+        }
+
+        bool operator!=(const Iterator& other) const {
+            return control != other.control;
+        }
+
+    private:
+        friend class HashMap;
+
+        template <bool>
+        friend class Iterator;
+
+        Iterator(const ControlByte* control, Slot* slot);
+
+        void skipEmptyOrDeleted();
+
+        const ControlByte* control = nullptr;
+        Slot* slot                 = nullptr;
+    };
+
+    using iterator       = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    HashMap();
+    explicit HashMap(u64 initialCapacity);
+    HashMap(std::initializer_list<value_type> initializerList);
+    HashMap(const HashMap& other);
+    HashMap(HashMap&& other);
+
+    HashMap& operator=(const HashMap& other);
+    HashMap& operator=(HashMap&& other);
+
+    ~HashMap();
+
+    [[nodiscard]] VALUE& operator[](const KEY& key);
+    [[nodiscard]] VALUE& operator[](KEY&& key);
+
+    [[nodiscard]] VALUE& at(const KEY& key);
+    [[nodiscard]] const VALUE& at(const KEY& key) const;
+
+    [[nodiscard]] iterator find(const KEY& key);
+    [[nodiscard]] const_iterator find(const KEY& key) const;
+
+    [[nodiscard]] bool contains(const KEY& key) const;
+    [[nodiscard]] u64 count(const KEY& key) const;
+
+    // Constructs the value in place from args if the key is not already present. Like std::unordered_map::try_emplace,
+    // the arguments are left untouched when the key already exists.
+    template <typename K, typename... ARGS>
+    std::pair<iterator, bool> emplace(K&& key, ARGS&&... args);
+
+    std::pair<iterator, bool> insert(const value_type& value);
+    std::pair<iterator, bool> insert(value_type&& value);
+
+    template <typename V>
+    std::pair<iterator, bool> insertOrAssign(const KEY& key, V&& value);
+
+    u64 erase(const KEY& key);
+    void erase(const_iterator position);
+
+    void clear();
+    void reserve(u64 elementCount);
+
+    [[nodiscard]] u64 size() const;
+    [[nodiscard]] bool empty() const;
+    [[nodiscard]] u64 capacity() const;
+
+    [[nodiscard]] iterator begin();
+    [[nodiscard]] const_iterator begin() const;
+    [[nodiscard]] iterator end();
+    [[nodiscard]] const_iterator end() const;
+
+    bool operator==(const HashMap& other) const;
+
+private:
+    static_assert(alignof(Slot) <= alignof(std::max_align_t), "Over-aligned HashMap elements are not supported");
+
+    [[nodiscard]] u64 hash(const KEY& key) const;
+    [[nodiscard]] u64 h1(u64 hash) const;
+    [[nodiscard]] static u8 h2(u64 hash);
+
+    [[nodiscard]] u64 findIndex(const KEY& key, u64 hash) const;
+    [[nodiscard]] u64 findFirstNonFull(u64 hash) const;
+
+    // Returns the index of the key's slot and whether that slot still needs to be constructed.
+    std::pair<u64, bool> findOrPrepareInsert(const KEY& key);
+
+    void setControl(u64 index, ControlByte value);
+    void destroySlots();
+    void resize(u64 newCapacity);
+    void rehashAndGrowIfNecessary();
+
+    [[nodiscard]] static u64 CapacityForElementCount(u64 elementCount);
+    [[nodiscard]] static u64 MaximumLoad(u64 capacity);
+    [[nodiscard]] static u64 SlotOffset(u64 capacity);
+
+    ControlByte* controls = const_cast<ControlByte*>(internal::HashTable::EmptyGroup());
+    Slot* slots           = nullptr;
+    u64 elementCount      = 0;
+    u64 slotCapacity      = 0;
+    u64 growthLeft        = 0;
+
+    CORE_NO_UNIQUE_ADDRESS HASHER hasherInstance;
+    CORE_NO_UNIQUE_ADDRESS EQUALITY equalityInstance;
+};
+
+}    // namespace Core
+
 namespace Core::IO {
 template <typename KEY, typename VALUE>
 struct Serializer<Core::HashMap<KEY, VALUE>> {
@@ -25,9 +292,11 @@ struct Serializer<Core::HashMap<KEY, VALUE>> {
 template <typename KEY, typename VALUE>
 struct Deserializer<Core::HashMap<KEY, VALUE>> {
     static Core::HashMap<KEY, VALUE> deserialize(Core::IO::InputStream& stream) {
+        size_t entryCount = stream.read<size_t>();
+
         Core::HashMap<KEY, VALUE> value;
+        value.reserve(entryCount);
 
-        size_t entryCount = stream.read<size_t>();
         for(size_t i = 0; i < entryCount; i++) {
             KEY k   = stream.read<KEY>();
             VALUE v = stream.read<VALUE>();
@@ -38,3 +307,5 @@ struct Deserializer<Core::HashMap<KEY, VALUE>> {
     }
 };
 }    // namespace Core::IO
+
+#include "core/containers/internal/HashMap.inl"
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "core/Types.h"
+#include "core/assert/Assert.h"
+#include "core/containers/Span.h"
+#include "core/memory/Allocator.h"
+
+#include "core/io/serialization/InputStream.h"
+#include "core/io/serialization/OutputStream.h"
+
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+
+namespace Core {
+
+// An array with the same interface as Core::Array that stores its first INLINE_CAPACITY elements inside the object
+// itself and only allocates once it grows past that. Useful for short-lived arrays that are usually small.
+//
+// Moving an InlineArray whose elements are still inline moves each element, so it is not free like moving an Array.
+// Once it spills, memory comes from ALLOCATOR, which is handled the same way as for Core::Array.
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR = Core::Memory::MallocAllocator>
+class InlineArray {
+public:
+    static_assert(INLINE_CAPACITY > 0, "Use Core::Array for arrays without inline storage");
+    static_assert(Core::Memory::Allocator<ALLOCATOR>);
+
+    constexpr static u64 InlineCapacity  = INLINE_CAPACITY;
+    constexpr static u64 MinimumCapacity = 4;
+    constexpr static u64 ElementSize     = sizeof(T);
+    constexpr static f32 GrowthFactor    = 1.5f;
+
+    using ElementType   = T;
+    using AllocatorType = ALLOCATOR;
+
+    InlineArray();
+    explicit InlineArray(u64 initialCapacity);
+    explicit InlineArray(const ALLOCATOR& allocator);
+
+    explicit InlineArray(Core::Span<T> elementsToCopy);
+
+    InlineArray(const T& original, u64 repeatCount);
+    InlineArray(std::initializer_list<T> initializerList);
+    InlineArray(const InlineArray& other);
+    InlineArray(InlineArray&& other);
+
+    InlineArray& operator=(const InlineArray& other);
+    InlineArray& operator=(InlineArray&& other);
+
+    ~InlineArray();
+
+    [[nodiscard]] T& operator[](u64 i);
+    [[nodiscard]] const T& operator[](u64 i) const;
+
+    template <typename... ARGS>
+    T& emplaceAt(u64 index, ARGS&&... args);
+
+    template <typename... ARGS>
+    T& emplace(ARGS&&... args);
+
+    T& insertAt(u64 index, const T& elementToInsert);
+    T& insertAt(u64 index, T&& elementToInsert);
+
+    T& insert(const T& elementToInsert);
+    T& insert(T&& elementToInsert);
+
+    template <typename U>
+    Core::Span<T> insertAll(Core::Span<U> elements);
+
+    [[nodiscard]] Core::Span<T> insertUninitialized(u64 newElementCount);
+
+    void eraseAt(u64 index, u64 elementsToErase = 1);
+
+    // Removes an element by moving the last element into its place, so it doesn't keep the order of the elements
+    void swapErase(u64 index);
+
+    void clear();
+
+    [[nodiscard]] u64 count() const;
+    [[nodiscard]] u64 totalCapacity() const;
+    [[nodiscard]] u64 unusedCapacity() const;
+    [[nodiscard]] bool isEmpty() const;
+    [[nodiscard]] bool isInline() const;
+    [[nodiscard]] T* rawData();
+    [[nodiscard]] const T* rawData() const;
+    [[nodiscard]] T* begin();
+    [[nodiscard]] const T* begin() const;
+    [[nodiscard]] T* end();
+    [[nodiscard]] const T* end() const;
+
+    void ensureCapacity(u64 requiredCapacity);
+
+    [[nodiscard]] const ALLOCATOR& allocator() const;
+
+private:
+    [[nodiscard]] T* inlineData();
+
+    void destructAllElements();
+    void releaseHeapData();
+
+    // Takes the elements of other, leaving it empty and inline. This array must be empty and inline beforehand, and
+    // have a copy of the allocator of other, which a heap block it takes over is given back to.
+    void takeElementsFrom(InlineArray& other);
+
+    void shiftElementsLeft(u64 startIndex, u64 distance);
+    void shiftElementsRight(u64 startIndex, u64 distance);
+
+    alignas(T) std::byte inlineStorage[INLINE_CAPACITY * sizeof(T)];
+    u64 capacity     = INLINE_CAPACITY;
+    u64 elementCount = 0;
+    T* data          = inlineData();
+    CORE_NO_UNIQUE_ADDRESS ALLOCATOR allocatorInstance;
+};
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+Core::Span<T> ToSpan(Core::InlineArray<T, INLINE_CAPACITY, ALLOCATOR>& array) {
+    return Core::Span<T>(array.rawData(), array.count());
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+Core::Span<const T> ToSpan(const Core::InlineArray<T, INLINE_CAPACITY, ALLOCATOR>& array) {
+    return Core::Span<const T>(array.rawData(), array.count());
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+Core::Span<std::byte> AsBytes(Core::InlineArray<T, INLINE_CAPACITY, ALLOCATOR>& array) requires
+      std::is_trivially_copyable_v<T> {
+    return Core::AsWritableBytes(ToSpan(array));
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+Core::Span<const std::byte> AsBytes(const Core::InlineArray<T, INLINE_CAPACITY, ALLOCATOR>& array) requires
+      std::is_trivially_copyable_v<T> {
+    return Core::AsBytes(ToSpan(array));
+}
+
+}    // namespace Core
+
+namespace Core::IO {
+
+// Uses the same format as Core::Array, so the two can be read back as each other.
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+struct Serializer<Core::InlineArray<T, INLINE_CAPACITY, ALLOCATOR>> {
+    static void serialize(OutputStream& stream, const Core::InlineArray<T, INLINE_CAPACITY, ALLOCATOR>& values) {
+        stream.write(values.count());
+        if constexpr(BinarySerializable<T>) {
+            stream.write(Core::AsBytes(Core::ToSpan(values)));
+        } else {
+            for(const T& value : values) {
+                Serializer<T>::serialize(stream, value);
+            }
+        }
+    }
+};
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+struct Deserializer<Core::InlineArray<T, INLINE_CAPACITY, ALLOCATOR>> {
+    static Core::InlineArray<T, INLINE_CAPACITY, ALLOCATOR> deserialize(InputStream& stream) {
+        u64 elementCount = stream.read<u64>();
+        Core::InlineArray<T, INLINE_CAPACITY, ALLOCATOR> value;
+
+        if constexpr(BinarySerializable<T>) {
+            stream.readInto<T>(value.insertUninitialized(elementCount));
+        } else {
+            value.ensureCapacity(elementCount);
+            for(size_t i = 0; i < elementCount; i++) {
+                value.emplace(Deserializer<T>::deserialize(stream));
+            }
+        }
+        return value;
+    }
+};
+
+}    // namespace Core::IO
+
+#include "core/containers/internal/InlineArray.inl"
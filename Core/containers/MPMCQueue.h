@@ -0,0 +1,70 @@
+#pragma once
+
+#include "core/Types.h"
+#include "core/containers/Span.h"
+#include "core/memory/Allocator.h"
+
+#include <atomic>
+#include <cstddef>
+#include <optional>
+
+namespace Core {
+
+// A bounded, lock-free queue that any number of threads can push to and pop from at the same time. The capacity is
+// fixed at construction and rounded up to a power of two. Pushing to a full queue or popping from an empty one fails
+// instead of waiting.
+//
+// Every slot carries a sequence number that says whether it is ready to be written or read for the current trip around
+// the ring, so threads only contend on the position they claim from, and a batch claims several slots at once.
+// Elements are popped in the order their pushes claimed slots.
+template <typename T>
+class MPMCQueue {
+public:
+    explicit MPMCQueue(u64 capacity);
+    MPMCQueue(const MPMCQueue& other) = delete;
+    MPMCQueue& operator=(const MPMCQueue& other) = delete;
+    ~MPMCQueue();
+
+    template <typename... ARGS>
+    [[nodiscard]] bool tryEmplace(ARGS&&... args);
+    [[nodiscard]] bool tryPush(const T& element);
+    [[nodiscard]] bool tryPush(T&& element);
+
+    // Moves as many elements from the front of elements as there are free slots, returning how many were pushed
+    [[nodiscard]] u64 tryPushBatch(Core::Span<T> elements);
+
+    [[nodiscard]] std::optional<T> tryPop();
+
+    // Move assigns up to destination.count() elements into destination, returning how many were popped
+    [[nodiscard]] u64 tryPopBatch(Core::Span<T> destination);
+
+    [[nodiscard]] u64 capacity() const;
+
+    // Only exact when no thread is using the queue
+    [[nodiscard]] u64 approximateCount() const;
+
+private:
+    struct Slot {
+        std::atomic<u64> sequence;
+        alignas(T) std::byte storage[sizeof(T)];
+
+        [[nodiscard]] T* element() {
+            return reinterpret_cast<T*>(storage);
+        }
+    };
+
+    // Claims up to maximumCount consecutive slots starting at position, returning the first claimed position and
+    // updating maximumCount to how many were claimed. readyOffset is 0 for slots that can be written and 1 for slots
+    // that can be read.
+    [[nodiscard]] u64 claim(std::atomic<u64>& position, u64 readyOffset, u64& maximumCount);
+
+    alignas(CacheLineSize) std::atomic<u64> enqueuePosition = 0;
+    alignas(CacheLineSize) std::atomic<u64> dequeuePosition = 0;
+
+    alignas(CacheLineSize) Slot* slots = nullptr;
+    u64 mask                           = 0;
+};
+
+}    // namespace Core
+
+#include "core/containers/internal/MPMCQueue.inl"
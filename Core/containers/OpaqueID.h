@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <limits>
 #include <ostream>
 #include <type_traits>
 
@@ -8,26 +9,51 @@
 
 namespace Core {
 
+// A typed integer handle. LABEL only exists to keep IDs for different things from being mixed up.
+//
+// IDs handed out by a SlotMap pack a slot index into the low half of the value and a generation into the high half, so
+// that an ID for an erased element can be told apart from the ID of whatever reuses its slot. A default constructed ID
+// is invalid and never refers to anything.
 template <typename LABEL, typename BASE_TYPE = u64>
 class OpaqueID {
-    static_assert(std::is_integral_v<BASE_TYPE>());
+public:
+    static_assert(std::is_integral_v<BASE_TYPE> && std::is_unsigned_v<BASE_TYPE>);
 
-    explicit OpaqueID(BASE_TYPE id) : id(id) {}
+    using BaseType = BASE_TYPE;
 
-    BASE_TYPE value() const {
+    constexpr static u32 IndexBits           = sizeof(BASE_TYPE) * 8 / 2;
+    constexpr static BASE_TYPE IndexMask     = (BASE_TYPE(1) << IndexBits) - 1;
+    constexpr static BASE_TYPE MaxIndex      = IndexMask;
+    constexpr static BASE_TYPE MaxGeneration = IndexMask;
+    constexpr static BASE_TYPE InvalidValue  = std::numeric_limits<BASE_TYPE>::max();
+
+    constexpr OpaqueID() = default;
+    constexpr explicit OpaqueID(BASE_TYPE id) : id(id) {}
+
+    [[nodiscard]] constexpr static OpaqueID FromIndexAndGeneration(BASE_TYPE index, BASE_TYPE generation) {
+        return OpaqueID(static_cast<BASE_TYPE>((generation << IndexBits) | (index & IndexMask)));
+    }
+
+    [[nodiscard]] constexpr BASE_TYPE value() const {
         return id;
     }
 
-    bool operator==(const OpaqueID<LABEL, BASE_TYPE>& other) const {
-        return other.id == id;
+    [[nodiscard]] constexpr BASE_TYPE index() const {
+        return id & IndexMask;
     }
 
-    bool operator!=(const OpaqueID<LABEL, BASE_TYPE>& other) const {
-        return !(*this == other);
+    [[nodiscard]] constexpr BASE_TYPE generation() const {
+        return id >> IndexBits;
     }
 
+    [[nodiscard]] constexpr bool isValid() const {
+        return id != InvalidValue;
+    }
+
+    constexpr bool operator==(const OpaqueID<LABEL, BASE_TYPE>& other) const = default;
+
 private:
-    BASE_TYPE id;
+    BASE_TYPE id = InvalidValue;
 };
 
 template <typename LABEL, typename BASE_TYPE>
@@ -40,7 +66,7 @@ std::ostream& operator<<(std::ostream& stream, const Core::OpaqueID<LABEL, BASE_
 namespace std {
 template <typename LABEL, typename BASE_TYPE>
 struct hash<Core::OpaqueID<LABEL, BASE_TYPE>> {
-    size_t operator(const Core::OpaqueID<LABEL, BASE_TYPE>& value) const noexcept {
+    size_t operator()(const Core::OpaqueID<LABEL, BASE_TYPE>& value) const noexcept {
         return std::hash<BASE_TYPE>{}(value.value());
     }
 };
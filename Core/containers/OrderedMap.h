@@ -1,7 +1,131 @@
 #pragma once
 
-#include <map>
+#include "core/Types.h"
+#include "core/assert/Assert.h"
+#include "core/containers/Array.h"
+#include "core/containers/Span.h"
+
+#include "core/io/serialization/InputStream.h"
+#include "core/io/serialization/OutputStream.h"
+
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
 namespace Core {
+
+// A map which keeps its entries sorted by key in a single contiguous array. Lookups are a branchless binary search and
+// iteration is a linear scan in key order, but inserting or erasing a single entry shifts everything after it. It is
+// meant for maps that are built once (ideally with buildFrom) and then mostly read.
+//
+// Keys must not be modified through iterators, and iterators and references are invalidated by any insertion or
+// erasure.
+template <typename KEY, typename VALUE, typename COMPARE = std::less<KEY>>
+class OrderedMap {
+public:
+    using key_type       = KEY;
+    using mapped_type    = VALUE;
+    using value_type     = std::pair<KEY, VALUE>;
+    using size_type      = u64;
+    using key_compare    = COMPARE;
+    using iterator       = value_type*;
+    using const_iterator = const value_type*;
+
+    OrderedMap() = default;
+    explicit OrderedMap(u64 initialCapacity);
+    OrderedMap(std::initializer_list<value_type> initializerList);
+
+    // Replaces the contents of the map with the given entries, sorting them once instead of inserting them one at a
+    // time. If a key appears more than once, the first occurrence wins, just like inserting the entries in order.
+    void buildFrom(Core::Span<const value_type> newEntries);
+    void buildFrom(Core::Array<value_type>&& newEntries);
+
+    [[nodiscard]] VALUE& operator[](const KEY& key);
+
+    [[nodiscard]] VALUE& at(const KEY& key);
+    [[nodiscard]] const VALUE& at(const KEY& key) const;
+
+    [[nodiscard]] iterator find(const KEY& key);
+    [[nodiscard]] const_iterator find(const KEY& key) const;
+
+    [[nodiscard]] iterator lowerBound(const KEY& key);
+    [[nodiscard]] const_iterator lowerBound(const KEY& key) const;
+    [[nodiscard]] iterator upperBound(const KEY& key);
+    [[nodiscard]] const_iterator upperBound(const KEY& key) const;
+
+    [[nodiscard]] bool contains(const KEY& key) const;
+    [[nodiscard]] u64 count(const KEY& key) const;
+
+    // Constructs the value in place from args if the key is not already present, leaving args untouched otherwise.
+    template <typename... ARGS>
+    std::pair<iterator, bool> emplace(const KEY& key, ARGS&&... args);
+
+    std::pair<iterator, bool> insert(const value_type& value);
+    std::pair<iterator, bool> insert(value_type&& value);
+
+    template <typename V>
+    std::pair<iterator, bool> insertOrAssign(const KEY& key, V&& value);
+
+    u64 erase(const KEY& key);
+    void erase(const_iterator position);
+
+    void clear();
+    void reserve(u64 elementCount);
+
+    [[nodiscard]] u64 size() const;
+    [[nodiscard]] bool empty() const;
+
+    [[nodiscard]] Core::Span<const value_type> entries() const;
+
+    [[nodiscard]] iterator begin();
+    [[nodiscard]] const_iterator begin() const;
+    [[nodiscard]] iterator end();
+    [[nodiscard]] const_iterator end() const;
+
+    bool operator==(const OrderedMap& other) const;
+
+private:
+    [[nodiscard]] u64 lowerBoundIndex(const KEY& key) const;
+    [[nodiscard]] bool isMatch(u64 index, const KEY& key) const;
+
+    void sortAndRemoveDuplicates();
+
+    Core::Array<value_type> sortedEntries;
+    CORE_NO_UNIQUE_ADDRESS COMPARE compare;
+};
+
+}    // namespace Core
+
+namespace Core::IO {
+template <typename KEY, typename VALUE>
+struct Serializer<Core::OrderedMap<KEY, VALUE>> {
+    static void serialize(Core::IO::OutputStream& stream, const Core::OrderedMap<KEY, VALUE>& value) {
+        stream.write(value.size());
+        for(auto& it : value) {
+            stream.write(it.first);
+            stream.write(it.second);
+        }
+    }
+};
+
 template <typename KEY, typename VALUE>
-using OrderedMap = std::map<KEY, VALUE>;
-}
\ No newline at end of file
+struct Deserializer<Core::OrderedMap<KEY, VALUE>> {
+    static Core::OrderedMap<KEY, VALUE> deserialize(Core::IO::InputStream& stream) {
+        size_t entryCount = stream.read<size_t>();
+
+        Core::Array<std::pair<KEY, VALUE>> entries(entryCount);
+        for(size_t i = 0; i < entryCount; i++) {
+            KEY k   = stream.read<KEY>();
+            VALUE v = stream.read<VALUE>();
+            entries.emplace(std::move(k), std::move(v));
+        }
+
+        // Entries are written in order, so this only has to verify that they are still sorted.
+        Core::OrderedMap<KEY, VALUE> value;
+        value.buildFrom(std::move(entries));
+        return value;
+    }
+};
+}    // namespace Core::IO
+
+#include "core/containers/internal/OrderedMap.inl"
@@ -1,8 +1,138 @@
 #pragma once
 
-#include <queue>
+#include "core/Types.h"
+#include "core/assert/Assert.h"
+#include "core/memory/Allocator.h"
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
 
 namespace Core {
-template <typename T>
-using Queue = std::queue<T>
-}
\ No newline at end of file
+
+// A double ended queue stored in a single ring buffer. Pushing and popping at either end is constant time and never
+// moves the other elements, and the buffer is only reallocated when the queue is full. Not thread safe, see SPSCQueue
+// and MPMCQueue for handing work between threads.
+template <typename T, typename ALLOCATOR = Core::Memory::MallocAllocator>
+class Queue {
+public:
+    static_assert(Core::Memory::Allocator<ALLOCATOR>);
+
+    constexpr static u64 MinimumCapacity = 8;
+
+    using ElementType   = T;
+    using AllocatorType = ALLOCATOR;
+
+    template <typename QUEUE, typename VALUE>
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = VALUE*;
+        using reference         = VALUE&;
+
+        Iterator() = default;
+        Iterator(QUEUE* queue, u64 index) : queue(queue), index(index) {}
+
+        reference operator*() const {
+            return (*queue)[index];
+        }
+
+        pointer operator->() const {
+            return &(*queue)[index];
+        }
+
+        Iterator& operator++() {
+            index++;
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator previous = *this;
+            index++;
+            return previous;
+        }
+
+        bool operator==(const Iterator& other) const = default;
+
+    private:
+        QUEUE* queue = nullptr;
+        u64 index    = 0;
+    };
+
+    using iterator       = Iterator<Queue, T>;
+    using const_iterator = Iterator<const Queue, const T>;
+
+    Queue();
+    explicit Queue(const ALLOCATOR& allocator);
+    Queue(std::initializer_list<T> initializerList);
+    Queue(const Queue& other);
+    Queue(Queue&& other);
+
+    Queue& operator=(const Queue& other);
+    Queue& operator=(Queue&& other);
+
+    ~Queue();
+
+    // Elements are indexed from the front of the queue
+    [[nodiscard]] T& operator[](u64 i);
+    [[nodiscard]] const T& operator[](u64 i) const;
+
+    template <typename... ARGS>
+    T& emplaceBack(ARGS&&... args);
+
+    template <typename... ARGS>
+    T& emplaceFront(ARGS&&... args);
+
+    T& pushBack(const T& element);
+    T& pushBack(T&& element);
+    T& pushFront(const T& element);
+    T& pushFront(T&& element);
+
+    // Removes and returns the element at the front or back, the queue must not be empty
+    T popFront();
+    T popBack();
+
+    [[nodiscard]] T& front();
+    [[nodiscard]] const T& front() const;
+    [[nodiscard]] T& back();
+    [[nodiscard]] const T& back() const;
+
+    void clear();
+
+    [[nodiscard]] u64 count() const;
+    [[nodiscard]] u64 totalCapacity() const;
+    [[nodiscard]] bool isEmpty() const;
+
+    [[nodiscard]] iterator begin();
+    [[nodiscard]] const_iterator begin() const;
+    [[nodiscard]] iterator end();
+    [[nodiscard]] const_iterator end() const;
+
+    void ensureCapacity(u64 requiredCapacity);
+
+    [[nodiscard]] const ALLOCATOR& allocator() const;
+
+private:
+    [[nodiscard]] T* slot(u64 i);
+    [[nodiscard]] const T* slot(u64 i) const;
+
+    [[nodiscard]] u64 grownCapacity() const;
+    [[nodiscard]] T* allocateData(u64 newCapacity);
+    // Moves the elements to the start of newData, which becomes the queue's buffer
+    void adoptData(T* newData, u64 newCapacity);
+    void releaseData();
+
+    // The capacity is always 0 or a power of two, so wrapping an index around the ring is a mask
+    T* data          = nullptr;
+    u64 capacity     = 0;
+    u64 head         = 0;
+    u64 elementCount = 0;
+
+    CORE_NO_UNIQUE_ADDRESS ALLOCATOR allocatorInstance;
+};
+
+}    // namespace Core
+
+#include "core/containers/internal/Queue.inl"
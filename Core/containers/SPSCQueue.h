@@ -0,0 +1,60 @@
+#pragma once
+
+#include "core/Types.h"
+#include "core/containers/Span.h"
+#include "core/memory/Allocator.h"
+
+#include <atomic>
+#include <optional>
+
+namespace Core {
+
+// A bounded, lock-free queue for handing elements from exactly one producer thread to exactly one consumer thread.
+// The capacity is fixed at construction and rounded up to a power of two. Pushing to a full queue or popping from an
+// empty one fails instead of waiting.
+//
+// The producer and consumer positions live on separate cache lines, and each side keeps a cached copy of the other's
+// position, so the two threads only touch shared cache lines when the queue looks full or empty.
+template <typename T>
+class SPSCQueue {
+public:
+    explicit SPSCQueue(u64 capacity);
+    SPSCQueue(const SPSCQueue& other) = delete;
+    SPSCQueue& operator=(const SPSCQueue& other) = delete;
+    ~SPSCQueue();
+
+    // Producer only
+    template <typename... ARGS>
+    [[nodiscard]] bool tryEmplace(ARGS&&... args);
+    [[nodiscard]] bool tryPush(const T& element);
+    [[nodiscard]] bool tryPush(T&& element);
+
+    // Moves as many elements from the front of elements as fit, returning how many were pushed
+    [[nodiscard]] u64 tryPushBatch(Core::Span<T> elements);
+
+    // Consumer only
+    [[nodiscard]] std::optional<T> tryPop();
+
+    // Move assigns up to destination.count() elements into destination, returning how many were popped
+    [[nodiscard]] u64 tryPopBatch(Core::Span<T> destination);
+
+    [[nodiscard]] u64 capacity() const;
+
+    // Only exact when neither thread is using the queue
+    [[nodiscard]] u64 approximateCount() const;
+
+private:
+    // Positions only ever increase, and are wrapped into the ring with the mask when used as an index
+    alignas(CacheLineSize) std::atomic<u64> head = 0;
+    u64 cachedTail                               = 0;
+
+    alignas(CacheLineSize) std::atomic<u64> tail = 0;
+    u64 cachedHead                               = 0;
+
+    alignas(CacheLineSize) T* slots = nullptr;
+    u64 mask                        = 0;
+};
+
+}    // namespace Core
+
+#include "core/containers/internal/SPSCQueue.inl"
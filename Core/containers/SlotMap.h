@@ -0,0 +1,92 @@
+#pragma once
+
+#include "core/Types.h"
+#include "core/assert/Assert.h"
+#include "core/containers/Array.h"
+#include "core/containers/OpaqueID.h"
+#include "core/containers/Span.h"
+
+namespace Core {
+
+// Stores elements in a single packed array and hands out generational IDs to find them again. Inserting, erasing and
+// looking up by ID are all constant time, and iterating visits only live elements, contiguously.
+//
+// Each ID names a slot and the generation of that slot when the element was inserted. Erasing bumps the slot's
+// generation, so IDs of erased elements are detected as stale rather than finding whichever element reuses the slot.
+// Erasing moves the last element into the gap, so iteration order is not stable and pointers to elements are
+// invalidated by insertion and erasure. IDs stay valid until their element is erased.
+template <typename T, typename ID = Core::OpaqueID<T>>
+class SlotMap {
+public:
+    using ElementType    = T;
+    using IDType         = ID;
+    using iterator       = T*;
+    using const_iterator = const T*;
+
+    SlotMap() = default;
+    explicit SlotMap(u64 initialCapacity);
+
+    template <typename... ARGS>
+    ID emplace(ARGS&&... args);
+
+    ID insert(const T& element);
+    ID insert(T&& element);
+
+    // Returns false if the ID was stale
+    bool erase(ID id);
+
+    void clear();
+
+    [[nodiscard]] bool contains(ID id) const;
+
+    // Returns nullptr if the ID is stale
+    [[nodiscard]] T* find(ID id);
+    [[nodiscard]] const T* find(ID id) const;
+
+    [[nodiscard]] T& operator[](ID id);
+    [[nodiscard]] const T& operator[](ID id) const;
+
+    // The ID of the element at the given position in iteration order
+    [[nodiscard]] ID idAt(u64 denseIndex) const;
+
+    // The elements and their IDs, in the same order
+    [[nodiscard]] Core::Span<T> elements();
+    [[nodiscard]] Core::Span<const T> elements() const;
+    [[nodiscard]] Core::Span<const ID> ids() const;
+
+    [[nodiscard]] u64 count() const;
+    [[nodiscard]] bool isEmpty() const;
+
+    [[nodiscard]] iterator begin();
+    [[nodiscard]] const_iterator begin() const;
+    [[nodiscard]] iterator end();
+    [[nodiscard]] const_iterator end() const;
+
+    void ensureCapacity(u64 requiredCapacity);
+
+private:
+    using BaseType = typename ID::BaseType;
+
+    constexpr static BaseType EndOfFreeList = ID::MaxIndex;
+
+    struct Slot {
+        // Bumped on every insertion and erasure, so it is odd while the slot is in use and an ID can only ever match
+        // a slot that is in use
+        BaseType generation = 0;
+
+        // Where the element is in denseElements while the slot is in use, or the next free slot otherwise
+        BaseType denseIndexOrNextFree = EndOfFreeList;
+    };
+
+    // Returns the slot for id if it is in use by the same generation
+    [[nodiscard]] const Slot* liveSlot(ID id) const;
+
+    Core::Array<T> denseElements;
+    Core::Array<ID> denseIDs;
+    Core::Array<Slot> slots;
+    BaseType firstFreeSlot = EndOfFreeList;
+};
+
+}    // namespace Core
+
+#include "core/containers/internal/SlotMap.inl"
@@ -0,0 +1,181 @@
+#pragma once
+
+#include "core/Types.h"
+#include "core/assert/Assert.h"
+#include "core/containers/Span.h"
+#include "core/memory/Allocator.h"
+
+#include "core/io/serialization/InputStream.h"
+#include "core/io/serialization/OutputStream.h"
+
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+namespace Core {
+
+// A growable array of records stored as a structure of arrays: each of the types in Ts gets its own contiguous column,
+// so code that only needs some of the fields streams through just those columns. Element i is made up of the i-th
+// entry of every column.
+//
+// All columns share a single allocation from ALLOCATOR and each starts on a ColumnAlignment boundary. Erasing moves the
+// last element into the gap, so element order is not stable. The allocator is handled the same way as for Core::Array,
+// and comes first because the column types take up the rest of the parameters, see SoAArray for the default.
+template <typename ALLOCATOR, typename... Ts>
+class BasicSoAArray {
+public:
+    static_assert(sizeof...(Ts) > 0, "A SoAArray needs at least one column");
+    static_assert(Core::Memory::Allocator<ALLOCATOR>);
+
+    constexpr static u64 ColumnCount     = sizeof...(Ts);
+    constexpr static u64 ColumnAlignment = alignof(std::max_align_t);
+    constexpr static u64 MinimumCapacity = 4;
+    constexpr static f32 GrowthFactor    = 1.5f;
+
+    static_assert(((alignof(Ts) <= ColumnAlignment) && ...), "Over aligned column types are not supported");
+
+    using AllocatorType = ALLOCATOR;
+
+    template <u64 COLUMN>
+    using ColumnType = std::tuple_element_t<COLUMN, std::tuple<Ts...>>;
+
+    BasicSoAArray() = default;
+    explicit BasicSoAArray(u64 initialCapacity);
+    explicit BasicSoAArray(const ALLOCATOR& allocator);
+    BasicSoAArray(const BasicSoAArray& other);
+    BasicSoAArray(BasicSoAArray&& other);
+
+    BasicSoAArray& operator=(const BasicSoAArray& other);
+    BasicSoAArray& operator=(BasicSoAArray&& other);
+
+    ~BasicSoAArray();
+
+    // Appends an element built from one value per column, returning its index
+    template <typename... US>
+    u64 emplace(US&&... values) requires(sizeof...(US) == ColumnCount);
+
+    // Removes an element by moving the last element into its place
+    void eraseAt(u64 index);
+
+    // Adds value initialized elements or destroys elements at the end until there are newCount of them
+    void resize(u64 newCount);
+
+    void clear();
+
+    template <u64 COLUMN>
+    [[nodiscard]] Core::Span<ColumnType<COLUMN>> column();
+
+    template <u64 COLUMN>
+    [[nodiscard]] Core::Span<const ColumnType<COLUMN>> column() const;
+
+    template <u64 COLUMN>
+    [[nodiscard]] ColumnType<COLUMN>& get(u64 index);
+
+    template <u64 COLUMN>
+    [[nodiscard]] const ColumnType<COLUMN>& get(u64 index) const;
+
+    [[nodiscard]] u64 count() const;
+    [[nodiscard]] u64 totalCapacity() const;
+    [[nodiscard]] bool isEmpty() const;
+
+    void ensureCapacity(u64 requiredCapacity);
+
+    [[nodiscard]] const ALLOCATOR& allocator() const;
+
+private:
+    using Columns       = std::tuple<Ts*...>;
+    using ColumnIndices = std::index_sequence_for<Ts...>;
+
+    // Bytes needed for all columns when they hold capacity elements each
+    [[nodiscard]] static u64 AllocationSize(u64 capacity);
+
+    // Points each column at its place in an allocation made for capacity elements
+    [[nodiscard]] static Columns LayOutColumns(std::byte* allocation, u64 capacity);
+
+    template <u64... COLUMNS, typename... US>
+    void constructAt(u64 index, std::index_sequence<COLUMNS...>, US&&... values);
+
+    template <typename T>
+    static void EraseFromColumn(T* column, u64 index, u64 lastIndex);
+
+    void copyElementsFrom(const BasicSoAArray& other);
+    void destructAllElements();
+    void releaseData();
+
+    std::byte* data  = nullptr;
+    Columns columns  = {};
+    u64 capacity     = 0;
+    u64 elementCount = 0;
+    CORE_NO_UNIQUE_ADDRESS ALLOCATOR allocatorInstance;
+};
+
+template <typename... Ts>
+using SoAArray = BasicSoAArray<Core::Memory::MallocAllocator, Ts...>;
+
+}    // namespace Core
+
+namespace Core::IO {
+
+// Writes the element count followed by each column in turn, so columns of plain data are written with a single copy.
+template <typename ALLOCATOR, typename... Ts>
+struct Serializer<Core::BasicSoAArray<ALLOCATOR, Ts...>> {
+    static void serialize(OutputStream& stream, const Core::BasicSoAArray<ALLOCATOR, Ts...>& values) {
+        stream.write(values.count());
+        serializeColumns(stream, values, std::index_sequence_for<Ts...>());
+    }
+
+private:
+    template <u64... COLUMNS>
+    static void serializeColumns(OutputStream& stream,
+                                 const Core::BasicSoAArray<ALLOCATOR, Ts...>& values,
+                                 std::index_sequence<COLUMNS...>) {
+        (serializeColumn(stream, values.template column<COLUMNS>()), ...);
+    }
+
+    template <typename T>
+    static void serializeColumn(OutputStream& stream, Core::Span<const T> column) {
+        if constexpr(BinarySerializable<T>) {
+            stream.write(Core::AsBytes(column));
+        } else {
+            for(const T& value : column) {
+                Serializer<T>::serialize(stream, value);
+            }
+        }
+    }
+};
+
+// Every column type must be default constructible, as elements are created before their columns are read.
+template <typename ALLOCATOR, typename... Ts>
+struct Deserializer<Core::BasicSoAArray<ALLOCATOR, Ts...>> {
+    static Core::BasicSoAArray<ALLOCATOR, Ts...> deserialize(InputStream& stream) {
+        u64 elementCount = stream.read<u64>();
+
+        Core::BasicSoAArray<ALLOCATOR, Ts...> values;
+        values.resize(elementCount);
+        deserializeColumns(stream, values, std::index_sequence_for<Ts...>());
+        return values;
+    }
+
+private:
+    template <u64... COLUMNS>
+    static void deserializeColumns(InputStream& stream,
+                                   Core::BasicSoAArray<ALLOCATOR, Ts...>& values,
+                                   std::index_sequence<COLUMNS...>) {
+        (deserializeColumn(stream, values.template column<COLUMNS>()), ...);
+    }
+
+    template <typename T>
+    static void deserializeColumn(InputStream& stream, Core::Span<T> column) {
+        if constexpr(BinarySerializable<T>) {
+            stream.readInto<T>(column);
+        } else {
+            for(T& value : column) {
+                value = Deserializer<T>::deserialize(stream);
+            }
+        }
+    }
+};
+
+}    // namespace Core::IO
+
+#include "core/containers/internal/SoAArray.inl"
@@ -0,0 +1,177 @@
+#include "core/containers/StringId.h"
+
+#include "core/assert/Assert.h"
+#include "core/containers/Array.h"
+#include "core/containers/ConcurrentHashMap.h"
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <mutex>
+
+namespace {
+
+struct Entry {
+    const char* text;
+    u64 length;
+    u64 hash;
+};
+
+struct Key {
+    std::string_view text;
+    u64 hash;
+
+    bool operator==(const Key& other) const {
+        return hash == other.hash && text == other.text;
+    }
+};
+
+struct KeyHasher {
+    u64 operator()(const Key& key) const {
+        return key.hash;
+    }
+};
+
+// Entries are kept in fixed size chunks that never move, so looking up an id's text doesn't need a lock. An id is
+// only handed out after its entry is written, and only through the lookup map's locks, so any thread that has an id
+// also sees its entry.
+class InternPool {
+public:
+    constexpr static u64 EntriesPerChunk = 4096;
+    constexpr static u64 MaxChunks       = 4096;
+
+    // Strings are copied into blocks of this size, apart from long ones which get a block of their own
+    constexpr static u64 StorageBlockSize = 64 * 1024;
+
+    InternPool() {
+        // Id 0 is the empty string, so that default constructed ids don't need the pool
+        Entry* firstChunk = new Entry[EntriesPerChunk];
+        firstChunk[0]     = Entry{.text = "", .length = 0, .hash = Core::HashString("")};
+        chunks[0].store(firstChunk, std::memory_order_release);
+    }
+
+    InternPool(const InternPool&)            = delete;
+    InternPool& operator=(const InternPool&) = delete;
+
+    std::optional<u32> find(std::string_view text, u64 hash) const {
+        if(text.empty()) {
+            return 0;
+        }
+
+        return ids.find(Key{.text = text, .hash = hash});
+    }
+
+    u32 intern(std::string_view text, u64 hash) {
+        if(std::optional<u32> existing = find(text, hash)) {
+            return *existing;
+        }
+
+        // Interning a new string is rare enough that the copy and the entry are made under a single lock, which also
+        // keeps two threads from both copying the same string
+        std::scoped_lock lock(insertLock);
+        if(std::optional<u32> existing = find(text, hash)) {
+            return *existing;
+        }
+
+        ASSERT_WITH_MESSAGE(entryCount < EntriesPerChunk * MaxChunks, "Too many interned strings");
+        u32 id = static_cast<u32>(entryCount++);
+
+        Entry* chunk = chunks[id / EntriesPerChunk].load(std::memory_order_relaxed);
+        if(chunk == nullptr) {
+            chunk = new Entry[EntriesPerChunk];
+            chunks[id / EntriesPerChunk].store(chunk, std::memory_order_release);
+        }
+
+        const char* storedText      = store(text);
+        chunk[id % EntriesPerChunk] = Entry{.text = storedText, .length = text.size(), .hash = hash};
+        ids.insert(Key{.text = std::string_view(storedText, text.size()), .hash = hash}, id);
+
+        return id;
+    }
+
+    const Entry& entry(u32 id) const {
+        const Entry* chunk = chunks[id / EntriesPerChunk].load(std::memory_order_acquire);
+        return chunk[id % EntriesPerChunk];
+    }
+
+private:
+    const char* store(std::string_view text) {
+        u64 size = text.size() + 1;
+
+        char* destination;
+        if(size > StorageBlockSize / 4) {
+            destination = storageBlocks.emplace(std::make_unique<char[]>(size)).get();
+        } else {
+            if(size > storageRemaining) {
+                storageCursor    = storageBlocks.emplace(std::make_unique<char[]>(StorageBlockSize)).get();
+                storageRemaining = StorageBlockSize;
+            }
+
+            destination = storageCursor;
+            storageCursor += size;
+            storageRemaining -= size;
+        }
+
+        std::memcpy(destination, text.data(), text.size());
+        destination[text.size()] = '\0';
+        return destination;
+    }
+
+    Core::ConcurrentHashMap<Key, u32, KeyHasher> ids;
+
+    std::mutex insertLock;
+    std::atomic<Entry*> chunks[MaxChunks] = {};
+    u64 entryCount                        = 1;
+
+    Core::Array<std::unique_ptr<char[]>> storageBlocks;
+    char* storageCursor  = nullptr;
+    u64 storageRemaining = 0;
+};
+
+// The pool is never destroyed, so ids can still be read by other statics' destructors
+InternPool& Pool() {
+    static InternPool* Instance = new InternPool();
+    return *Instance;
+}
+
+}    // namespace
+
+namespace Core {
+
+StringId::StringId(std::string_view text) : StringId(text, HashString(text)) {}
+
+StringId::StringId(std::string_view text, u64 precomputedHash) : id(Pool().intern(text, precomputedHash)) {}
+
+StringId::StringId(u32 id) : id(id) {}
+
+std::optional<StringId> StringId::Find(std::string_view text) {
+    std::optional<u32> id = Pool().find(text, HashString(text));
+    if(!id) {
+        return std::nullopt;
+    }
+
+    return StringId(*id);
+}
+
+std::string_view StringId::view() const {
+    const Entry& entry = Pool().entry(id);
+    return std::string_view(entry.text, entry.length);
+}
+
+const char* StringId::c_str() const {
+    return Pool().entry(id).text;
+}
+
+u64 StringId::hash() const {
+    return Pool().entry(id).hash;
+}
+
+u32 StringId::value() const {
+    return id;
+}
+
+bool StringId::empty() const {
+    return id == 0;
+}
+
+}    // namespace Core
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "core/Types.h"
+
+#include "core/io/serialization/InputStream.h"
+#include "core/io/serialization/OutputStream.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <optional>
+#include <string_view>
+
+namespace Core {
+
+// FNV-1a. It is constexpr so that the hashes of literals can be worked out by the compiler.
+constexpr u64 HashString(std::string_view text) {
+    u64 hash = 0xcbf29ce484222325;
+    for(char character : text) {
+        hash ^= static_cast<u8>(character);
+        hash *= 0x100000001b3;
+    }
+    return hash;
+}
+
+// A handle to a string in a global, thread-safe intern pool, for names that are looked up and compared far more often
+// than they are created, such as uniform, vertex input and mesh part names. Equal strings always get the same handle,
+// so comparing and hashing handles never touches the characters.
+//
+// Interned strings live until the program exits. The pool hands out ids in the order strings are first interned, so
+// ids differ between runs, and StringIds serialize as their text.
+class StringId {
+public:
+    // The empty string
+    StringId() = default;
+    explicit StringId(std::string_view text);
+
+    // For callers that already know the string's hash, such as the _id literal
+    StringId(std::string_view text, u64 precomputedHash);
+
+    // Returns the id of text if it has already been interned, without interning it
+    [[nodiscard]] static std::optional<StringId> Find(std::string_view text);
+
+    [[nodiscard]] std::string_view view() const;
+
+    // Interned strings are null terminated
+    [[nodiscard]] const char* c_str() const;
+
+    // The HashString of the text, computed when it was interned
+    [[nodiscard]] u64 hash() const;
+
+    [[nodiscard]] u32 value() const;
+    [[nodiscard]] bool empty() const;
+
+    bool operator==(const StringId& other) const = default;
+
+private:
+    explicit StringId(u32 id);
+
+    u32 id = 0;
+};
+
+namespace internal::StringLiterals {
+template <u64 N>
+struct FixedString {
+    consteval FixedString(const char (&text)[N]) {
+        std::copy_n(text, N, characters);
+    }
+
+    [[nodiscard]] constexpr std::string_view view() const {
+        return std::string_view(characters, N - 1);
+    }
+
+    char characters[N];
+};
+}    // namespace internal::StringLiterals
+
+namespace Literals {
+// "name"_id hashes the literal at compile time and only looks it up in the pool the first time that literal is used
+template <internal::StringLiterals::FixedString TEXT>
+Core::StringId operator""_id() {
+    constexpr u64 Hash = Core::HashString(TEXT.view());
+    static const Core::StringId Id(TEXT.view(), Hash);
+    return Id;
+}
+}    // namespace Literals
+
+}    // namespace Core
+
+namespace std {
+// Ids are unique per string, so the id itself is a perfect hash
+template <>
+struct hash<Core::StringId> {
+    size_t operator()(const Core::StringId& id) const noexcept {
+        return id.value();
+    }
+};
+}    // namespace std
+
+namespace fmt {
+template <>
+struct formatter<Core::StringId> : formatter<std::string_view> {
+    template <typename FormatContext>
+    auto format(const Core::StringId& id, FormatContext& ctx) const {
+        return formatter<std::string_view>::format(id.view(), ctx);
+    }
+};
+}    // namespace fmt
+
+namespace Core::IO {
+
+template <>
+struct Serializer<Core::StringId> {
+    static void serialize(OutputStream& stream, const Core::StringId& id) {
+        stream.write(id.view());
+    }
+};
+
+template <>
+struct Deserializer<Core::StringId> {
+    static Core::StringId deserialize(InputStream& stream) {
+        return Core::StringId(stream.read<std::string>());
+    }
+};
+
+}    // namespace Core::IO
@@ -7,35 +7,45 @@
 
 namespace Core {
 
-template <typename T>
-Array<T>::Array(u64 initialCapacity) : capacity(initialCapacity) {
-    data = reinterpret_cast<T*>(malloc(capacity * ElementSize));
+template <typename T, typename ALLOCATOR>
+Array<T, ALLOCATOR>::Array(u64 initialCapacity) : Array(initialCapacity, ALLOCATOR()) {}
+
+template <typename T, typename ALLOCATOR>
+Array<T, ALLOCATOR>::Array(const ALLOCATOR& allocator) : Array(4, allocator) {}
+
+template <typename T, typename ALLOCATOR>
+Array<T, ALLOCATOR>::Array(u64 initialCapacity, const ALLOCATOR& allocator)
+  : capacity(initialCapacity), allocatorInstance(allocator) {
+    data = allocateElements(capacity);
 }
 
-template <typename T>
-Array<T>::Array(Core::Span<T> elementsToCopy) : capacity(elementsToCopy.count()) {
-    data = reinterpret_cast<T*>(malloc(capacity * ElementSize));
+template <typename T, typename ALLOCATOR>
+Array<T, ALLOCATOR>::Array(Core::Span<T> elementsToCopy) : Array(elementsToCopy, ALLOCATOR()) {}
+
+template <typename T, typename ALLOCATOR>
+Array<T, ALLOCATOR>::Array(Core::Span<T> elementsToCopy, const ALLOCATOR& allocator)
+  : capacity(elementsToCopy.count()), allocatorInstance(allocator) {
+    data = allocateElements(capacity);
     insertAll(elementsToCopy);
 }
 
-template <typename T>
-Array<T>::Array(const T& original, u64 repeatCount) : Array() {
+template <typename T, typename ALLOCATOR>
+Array<T, ALLOCATOR>::Array(const T& original, u64 repeatCount) : Array() {
     ensureCapacity(repeatCount);
     for(u64 i = 0; i < repeatCount; i++) {
         emplace(original);
     }
 }
 
-template <typename T>
-Array<T>::Array(std::initializer_list<T> initializerList) : Array() {
+template <typename T, typename ALLOCATOR>
+Array<T, ALLOCATOR>::Array(std::initializer_list<T> initializerList) : Array() {
     insertAll(Core::ToSpan(initializerList));
 }
 
-template <typename T>
-Array<T>::Array(const Array<T>& other)
-  : capacity(other.capacity),
-    elementCount(other.elementCount),
-    data(reinterpret_cast<T*>(malloc(capacity * ElementSize))) {
+template <typename T, typename ALLOCATOR>
+Array<T, ALLOCATOR>::Array(const Array<T, ALLOCATOR>& other)
+  : capacity(other.capacity), elementCount(other.elementCount), allocatorInstance(other.allocatorInstance) {
+    data = allocateElements(capacity);
     if constexpr(std::is_trivially_copyable_v<T>) {
         CopyElementMemory(data, other.data, elementCount);
     } else {
@@ -43,17 +53,22 @@ Array<T>::Array(const Array<T>& other)
     }
 }
 
-template <typename T>
-Array<T>::Array(Array<T>&& other) : capacity(other.capacity), elementCount(other.elementCount), data(other.data) {
+template <typename T, typename ALLOCATOR>
+Array<T, ALLOCATOR>::Array(Array<T, ALLOCATOR>&& other)
+  : capacity(other.capacity),
+    elementCount(other.elementCount),
+    data(other.data),
+    allocatorInstance(other.allocatorInstance) {
     other.capacity     = 0;
     other.elementCount = 0;
     other.data         = nullptr;
 }
 
-template <typename T>
-Array<T>& Array<T>::operator=(const Array<T>& other) {
+template <typename T, typename ALLOCATOR>
+Array<T, ALLOCATOR>& Array<T, ALLOCATOR>::operator=(const Array<T, ALLOCATOR>& other) {
     if(&other != this) {
         destructAllElements();
+        elementCount = 0;
         ensureCapacity(other.elementCount);
 
         if constexpr(std::is_trivially_copyable_v<T>) {
@@ -68,15 +83,16 @@ Array<T>& Array<T>::operator=(const Array<T>& other) {
     return *this;
 }
 
-template <typename T>
-Array<T>& Array<T>::operator=(Array<T>&& other) {
+template <typename T, typename ALLOCATOR>
+Array<T, ALLOCATOR>& Array<T, ALLOCATOR>::operator=(Array<T, ALLOCATOR>&& other) {
     if(&other != this) {
         destructAllElements();
-        free(data);
+        deallocateElements(data, capacity);
 
-        capacity     = other.capacity;
-        elementCount = other.elementCount;
-        data         = other.data;
+        capacity          = other.capacity;
+        elementCount      = other.elementCount;
+        data              = other.data;
+        allocatorInstance = other.allocatorInstance;
 
         other.capacity     = 0;
         other.elementCount = 0;
@@ -86,27 +102,27 @@ Array<T>& Array<T>::operator=(Array<T>&& other) {
     return *this;
 }
 
-template <typename T>
-Array<T>::~Array() {
+template <typename T, typename ALLOCATOR>
+Array<T, ALLOCATOR>::~Array() {
     destructAllElements();
-    free(data);
+    deallocateElements(data, capacity);
 }
 
-template <typename T>
-T& Array<T>::operator[](u64 i) {
+template <typename T, typename ALLOCATOR>
+T& Array<T, ALLOCATOR>::operator[](u64 i) {
     ASSERT_WITH_MESSAGE(i < elementCount, "Index: {}, Count: {}", i, elementCount);
     return *(data + i);
 }
 
-template <typename T>
-const T& Array<T>::operator[](u64 i) const {
+template <typename T, typename ALLOCATOR>
+const T& Array<T, ALLOCATOR>::operator[](u64 i) const {
     ASSERT_WITH_MESSAGE(i < elementCount, "Index: {}, Count: {}", i, elementCount);
     return *(data + i);
 }
 
-template <typename T>
+template <typename T, typename ALLOCATOR>
 template <typename... ARGS>
-T& Array<T>::emplaceAt(u64 index, ARGS&&... args) {
+T& Array<T, ALLOCATOR>::emplaceAt(u64 index, ARGS&&... args) {
     ASSERT(index <= elementCount);
 
     if(index < elementCount) {
@@ -120,19 +136,19 @@ T& Array<T>::emplaceAt(u64 index, ARGS&&... args) {
     return *newElement;
 }
 
-template <typename T>
+template <typename T, typename ALLOCATOR>
 template <typename... ARGS>
-T& Array<T>::emplace(ARGS&&... args) {
+T& Array<T, ALLOCATOR>::emplace(ARGS&&... args) {
     return emplaceAt(elementCount, std::forward<ARGS>(args)...);
 }
 
-template <typename T>
-T& Array<T>::insertAt(u64 index, const T& elementToInsert) {
+template <typename T, typename ALLOCATOR>
+T& Array<T, ALLOCATOR>::insertAt(u64 index, const T& elementToInsert) {
     return emplaceAt(index, elementToInsert);
 }
 
-template <typename T>
-T& Array<T>::insertAt(u64 index, T&& elementToInsert) {
+template <typename T, typename ALLOCATOR>
+T& Array<T, ALLOCATOR>::insertAt(u64 index, T&& elementToInsert) {
     if constexpr(std::is_move_constructible_v<T>) {
         return emplaceAt(index, std::move(elementToInsert));
     } else {
@@ -140,13 +156,13 @@ T& Array<T>::insertAt(u64 index, T&& elementToInsert) {
     }
 }
 
-template <typename T>
-T& Array<T>::insert(const T& elementToInsert) {
+template <typename T, typename ALLOCATOR>
+T& Array<T, ALLOCATOR>::insert(const T& elementToInsert) {
     return emplace(elementToInsert);
 }
 
-template <typename T>
-T& Array<T>::insert(T&& elementToInsert) {
+template <typename T, typename ALLOCATOR>
+T& Array<T, ALLOCATOR>::insert(T&& elementToInsert) {
     if constexpr(std::is_move_constructible_v<T>) {
         return emplace(std::forward<T>(elementToInsert));
     } else {
@@ -154,9 +170,9 @@ T& Array<T>::insert(T&& elementToInsert) {
     }
 }
 
-template <typename T>
+template <typename T, typename ALLOCATOR>
 template <typename U>
-Core::Span<T> Array<T>::insertAll(Core::Span<U> elements) {
+Core::Span<T> Array<T, ALLOCATOR>::insertAll(Core::Span<U> elements) {
     ensureCapacity(elementCount + elements.count());
     if constexpr(std::is_same_v<std::remove_cv_t<U>, T> && std::is_trivially_copyable_v<T>) {
         CopyElementMemory(data + elementCount, elements.rawData(), elements.count());
@@ -169,138 +185,194 @@ Core::Span<T> Array<T>::insertAll(Core::Span<U> elements) {
     return Core::Span<T>(data + elementCount - elements.count(), elements.count());
 }
 
-template <typename T>
-Core::Span<T> Array<T>::insertUninitialized(u64 newElementCount) {
+template <typename T, typename ALLOCATOR>
+Core::Span<T> Array<T, ALLOCATOR>::insertUninitialized(u64 newElementCount) {
     ensureCapacity(elementCount + newElementCount);
     elementCount += newElementCount;
 
     return Core::Span<T>(data + elementCount - newElementCount, newElementCount);
 }
 
-template <typename T>
-void Array<T>::eraseAt(u64 index, u64 elementsToErase) {
+template <typename T, typename ALLOCATOR>
+void Array<T, ALLOCATOR>::eraseAt(u64 index, u64 elementsToErase) {
     shiftElementsLeft(index + elementsToErase, elementsToErase);
 }
 
-template <typename T>
-void Array<T>::clear() {
+template <typename T, typename ALLOCATOR>
+void Array<T, ALLOCATOR>::swapErase(u64 index) {
+    ASSERT_WITH_MESSAGE(index < elementCount, "Index: {}, Count: {}", index, elementCount);
+
+    u64 lastIndex = elementCount - 1;
+    if(index != lastIndex) {
+        if constexpr(Core::IsTriviallyRelocatable<T>) {
+            std::destroy_at(data + index);
+            Core::Algorithms::RelocateElements(data + lastIndex, data + index, 1);
+            elementCount--;
+            return;
+        }
+
+        Core::Algorithms::MoveElements(data + lastIndex, data + index, 1);
+    }
+
+    std::destroy_at(data + lastIndex);
+    elementCount--;
+}
+
+template <typename T, typename ALLOCATOR>
+void Array<T, ALLOCATOR>::clear() {
     destructAllElements();
     elementCount = 0;
 }
 
-template <typename T>
-u64 Array<T>::count() const {
+template <typename T, typename ALLOCATOR>
+u64 Array<T, ALLOCATOR>::count() const {
     return elementCount;
 }
 
-template <typename T>
-u64 Array<T>::totalCapacity() const {
+template <typename T, typename ALLOCATOR>
+u64 Array<T, ALLOCATOR>::totalCapacity() const {
     return capacity;
 }
 
-template <typename T>
-u64 Array<T>::unusedCapacity() const {
+template <typename T, typename ALLOCATOR>
+u64 Array<T, ALLOCATOR>::unusedCapacity() const {
     return capacity - elementCount;
 }
 
-template <typename T>
-bool Array<T>::isEmpty() const {
+template <typename T, typename ALLOCATOR>
+bool Array<T, ALLOCATOR>::isEmpty() const {
     return elementCount == 0;
 }
 
-template <typename T>
-T* Array<T>::rawData() {
+template <typename T, typename ALLOCATOR>
+T* Array<T, ALLOCATOR>::rawData() {
     return data;
 }
 
-template <typename T>
-const T* Array<T>::rawData() const {
+template <typename T, typename ALLOCATOR>
+const T* Array<T, ALLOCATOR>::rawData() const {
     return data;
 }
 
-template <typename T>
-T* Array<T>::begin() {
+template <typename T, typename ALLOCATOR>
+T* Array<T, ALLOCATOR>::begin() {
     return data;
 }
 
-template <typename T>
-const T* Array<T>::begin() const {
+template <typename T, typename ALLOCATOR>
+const T* Array<T, ALLOCATOR>::begin() const {
     return data;
 }
 
-template <typename T>
-T* Array<T>::end() {
+template <typename T, typename ALLOCATOR>
+T* Array<T, ALLOCATOR>::end() {
     return data + elementCount;
 }
 
-template <typename T>
-const T* Array<T>::end() const {
+template <typename T, typename ALLOCATOR>
+const T* Array<T, ALLOCATOR>::end() const {
     return data + elementCount;
 }
 
-template <typename T>
-void Array<T>::ensureCapacity(u64 requiredCapacity) {
+template <typename T, typename ALLOCATOR>
+void Array<T, ALLOCATOR>::ensureCapacity(u64 requiredCapacity) {
     if(requiredCapacity <= capacity) {
         return;
     }
 
+    u64 oldCapacity = capacity;
     while(capacity < requiredCapacity) {
         capacity = std::max(static_cast<u64>(capacity * GrowthFactor), MinimumCapacity);
     }
 
-    T* newData = reinterpret_cast<T*>(malloc(capacity * ElementSize));
-    if constexpr(std::is_trivially_copyable_v<T>) {
-        CopyElementMemory(newData, data, elementCount);
-    } else if constexpr(std::is_move_constructible_v<T>) {
-        std::uninitialized_move_n(data, elementCount, newData);
-    } else {
-        std::uninitialized_copy_n(data, elementCount, newData);
+    if constexpr(Core::IsTriviallyRelocatable<T> && Core::Memory::ReallocatingAllocator<ALLOCATOR>) {
+        data = reinterpret_cast<T*>(
+              allocatorInstance.reallocate(data, oldCapacity * ElementSize, capacity * ElementSize, alignof(T)));
+        return;
     }
 
-    destructAllElements();
+    T* newData = allocateElements(capacity);
+    Core::Algorithms::RelocateElements(data, newData, elementCount);
 
-    free(data);
+    deallocateElements(data, oldCapacity);
     data = newData;
 }
 
-template <typename T>
-void Array<T>::destructAllElements() {
+template <typename T, typename ALLOCATOR>
+const ALLOCATOR& Array<T, ALLOCATOR>::allocator() const {
+    return allocatorInstance;
+}
+
+template <typename T, typename ALLOCATOR>
+T* Array<T, ALLOCATOR>::allocateElements(u64 elementCount) {
+    return reinterpret_cast<T*>(allocatorInstance.allocate(elementCount * ElementSize, alignof(T)));
+}
+
+template <typename T, typename ALLOCATOR>
+void Array<T, ALLOCATOR>::deallocateElements(T* elements, u64 elementCount) {
+    if(elements != nullptr) {
+        allocatorInstance.deallocate(elements, elementCount * ElementSize);
+    }
+}
+
+template <typename T, typename ALLOCATOR>
+void Array<T, ALLOCATOR>::destructAllElements() {
     Core::Algorithms::DestroyElements(data, elementCount);
 }
 
-template <typename T>
-void Array<T>::CopyElementMemory(T* destination, const T* source, u64 elementCount) {
+template <typename T, typename ALLOCATOR>
+void Array<T, ALLOCATOR>::CopyElementMemory(T* destination, const T* source, u64 elementCount) {
     std::memcpy(destination, source, elementCount * ElementSize);
 }
 
-template <typename T>
-void Array<T>::MoveElementMemory(T* destination, const T* source, u64 elementCount) {
+template <typename T, typename ALLOCATOR>
+void Array<T, ALLOCATOR>::MoveElementMemory(T* destination, const T* source, u64 elementCount) {
     std::memmove(destination, source, elementCount * ElementSize);
 }
 
 
-template <typename T>
-void Array<T>::shiftElementsLeft(u64 startIndex, u64 distance) {
+template <typename T, typename ALLOCATOR>
+void Array<T, ALLOCATOR>::shiftElementsLeft(u64 startIndex, u64 distance) {
     ASSERT(distance <= startIndex);
 
     T* source      = data + startIndex;
     T* destination = source - distance;
 
+    if constexpr(Core::IsTriviallyRelocatable<T>) {
+        // The elements being overwritten are destroyed first, then the rest slide down over them as raw bytes
+        Core::Algorithms::DestroyElements(destination, distance);
+        Core::Algorithms::RelocateElements(source, destination, elementCount - startIndex);
+        elementCount -= distance;
+        return;
+    }
+
     Core::Algorithms::MoveElements(source, destination, elementCount - startIndex);
 
     elementCount -= distance;
     Core::Algorithms::DestroyElements(data + elementCount, distance);
 }
 
-template <typename T>
-void Array<T>::shiftElementsRight(u64 startIndex, u64 distance) {
+template <typename T, typename ALLOCATOR>
+void Array<T, ALLOCATOR>::shiftElementsRight(u64 startIndex, u64 distance) {
     ensureCapacity(elementCount + distance);
 
     T* source      = data + startIndex;
     T* destination = source + distance;
+    T* end         = data + elementCount;
+    u64 moveCount  = elementCount - startIndex;
+
+    if constexpr(Core::IsTriviallyRelocatable<T>) {
+        Core::Algorithms::RelocateElements(source, destination, moveCount);
+        return;
+    }
 
-    Core::Algorithms::MoveElementsBackwards(source, destination, elementCount - startIndex);
-    Core::Algorithms::DestroyElements(source, distance);
+    // The last elements land past the current end where no objects exist yet, so they are constructed instead of
+    // assigned to. Only the slots that held live elements are destroyed afterwards.
+    u64 constructCount = std::min(distance, moveCount);
+    Core::Algorithms::MoveElementsToUninitialized(
+          end - constructCount, end + distance - constructCount, constructCount);
+    Core::Algorithms::MoveElementsBackwards(source, destination, moveCount - constructCount);
+    Core::Algorithms::DestroyElements(source, constructCount);
 }
 
 }    // namespace Core
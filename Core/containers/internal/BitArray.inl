@@ -0,0 +1,71 @@
+#pragma once
+
+#include "core/containers/BitArray.h"
+
+#include <bit>
+
+namespace Core {
+
+inline bool BitArray::operator[](u64 index) const {
+    return test(index);
+}
+
+inline bool BitArray::test(u64 index) const {
+    ASSERT_WITH_MESSAGE(index < bitCount, "Index: {}, Count: {}", index, bitCount);
+    return (wordStorage[index / BitsPerWord] >> (index % BitsPerWord)) & 1;
+}
+
+inline void BitArray::set(u64 index) {
+    ASSERT_WITH_MESSAGE(index < bitCount, "Index: {}, Count: {}", index, bitCount);
+    wordStorage[index / BitsPerWord] |= WordType(1) << (index % BitsPerWord);
+}
+
+inline void BitArray::set(u64 index, bool value) {
+    if(value) {
+        set(index);
+    } else {
+        reset(index);
+    }
+}
+
+inline void BitArray::reset(u64 index) {
+    ASSERT_WITH_MESSAGE(index < bitCount, "Index: {}, Count: {}", index, bitCount);
+    wordStorage[index / BitsPerWord] &= ~(WordType(1) << (index % BitsPerWord));
+}
+
+inline void BitArray::toggle(u64 index) {
+    ASSERT_WITH_MESSAGE(index < bitCount, "Index: {}, Count: {}", index, bitCount);
+    wordStorage[index / BitsPerWord] ^= WordType(1) << (index % BitsPerWord);
+}
+
+template <typename VISITOR>
+void BitArray::forEachSetBit(VISITOR&& visitor) const {
+    const WordType* words = wordStorage.rawData();
+    u64 wordCount         = wordStorage.count();
+
+    for(u64 wordIndex = 0; wordIndex < wordCount; wordIndex++) {
+        WordType word = words[wordIndex];
+        while(word != 0) {
+            visitor(wordIndex * BitsPerWord + static_cast<u64>(std::countr_zero(word)));
+            word &= word - 1;
+        }
+    }
+}
+
+inline u64 BitArray::count() const {
+    return bitCount;
+}
+
+inline bool BitArray::isEmpty() const {
+    return bitCount == 0;
+}
+
+inline Core::Span<const BitArray::WordType> BitArray::words() const {
+    return Core::ToSpan(wordStorage);
+}
+
+inline u64 BitArray::WordsFor(u64 bitCount) {
+    return (bitCount + BitsPerWord - 1) / BitsPerWord;
+}
+
+}    // namespace Core
@@ -0,0 +1,413 @@
+#pragma once
+
+#include "core/containers/Colony.h"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace Core {
+
+template <typename T, typename ALLOCATOR>
+template <typename ELEMENT>
+Colony<T, ALLOCATOR>::Iterator<ELEMENT>::Iterator(Block* block, SkipType index) : block(block), index(index) {}
+
+template <typename T, typename ALLOCATOR>
+template <typename ELEMENT>
+template <typename OTHER>
+Colony<T, ALLOCATOR>::Iterator<ELEMENT>::Iterator(const Iterator<OTHER>& other)
+    requires(std::is_same_v<const OTHER, ELEMENT> && !std::is_const_v<OTHER>)
+  : block(other.block), index(other.index) {}
+
+template <typename T, typename ALLOCATOR>
+template <typename ELEMENT>
+ELEMENT& Colony<T, ALLOCATOR>::Iterator<ELEMENT>::operator*() const {
+    return block->slots[index].element;
+}
+
+template <typename T, typename ALLOCATOR>
+template <typename ELEMENT>
+ELEMENT* Colony<T, ALLOCATOR>::Iterator<ELEMENT>::operator->() const {
+    return &block->slots[index].element;
+}
+
+template <typename T, typename ALLOCATOR>
+template <typename ELEMENT>
+typename Colony<T, ALLOCATOR>::template Iterator<ELEMENT>& Colony<T, ALLOCATOR>::Iterator<ELEMENT>::operator++() {
+    // A hole right after this element is the start of a run, which holds the length of the whole run
+    index++;
+    index += block->skipfield[index];
+
+    if(index >= block->highWater) {
+        // Empty blocks are freed, so the first element of the next block is at most one run of holes in
+        block = block->next;
+        index = block != nullptr ? block->skipfield[0] : 0;
+    }
+
+    return *this;
+}
+
+template <typename T, typename ALLOCATOR>
+template <typename ELEMENT>
+typename Colony<T, ALLOCATOR>::template Iterator<ELEMENT> Colony<T, ALLOCATOR>::Iterator<ELEMENT>::operator++(int) {
+    Iterator previous = *this;
+    ++(*this);
+    return previous;
+}
+
+template <typename T, typename ALLOCATOR>
+Colony<T, ALLOCATOR>::Colony(const ALLOCATOR& allocator) : allocatorInstance(allocator) {}
+
+template <typename T, typename ALLOCATOR>
+Colony<T, ALLOCATOR>::Colony(const Colony& other) : allocatorInstance(other.allocatorInstance) {
+    copyElementsFrom(other);
+}
+
+template <typename T, typename ALLOCATOR>
+Colony<T, ALLOCATOR>::Colony(Colony&& other)
+  : firstBlock(std::exchange(other.firstBlock, nullptr)),
+    lastBlock(std::exchange(other.lastBlock, nullptr)),
+    firstBlockWithHole(std::exchange(other.firstBlockWithHole, nullptr)),
+    elementCount(std::exchange(other.elementCount, 0)),
+    allocatorInstance(other.allocatorInstance) {}
+
+template <typename T, typename ALLOCATOR>
+Colony<T, ALLOCATOR>& Colony<T, ALLOCATOR>::operator=(const Colony& other) {
+    if(&other != this) {
+        clear();
+        copyElementsFrom(other);
+    }
+
+    return *this;
+}
+
+template <typename T, typename ALLOCATOR>
+Colony<T, ALLOCATOR>& Colony<T, ALLOCATOR>::operator=(Colony&& other) {
+    if(&other != this) {
+        releaseBlocks();
+
+        firstBlock         = std::exchange(other.firstBlock, nullptr);
+        lastBlock          = std::exchange(other.lastBlock, nullptr);
+        firstBlockWithHole = std::exchange(other.firstBlockWithHole, nullptr);
+        elementCount       = std::exchange(other.elementCount, 0);
+        allocatorInstance  = other.allocatorInstance;
+    }
+
+    return *this;
+}
+
+template <typename T, typename ALLOCATOR>
+Colony<T, ALLOCATOR>::~Colony() {
+    releaseBlocks();
+}
+
+template <typename T, typename ALLOCATOR>
+template <typename... ARGS>
+T& Colony<T, ALLOCATOR>::emplace(ARGS&&... args) {
+    Slot* slot = claimSlot();
+    T* element = std::construct_at(&slot->element, std::forward<ARGS>(args)...);
+    elementCount++;
+    return *element;
+}
+
+template <typename T, typename ALLOCATOR>
+T& Colony<T, ALLOCATOR>::insert(const T& element) {
+    return emplace(element);
+}
+
+template <typename T, typename ALLOCATOR>
+T& Colony<T, ALLOCATOR>::insert(T&& element) {
+    return emplace(std::move(element));
+}
+
+template <typename T, typename ALLOCATOR>
+typename Colony<T, ALLOCATOR>::iterator Colony<T, ALLOCATOR>::erase(const_iterator position) {
+    Block* block   = position.block;
+    SkipType index = position.index;
+    ASSERT(block != nullptr && index < block->highWater && block->skipfield[index] == 0);
+
+    iterator next(block, index);
+    ++next;
+
+    std::destroy_at(&block->slots[index].element);
+    elementCount--;
+    block->liveCount--;
+
+    if(block->liveCount == 0) {
+        unlinkBlock(block);
+        freeBlock(block);
+        return next;
+    }
+
+    // Only the ends of a run hold its length, and the neighbours of a slot that held an element can only be the end of
+    // the run before it or the start of the run after it
+    SkipType* skipfield = block->skipfield;
+    SkipType runBefore  = index > 0 ? skipfield[index - 1] : 0;
+    SkipType runAfter   = skipfield[index + 1];
+
+    if(runBefore == 0 && runAfter == 0) {
+        skipfield[index] = 1;
+        addRun(block, index);
+    } else if(runAfter == 0) {
+        SkipType start   = index - runBefore;
+        skipfield[start] = skipfield[index] = runBefore + 1;
+    } else if(runBefore == 0) {
+        SkipType end = index + runAfter;
+        moveRunStart(block, index + 1, index);
+        skipfield[index] = skipfield[end] = runAfter + 1;
+    } else {
+        SkipType start = index - runBefore;
+        SkipType end   = index + runAfter;
+        removeRun(block, index + 1);
+        skipfield[start] = skipfield[end] = runBefore + runAfter + 1;
+    }
+
+    return next;
+}
+
+template <typename T, typename ALLOCATOR>
+void Colony<T, ALLOCATOR>::erase(const T* element) {
+    erase(iteratorTo(element));
+}
+
+template <typename T, typename ALLOCATOR>
+typename Colony<T, ALLOCATOR>::iterator Colony<T, ALLOCATOR>::iteratorTo(const T* element) {
+    const Slot* slot = reinterpret_cast<const Slot*>(element);
+    for(Block* block = firstBlock; block != nullptr; block = block->next) {
+        if(std::less_equal<const Slot*>()(block->slots, slot) &&
+           std::less<const Slot*>()(slot, block->slots + block->highWater)) {
+            return iterator(block, static_cast<SkipType>(slot - block->slots));
+        }
+    }
+
+    ASSERT_WITH_MESSAGE(false, "Element is not in this colony");
+    return end();
+}
+
+template <typename T, typename ALLOCATOR>
+void Colony<T, ALLOCATOR>::clear() {
+    releaseBlocks();
+}
+
+template <typename T, typename ALLOCATOR>
+u64 Colony<T, ALLOCATOR>::count() const {
+    return elementCount;
+}
+
+template <typename T, typename ALLOCATOR>
+bool Colony<T, ALLOCATOR>::isEmpty() const {
+    return elementCount == 0;
+}
+
+template <typename T, typename ALLOCATOR>
+typename Colony<T, ALLOCATOR>::iterator Colony<T, ALLOCATOR>::begin() {
+    return firstBlock != nullptr ? iterator(firstBlock, firstBlock->skipfield[0]) : end();
+}
+
+template <typename T, typename ALLOCATOR>
+typename Colony<T, ALLOCATOR>::const_iterator Colony<T, ALLOCATOR>::begin() const {
+    return firstBlock != nullptr ? const_iterator(firstBlock, firstBlock->skipfield[0]) : end();
+}
+
+template <typename T, typename ALLOCATOR>
+typename Colony<T, ALLOCATOR>::iterator Colony<T, ALLOCATOR>::end() {
+    return iterator();
+}
+
+template <typename T, typename ALLOCATOR>
+typename Colony<T, ALLOCATOR>::const_iterator Colony<T, ALLOCATOR>::end() const {
+    return const_iterator();
+}
+
+template <typename T, typename ALLOCATOR>
+const ALLOCATOR& Colony<T, ALLOCATOR>::allocator() const {
+    return allocatorInstance;
+}
+
+template <typename T, typename ALLOCATOR>
+u64 Colony<T, ALLOCATOR>::SkipfieldOffset(u64 capacity) {
+    return SlotsOffset + capacity * sizeof(Slot);
+}
+
+template <typename T, typename ALLOCATOR>
+u64 Colony<T, ALLOCATOR>::BlockSize(u64 capacity) {
+    return SkipfieldOffset(capacity) + (capacity + 1) * sizeof(SkipType);
+}
+
+template <typename T, typename ALLOCATOR>
+typename Colony<T, ALLOCATOR>::Block* Colony<T, ALLOCATOR>::allocateBlock(u64 capacity) {
+    std::byte* memory =
+          reinterpret_cast<std::byte*>(allocatorInstance.allocate(BlockSize(capacity), alignof(std::max_align_t)));
+    Block* block     = new(memory) Block();
+    block->slots     = reinterpret_cast<Slot*>(memory + SlotsOffset);
+    block->skipfield = reinterpret_cast<SkipType*>(memory + SkipfieldOffset(capacity));
+    block->capacity  = static_cast<SkipType>(capacity);
+    std::memset(block->skipfield, 0, (capacity + 1) * sizeof(SkipType));
+
+    return block;
+}
+
+template <typename T, typename ALLOCATOR>
+void Colony<T, ALLOCATOR>::freeBlock(Block* block) {
+    allocatorInstance.deallocate(block, BlockSize(block->capacity));
+}
+
+template <typename T, typename ALLOCATOR>
+typename Colony<T, ALLOCATOR>::Slot* Colony<T, ALLOCATOR>::claimSlot() {
+    if(firstBlockWithHole != nullptr) {
+        // Reuse the first hole of a run, and the rest of the run becomes a run one shorter
+        Block* block    = firstBlockWithHole;
+        SkipType start  = block->firstFreeRun;
+        SkipType length = block->skipfield[start];
+
+        if(length > 1) {
+            moveRunStart(block, start, start + 1);
+            block->skipfield[start + 1] = block->skipfield[start + length - 1] = length - 1;
+        } else {
+            removeRun(block, start);
+        }
+
+        block->skipfield[start] = 0;
+        block->liveCount++;
+        return block->slots + start;
+    }
+
+    if(lastBlock == nullptr || lastBlock->highWater == lastBlock->capacity) {
+        u64 capacity = lastBlock != nullptr ? std::min<u64>(lastBlock->capacity * 2, MaxBlockCapacity)
+                                            : FirstBlockCapacity;
+        Block* block = allocateBlock(capacity);
+
+        block->previous = lastBlock;
+        if(lastBlock != nullptr) {
+            lastBlock->next = block;
+        } else {
+            firstBlock = block;
+        }
+        lastBlock = block;
+    }
+
+    lastBlock->liveCount++;
+    return lastBlock->slots + lastBlock->highWater++;
+}
+
+template <typename T, typename ALLOCATOR>
+void Colony<T, ALLOCATOR>::addRun(Block* block, SkipType start) {
+    bool hadHoles = block->firstFreeRun != NoFreeRun;
+
+    block->slots[start].freeRun = FreeRun{.previous = NoFreeRun, .next = block->firstFreeRun};
+    if(hadHoles) {
+        block->slots[block->firstFreeRun].freeRun.previous = start;
+    }
+    block->firstFreeRun = start;
+
+    if(!hadHoles) {
+        block->previousWithHoles = nullptr;
+        block->nextWithHoles     = firstBlockWithHole;
+        if(firstBlockWithHole != nullptr) {
+            firstBlockWithHole->previousWithHoles = block;
+        }
+        firstBlockWithHole = block;
+    }
+}
+
+template <typename T, typename ALLOCATOR>
+void Colony<T, ALLOCATOR>::removeRun(Block* block, SkipType start) {
+    FreeRun run = block->slots[start].freeRun;
+    if(run.previous != NoFreeRun) {
+        block->slots[run.previous].freeRun.next = run.next;
+    } else {
+        block->firstFreeRun = run.next;
+    }
+
+    if(run.next != NoFreeRun) {
+        block->slots[run.next].freeRun.previous = run.previous;
+    }
+
+    if(block->firstFreeRun == NoFreeRun) {
+        unlinkBlockWithHoles(block);
+    }
+}
+
+template <typename T, typename ALLOCATOR>
+void Colony<T, ALLOCATOR>::unlinkBlockWithHoles(Block* block) {
+    if(block->previousWithHoles != nullptr) {
+        block->previousWithHoles->nextWithHoles = block->nextWithHoles;
+    } else {
+        firstBlockWithHole = block->nextWithHoles;
+    }
+
+    if(block->nextWithHoles != nullptr) {
+        block->nextWithHoles->previousWithHoles = block->previousWithHoles;
+    }
+
+    block->nextWithHoles     = nullptr;
+    block->previousWithHoles = nullptr;
+}
+
+template <typename T, typename ALLOCATOR>
+void Colony<T, ALLOCATOR>::moveRunStart(Block* block, SkipType oldStart, SkipType newStart) {
+    FreeRun run                    = block->slots[oldStart].freeRun;
+    block->slots[newStart].freeRun = run;
+
+    if(run.previous != NoFreeRun) {
+        block->slots[run.previous].freeRun.next = newStart;
+    } else {
+        block->firstFreeRun = newStart;
+    }
+
+    if(run.next != NoFreeRun) {
+        block->slots[run.next].freeRun.previous = newStart;
+    }
+}
+
+template <typename T, typename ALLOCATOR>
+void Colony<T, ALLOCATOR>::unlinkBlock(Block* block) {
+    if(block->firstFreeRun != NoFreeRun) {
+        unlinkBlockWithHoles(block);
+    }
+
+    if(block->previous != nullptr) {
+        block->previous->next = block->next;
+    } else {
+        firstBlock = block->next;
+    }
+
+    if(block->next != nullptr) {
+        block->next->previous = block->previous;
+    } else {
+        lastBlock = block->previous;
+    }
+}
+
+template <typename T, typename ALLOCATOR>
+void Colony<T, ALLOCATOR>::copyElementsFrom(const Colony& other) {
+    for(const T& element : other) {
+        emplace(element);
+    }
+}
+
+template <typename T, typename ALLOCATOR>
+void Colony<T, ALLOCATOR>::releaseBlocks() {
+    if constexpr(!std::is_trivially_destructible_v<T>) {
+        for(T& element : *this) {
+            std::destroy_at(&element);
+        }
+    }
+
+    Block* block = firstBlock;
+    while(block != nullptr) {
+        Block* next = block->next;
+        freeBlock(block);
+        block = next;
+    }
+
+    firstBlock         = nullptr;
+    lastBlock          = nullptr;
+    firstBlockWithHole = nullptr;
+    elementCount       = 0;
+}
+
+}    // namespace Core
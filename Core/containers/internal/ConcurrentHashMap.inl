@@ -0,0 +1,173 @@
+#pragma once
+
+#include "core/containers/ConcurrentHashMap.h"
+
+#include <algorithm>
+#include <bit>
+#include <mutex>
+#include <utility>
+
+namespace Core {
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+ConcurrentHashMap<KEY, VALUE, HASHER, EQUALITY>::ConcurrentHashMap(u64 shardCount)
+  : shards(std::make_unique<Shard[]>(std::bit_ceil(std::max<u64>(shardCount, 1)))),
+    shardMask(std::bit_ceil(std::max<u64>(shardCount, 1)) - 1) {}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+template <typename FACTORY>
+VALUE ConcurrentHashMap<KEY, VALUE, HASHER, EQUALITY>::getOrInsert(const KEY& key, FACTORY&& create) {
+    Shard& shard = shardFor(key);
+
+    {
+        std::shared_lock lock(shard.lock);
+        auto existing = shard.map.find(key);
+        if(existing != shard.map.end()) {
+            return existing->second;
+        }
+    }
+
+    // Another thread may have inserted the key between the locks, in which case emplace keeps its value
+    std::unique_lock lock(shard.lock);
+    auto existing = shard.map.find(key);
+    if(existing != shard.map.end()) {
+        return existing->second;
+    }
+
+    return shard.map.emplace(key, create()).first->second;
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+std::optional<VALUE> ConcurrentHashMap<KEY, VALUE, HASHER, EQUALITY>::find(const KEY& key) const {
+    const Shard& shard = shardFor(key);
+    std::shared_lock lock(shard.lock);
+
+    auto existing = shard.map.find(key);
+    if(existing == shard.map.end()) {
+        return std::nullopt;
+    }
+
+    return existing->second;
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+bool ConcurrentHashMap<KEY, VALUE, HASHER, EQUALITY>::contains(const KEY& key) const {
+    const Shard& shard = shardFor(key);
+    std::shared_lock lock(shard.lock);
+    return shard.map.contains(key);
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+template <typename VISITOR>
+bool ConcurrentHashMap<KEY, VALUE, HASHER, EQUALITY>::visit(const KEY& key, VISITOR&& visitor) const {
+    const Shard& shard = shardFor(key);
+    std::shared_lock lock(shard.lock);
+
+    auto existing = shard.map.find(key);
+    if(existing == shard.map.end()) {
+        return false;
+    }
+
+    visitor(existing->second);
+    return true;
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+template <typename MODIFIER>
+void ConcurrentHashMap<KEY, VALUE, HASHER, EQUALITY>::upsert(const KEY& key, MODIFIER&& modifier) {
+    Shard& shard = shardFor(key);
+    std::unique_lock lock(shard.lock);
+    modifier(shard.map[key]);
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+bool ConcurrentHashMap<KEY, VALUE, HASHER, EQUALITY>::insert(const KEY& key, VALUE value) {
+    Shard& shard = shardFor(key);
+    std::unique_lock lock(shard.lock);
+    return shard.map.emplace(key, std::move(value)).second;
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+void ConcurrentHashMap<KEY, VALUE, HASHER, EQUALITY>::insertOrAssign(const KEY& key, VALUE value) {
+    Shard& shard = shardFor(key);
+    std::unique_lock lock(shard.lock);
+    shard.map.insertOrAssign(key, std::move(value));
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+bool ConcurrentHashMap<KEY, VALUE, HASHER, EQUALITY>::erase(const KEY& key) {
+    Shard& shard = shardFor(key);
+    std::unique_lock lock(shard.lock);
+    return shard.map.erase(key) > 0;
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+std::optional<VALUE> ConcurrentHashMap<KEY, VALUE, HASHER, EQUALITY>::extract(const KEY& key) {
+    Shard& shard = shardFor(key);
+    std::unique_lock lock(shard.lock);
+
+    auto existing = shard.map.find(key);
+    if(existing == shard.map.end()) {
+        return std::nullopt;
+    }
+
+    std::optional<VALUE> value(std::move(existing->second));
+    shard.map.erase(existing);
+    return value;
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+void ConcurrentHashMap<KEY, VALUE, HASHER, EQUALITY>::clear() {
+    for(u64 i = 0; i <= shardMask; i++) {
+        std::unique_lock lock(shards[i].lock);
+        shards[i].map.clear();
+    }
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+template <typename VISITOR>
+void ConcurrentHashMap<KEY, VALUE, HASHER, EQUALITY>::forEach(VISITOR&& visitor) const {
+    for(u64 i = 0; i <= shardMask; i++) {
+        std::shared_lock lock(shards[i].lock);
+        for(const auto& [key, value] : shards[i].map) {
+            visitor(key, value);
+        }
+    }
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+u64 ConcurrentHashMap<KEY, VALUE, HASHER, EQUALITY>::size() const {
+    u64 total = 0;
+    for(u64 i = 0; i <= shardMask; i++) {
+        std::shared_lock lock(shards[i].lock);
+        total += shards[i].map.size();
+    }
+
+    return total;
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+bool ConcurrentHashMap<KEY, VALUE, HASHER, EQUALITY>::empty() const {
+    return size() == 0;
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+u64 ConcurrentHashMap<KEY, VALUE, HASHER, EQUALITY>::shardCount() const {
+    return shardMask + 1;
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+typename ConcurrentHashMap<KEY, VALUE, HASHER, EQUALITY>::Shard&
+      ConcurrentHashMap<KEY, VALUE, HASHER, EQUALITY>::shardFor(const KEY& key) {
+    return const_cast<Shard&>(std::as_const(*this).shardFor(key));
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+const typename ConcurrentHashMap<KEY, VALUE, HASHER, EQUALITY>::Shard&
+      ConcurrentHashMap<KEY, VALUE, HASHER, EQUALITY>::shardFor(const KEY& key) const {
+    // The shard comes from the top bits, as the shard's own table picks slots and H2 tags from the bottom ones
+    u64 hash = internal::HashTable::MixHash(static_cast<u64>(hasherInstance(key)));
+    return shards[(hash >> 32) & shardMask];
+}
+
+}    // namespace Core
@@ -0,0 +1,594 @@
+#pragma once
+
+#include "core/containers/HashMap.h"
+
+#include <bit>
+#include <cstdlib>
+#include <cstring>
+#include <tuple>
+
+namespace Core::internal::HashTable {
+
+template <u64 SIGNIFICANT_BITS, u64 SHIFT>
+u64 GroupMask<SIGNIFICANT_BITS, SHIFT>::lowestMatch() const {
+    return trailingZeros();
+}
+
+template <u64 SIGNIFICANT_BITS, u64 SHIFT>
+u64 GroupMask<SIGNIFICANT_BITS, SHIFT>::trailingZeros() const {
+    return static_cast<u64>(std::countr_zero(mask)) >> SHIFT;
+}
+
+template <u64 SIGNIFICANT_BITS, u64 SHIFT>
+u64 GroupMask<SIGNIFICANT_BITS, SHIFT>::leadingZeros() const {
+    return static_cast<u64>(std::countl_zero(mask) - (64 - SIGNIFICANT_BITS)) >> SHIFT;
+}
+
+template <u64 SIGNIFICANT_BITS, u64 SHIFT>
+GroupMask<SIGNIFICANT_BITS, SHIFT>& GroupMask<SIGNIFICANT_BITS, SHIFT>::operator++() {
+    mask &= mask - 1;
+    return *this;
+}
+
+#if CORE_HASH_MAP_SSE2
+
+inline Group::Group(const ControlByte* controlBytes)
+  : controls(_mm_loadu_si128(reinterpret_cast<const __m128i*>(controlBytes))) {}
+
+inline Group::Mask Group::match(u8 h2) const {
+    __m128i matches = _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(h2)), controls);
+    return Mask{static_cast<u64>(_mm_movemask_epi8(matches))};
+}
+
+inline Group::Mask Group::matchEmpty() const {
+    __m128i matches = _mm_cmpeq_epi8(_mm_set1_epi8(Empty), controls);
+    return Mask{static_cast<u64>(_mm_movemask_epi8(matches))};
+}
+
+inline Group::Mask Group::matchEmptyOrDeleted() const {
+    __m128i matches = _mm_cmpgt_epi8(_mm_set1_epi8(Sentinel), controls);
+    return Mask{static_cast<u64>(_mm_movemask_epi8(matches))};
+}
+
+inline u64 Group::countLeadingEmptyOrDeleted() const {
+    return std::countr_one(static_cast<u32>(matchEmptyOrDeleted().mask));
+}
+
+#else
+
+constexpr u64 LeastSignificantBits = 0x0101010101010101ull;
+constexpr u64 MostSignificantBits  = 0x8080808080808080ull;
+
+inline Group::Group(const ControlByte* controlBytes) {
+    std::memcpy(&controls, controlBytes, sizeof(controls));
+}
+
+inline Group::Mask Group::match(u8 h2) const {
+    // This can report false positives when a byte borrows from its neighbour, but every match is confirmed by comparing
+    // keys so that only costs an extra comparison.
+    u64 difference = controls ^ (LeastSignificantBits * h2);
+    return Mask{(difference - LeastSignificantBits) & ~difference & MostSignificantBits};
+}
+
+inline Group::Mask Group::matchEmpty() const {
+    return Mask{(controls & (~controls << 6)) & MostSignificantBits};
+}
+
+inline Group::Mask Group::matchEmptyOrDeleted() const {
+    return Mask{(controls & (~controls << 7)) & MostSignificantBits};
+}
+
+inline u64 Group::countLeadingEmptyOrDeleted() const {
+    constexpr u64 gaps = 0x00FEFEFEFEFEFEFEull;
+    return (std::countr_zero(((~controls & (controls >> 7)) | gaps) + 1) + 7) >> 3;
+}
+
+#endif
+
+inline const ControlByte* EmptyGroup() {
+    alignas(16) static constexpr ControlByte group[16] = {
+          Sentinel, Empty, Empty, Empty, Empty, Empty, Empty, Empty,
+          Empty,    Empty, Empty, Empty, Empty, Empty, Empty, Empty,
+    };
+    return group;
+}
+
+inline u64 MixHash(u64 hash) {
+    // The finalizer from MurmurHash3
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ull;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+}    // namespace Core::internal::HashTable
+
+namespace Core {
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+template <bool IS_CONST>
+HashMap<KEY, VALUE, HASHER, EQUALITY>::Iterator<IS_CONST>::Iterator(const ControlByte* control, Slot* slot)
+  : control(control), slot(slot) {}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+template <bool IS_CONST>
+auto HashMap<KEY, VALUE, HASHER, EQUALITY>::Iterator<IS_CONST>::operator++() -> Iterator& {
+    control++;
+    slot++;
+    skipEmptyOrDeleted();
+    return *this;
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+template <bool IS_CONST>
+auto HashMap<KEY, VALUE, HASHER, EQUALITY>::Iterator<IS_CONST>::operator++(int) -> Iterator {
+    Iterator previous = *this;
+    ++*this;
+    return previous;
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+template <bool IS_CONST>
+void HashMap<KEY, VALUE, HASHER, EQUALITY>::Iterator<IS_CONST>::skipEmptyOrDeleted() {
+    // The sentinel is neither empty nor deleted, so this always stops at the end of the table
+    while(internal::HashTable::IsEmptyOrDeleted(*control)) {
+        u64 skipped = Group(control).countLeadingEmptyOrDeleted();
+        control += skipped;
+        slot += skipped;
+    }
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+HashMap<KEY, VALUE, HASHER, EQUALITY>::HashMap() = default;
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+HashMap<KEY, VALUE, HASHER, EQUALITY>::HashMap(u64 initialCapacity) {
+    reserve(initialCapacity);
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+HashMap<KEY, VALUE, HASHER, EQUALITY>::HashMap(std::initializer_list<value_type> initializerList) {
+    reserve(initializerList.size());
+    for(const value_type& value : initializerList) {
+        insert(value);
+    }
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+HashMap<KEY, VALUE, HASHER, EQUALITY>::HashMap(const HashMap& other)
+  : hasherInstance(other.hasherInstance), equalityInstance(other.equalityInstance) {
+    reserve(other.elementCount);
+    for(const value_type& value : other) {
+        insert(value);
+    }
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+HashMap<KEY, VALUE, HASHER, EQUALITY>::HashMap(HashMap&& other)
+  : controls(other.controls),
+    slots(other.slots),
+    elementCount(other.elementCount),
+    slotCapacity(other.slotCapacity),
+    growthLeft(other.growthLeft),
+    hasherInstance(std::move(other.hasherInstance)),
+    equalityInstance(std::move(other.equalityInstance)) {
+    other.controls     = const_cast<ControlByte*>(internal::HashTable::EmptyGroup());
+    other.slots        = nullptr;
+    other.elementCount = 0;
+    other.slotCapacity = 0;
+    other.growthLeft   = 0;
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+HashMap<KEY, VALUE, HASHER, EQUALITY>& HashMap<KEY, VALUE, HASHER, EQUALITY>::operator=(const HashMap& other) {
+    if(&other != this) {
+        *this = HashMap(other);
+    }
+
+    return *this;
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+HashMap<KEY, VALUE, HASHER, EQUALITY>& HashMap<KEY, VALUE, HASHER, EQUALITY>::operator=(HashMap&& other) {
+    if(&other != this) {
+        destroySlots();
+        if(slotCapacity > 0) {
+            free(controls);
+        }
+
+        controls         = other.controls;
+        slots            = other.slots;
+        elementCount     = other.elementCount;
+        slotCapacity     = other.slotCapacity;
+        growthLeft       = other.growthLeft;
+        hasherInstance   = std::move(other.hasherInstance);
+        equalityInstance = std::move(other.equalityInstance);
+
+        other.controls     = const_cast<ControlByte*>(internal::HashTable::EmptyGroup());
+        other.slots        = nullptr;
+        other.elementCount = 0;
+        other.slotCapacity = 0;
+        other.growthLeft   = 0;
+    }
+
+    return *this;
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+HashMap<KEY, VALUE, HASHER, EQUALITY>::~HashMap() {
+    destroySlots();
+    if(slotCapacity > 0) {
+        free(controls);
+    }
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+VALUE& HashMap<KEY, VALUE, HASHER, EQUALITY>::operator[](const KEY& key) {
+    return emplace(key).first->second;
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+VALUE& HashMap<KEY, VALUE, HASHER, EQUALITY>::operator[](KEY&& key) {
+    return emplace(std::move(key)).first->second;
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+VALUE& HashMap<KEY, VALUE, HASHER, EQUALITY>::at(const KEY& key) {
+    u64 index = findIndex(key, hash(key));
+    ASSERT_WITH_MESSAGE(index != slotCapacity, "Tried to access a key that is not in the map!");
+    return slots[index].value.second;
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+const VALUE& HashMap<KEY, VALUE, HASHER, EQUALITY>::at(const KEY& key) const {
+    u64 index = findIndex(key, hash(key));
+    ASSERT_WITH_MESSAGE(index != slotCapacity, "Tried to access a key that is not in the map!");
+    return slots[index].value.second;
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+auto HashMap<KEY, VALUE, HASHER, EQUALITY>::find(const KEY& key) -> iterator {
+    u64 index = findIndex(key, hash(key));
+    return iterator(controls + index, slots + index);
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+auto HashMap<KEY, VALUE, HASHER, EQUALITY>::find(const KEY& key) const -> const_iterator {
+    u64 index = findIndex(key, hash(key));
+    return const_iterator(controls + index, slots + index);
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+bool HashMap<KEY, VALUE, HASHER, EQUALITY>::contains(const KEY& key) const {
+    return findIndex(key, hash(key)) != slotCapacity;
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+u64 HashMap<KEY, VALUE, HASHER, EQUALITY>::count(const KEY& key) const {
+    return contains(key) ? 1 : 0;
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+template <typename K, typename... ARGS>
+auto HashMap<KEY, VALUE, HASHER, EQUALITY>::emplace(K&& key, ARGS&&... args) -> std::pair<iterator, bool> {
+    if constexpr(std::is_same_v<std::remove_cvref_t<K>, KEY>) {
+        auto [index, needsConstruction] = findOrPrepareInsert(key);
+        if(needsConstruction) {
+            std::construct_at(&slots[index].value,
+                              std::piecewise_construct,
+                              std::forward_as_tuple(std::forward<K>(key)),
+                              std::forward_as_tuple(std::forward<ARGS>(args)...));
+        }
+
+        return {iterator(controls + index, slots + index), needsConstruction};
+    } else {
+        return emplace(KEY(std::forward<K>(key)), std::forward<ARGS>(args)...);
+    }
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+auto HashMap<KEY, VALUE, HASHER, EQUALITY>::insert(const value_type& value) -> std::pair<iterator, bool> {
+    return emplace(value.first, value.second);
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+auto HashMap<KEY, VALUE, HASHER, EQUALITY>::insert(value_type&& value) -> std::pair<iterator, bool> {
+    return emplace(value.first, std::move(value.second));
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+template <typename V>
+auto HashMap<KEY, VALUE, HASHER, EQUALITY>::insertOrAssign(const KEY& key, V&& value) -> std::pair<iterator, bool> {
+    auto [index, needsConstruction] = findOrPrepareInsert(key);
+    if(needsConstruction) {
+        std::construct_at(&slots[index].value, key, std::forward<V>(value));
+    } else {
+        slots[index].value.second = std::forward<V>(value);
+    }
+
+    return {iterator(controls + index, slots + index), needsConstruction};
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+u64 HashMap<KEY, VALUE, HASHER, EQUALITY>::erase(const KEY& key) {
+    u64 index = findIndex(key, hash(key));
+    if(index == slotCapacity) {
+        return 0;
+    }
+
+    erase(const_iterator(controls + index, slots + index));
+    return 1;
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+void HashMap<KEY, VALUE, HASHER, EQUALITY>::erase(const_iterator position) {
+    ASSERT_WITH_MESSAGE(position != end(), "Tried to erase the end iterator of a map!");
+
+    u64 index = position.control - controls;
+    std::destroy_at(&slots[index].value);
+    elementCount--;
+
+    // If there has never been a full group around this slot then no probe sequence can have passed through it, so it
+    // can go back to being empty instead of leaving a tombstone behind.
+    u64 indexBefore   = (index - Group::Width) & slotCapacity;
+    auto emptyAfter   = Group(controls + index).matchEmpty();
+    auto emptyBefore  = Group(controls + indexBefore).matchEmpty();
+    bool wasNeverFull = emptyBefore && emptyAfter &&
+                        (emptyAfter.trailingZeros() + emptyBefore.leadingZeros()) < Group::Width;
+
+    setControl(index, wasNeverFull ? internal::HashTable::Empty : internal::HashTable::Deleted);
+    growthLeft += wasNeverFull ? 1 : 0;
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+void HashMap<KEY, VALUE, HASHER, EQUALITY>::clear() {
+    if(slotCapacity == 0) {
+        return;
+    }
+
+    destroySlots();
+
+    std::memset(controls, internal::HashTable::Empty, slotCapacity + Group::Width);
+    controls[slotCapacity] = internal::HashTable::Sentinel;
+
+    elementCount = 0;
+    growthLeft   = MaximumLoad(slotCapacity);
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+void HashMap<KEY, VALUE, HASHER, EQUALITY>::reserve(u64 elementCount) {
+    u64 requiredCapacity = CapacityForElementCount(elementCount);
+    if(requiredCapacity > slotCapacity) {
+        resize(requiredCapacity);
+    }
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+u64 HashMap<KEY, VALUE, HASHER, EQUALITY>::size() const {
+    return elementCount;
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+bool HashMap<KEY, VALUE, HASHER, EQUALITY>::empty() const {
+    return elementCount == 0;
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+u64 HashMap<KEY, VALUE, HASHER, EQUALITY>::capacity() const {
+    return slotCapacity;
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+auto HashMap<KEY, VALUE, HASHER, EQUALITY>::begin() -> iterator {
+    iterator it(controls, slots);
+    it.skipEmptyOrDeleted();
+    return it;
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+auto HashMap<KEY, VALUE, HASHER, EQUALITY>::begin() const -> const_iterator {
+    const_iterator it(controls, slots);
+    it.skipEmptyOrDeleted();
+    return it;
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+auto HashMap<KEY, VALUE, HASHER, EQUALITY>::end() -> iterator {
+    return iterator(controls + slotCapacity, slots + slotCapacity);
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+auto HashMap<KEY, VALUE, HASHER, EQUALITY>::end() const -> const_iterator {
+    return const_iterator(controls + slotCapacity, slots + slotCapacity);
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+bool HashMap<KEY, VALUE, HASHER, EQUALITY>::operator==(const HashMap& other) const {
+    if(elementCount != other.elementCount) {
+        return false;
+    }
+
+    for(const value_type& value : *this) {
+        auto otherValue = other.find(value.first);
+        if(otherValue == other.end() || !(otherValue->second == value.second)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+u64 HashMap<KEY, VALUE, HASHER, EQUALITY>::hash(const KEY& key) const {
+    return internal::HashTable::MixHash(static_cast<u64>(hasherInstance(key)));
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+u64 HashMap<KEY, VALUE, HASHER, EQUALITY>::h1(u64 hash) const {
+    // Salting with the allocation address keeps one table from inheriting another's clustering when its elements are
+    // inserted in iteration order.
+    return (hash >> 7) ^ (reinterpret_cast<uintptr_t>(controls) >> 12);
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+u8 HashMap<KEY, VALUE, HASHER, EQUALITY>::h2(u64 hash) {
+    return static_cast<u8>(hash & 0x7F);
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+u64 HashMap<KEY, VALUE, HASHER, EQUALITY>::findIndex(const KEY& key, u64 hash) const {
+    u64 offset     = h1(hash) & slotCapacity;
+    u64 probeIndex = 0;
+    while(true) {
+        Group group(controls + offset);
+        for(u64 match : group.match(h2(hash))) {
+            u64 index = (offset + match) & slotCapacity;
+            if(equalityInstance(slots[index].value.first, key)) [[likely]] {
+                return index;
+            }
+        }
+
+        if(group.matchEmpty()) [[likely]] {
+            return slotCapacity;
+        }
+
+        // Triangular probing over groups visits every group exactly once because the capacity is 2^n - 1
+        probeIndex += Group::Width;
+        offset = (offset + probeIndex) & slotCapacity;
+    }
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+u64 HashMap<KEY, VALUE, HASHER, EQUALITY>::findFirstNonFull(u64 hash) const {
+    u64 offset     = h1(hash) & slotCapacity;
+    u64 probeIndex = 0;
+    while(true) {
+        auto available = Group(controls + offset).matchEmptyOrDeleted();
+        if(available) [[likely]] {
+            return (offset + available.lowestMatch()) & slotCapacity;
+        }
+
+        probeIndex += Group::Width;
+        offset = (offset + probeIndex) & slotCapacity;
+    }
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+std::pair<u64, bool> HashMap<KEY, VALUE, HASHER, EQUALITY>::findOrPrepareInsert(const KEY& key) {
+    u64 keyHash = hash(key);
+    u64 index   = findIndex(key, keyHash);
+    if(index != slotCapacity) {
+        return {index, false};
+    }
+
+    index = findFirstNonFull(keyHash);
+
+    // Reusing a tombstone doesn't bring the table any closer to its maximum load
+    if(growthLeft == 0 && controls[index] != internal::HashTable::Deleted) [[unlikely]] {
+        rehashAndGrowIfNecessary();
+        index = findFirstNonFull(keyHash);
+    }
+
+    growthLeft -= controls[index] == internal::HashTable::Empty ? 1 : 0;
+    elementCount++;
+    setControl(index, h2(keyHash));
+
+    return {index, true};
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+void HashMap<KEY, VALUE, HASHER, EQUALITY>::setControl(u64 index, ControlByte value) {
+    // The first Width - 1 control bytes are mirrored after the sentinel so that a group can be loaded from any offset
+    // without wrapping around.
+    constexpr u64 clonedBytes = Group::Width - 1;
+
+    controls[index]                                                                 = value;
+    controls[((index - clonedBytes) & slotCapacity) + (clonedBytes & slotCapacity)] = value;
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+void HashMap<KEY, VALUE, HASHER, EQUALITY>::destroySlots() {
+    if constexpr(!std::is_trivially_destructible_v<value_type>) {
+        for(u64 i = 0; i < slotCapacity; i++) {
+            if(internal::HashTable::IsFull(controls[i])) {
+                std::destroy_at(&slots[i].value);
+            }
+        }
+    }
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+void HashMap<KEY, VALUE, HASHER, EQUALITY>::resize(u64 newCapacity) {
+    ASSERT(newCapacity >= MinimumCapacity && ((newCapacity + 1) & newCapacity) == 0);
+
+    ControlByte* oldControls = controls;
+    Slot* oldSlots           = slots;
+    u64 oldCapacity          = slotCapacity;
+
+    std::byte* memory = reinterpret_cast<std::byte*>(malloc(SlotOffset(newCapacity) + newCapacity * sizeof(Slot)));
+
+    controls     = reinterpret_cast<ControlByte*>(memory);
+    slots        = reinterpret_cast<Slot*>(memory + SlotOffset(newCapacity));
+    slotCapacity = newCapacity;
+    growthLeft   = MaximumLoad(newCapacity) - elementCount;
+
+    std::memset(controls, internal::HashTable::Empty, newCapacity + Group::Width);
+    controls[newCapacity] = internal::HashTable::Sentinel;
+
+    for(u64 i = 0; i < oldCapacity; i++) {
+        if(internal::HashTable::IsFull(oldControls[i])) {
+            u64 keyHash = hash(oldSlots[i].value.first);
+            u64 index   = findFirstNonFull(keyHash);
+            setControl(index, h2(keyHash));
+
+            std::construct_at(&slots[index].mutableValue, std::move(oldSlots[i].mutableValue));
+            std::destroy_at(&oldSlots[i].mutableValue);
+        }
+    }
+
+    if(oldCapacity > 0) {
+        free(oldControls);
+    }
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+void HashMap<KEY, VALUE, HASHER, EQUALITY>::rehashAndGrowIfNecessary() {
+    if(slotCapacity == 0) {
+        resize(MinimumCapacity);
+    } else if(elementCount <= MaximumLoad(slotCapacity) / 2) {
+        // Mostly tombstones, so clean them up without growing
+        resize(slotCapacity);
+    } else {
+        resize(slotCapacity * 2 + 1);
+    }
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+u64 HashMap<KEY, VALUE, HASHER, EQUALITY>::CapacityForElementCount(u64 elementCount) {
+    u64 capacity = MinimumCapacity;
+    while(MaximumLoad(capacity) < elementCount) {
+        capacity = capacity * 2 + 1;
+    }
+
+    return capacity;
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+u64 HashMap<KEY, VALUE, HASHER, EQUALITY>::MaximumLoad(u64 capacity) {
+    // Probing relies on there always being an empty slot, which 7/8ths of a 7 slot table would not leave
+    if(capacity == 7) {
+        return 6;
+    }
+
+    return capacity - capacity / 8;
+}
+
+template <typename KEY, typename VALUE, typename HASHER, typename EQUALITY>
+u64 HashMap<KEY, VALUE, HASHER, EQUALITY>::SlotOffset(u64 capacity) {
+    u64 controlBytes = capacity + Group::Width;
+    return (controlBytes + alignof(Slot) - 1) & ~(alignof(Slot) - 1);
+}
+
+}    // namespace Core
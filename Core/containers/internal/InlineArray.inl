@@ -0,0 +1,350 @@
+#pragma once
+
+#include "core/containers/InlineArray.h"
+
+#include "core/algorithms/Memory.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+namespace Core {
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::InlineArray() {}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::InlineArray(u64 initialCapacity) {
+    ensureCapacity(initialCapacity);
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::InlineArray(const ALLOCATOR& allocator) : allocatorInstance(allocator) {}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::InlineArray(Core::Span<T> elementsToCopy) {
+    insertAll(elementsToCopy);
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::InlineArray(const T& original, u64 repeatCount) {
+    ensureCapacity(repeatCount);
+    for(u64 i = 0; i < repeatCount; i++) {
+        emplace(original);
+    }
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::InlineArray(std::initializer_list<T> initializerList) {
+    insertAll(Core::ToSpan(initializerList));
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::InlineArray(const InlineArray& other)
+  : allocatorInstance(other.allocatorInstance) {
+    insertAll(Core::ToSpan(other));
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::InlineArray(InlineArray&& other)
+  : allocatorInstance(other.allocatorInstance) {
+    takeElementsFrom(other);
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+InlineArray<T, INLINE_CAPACITY, ALLOCATOR>& InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::operator=(const InlineArray& other) {
+    if(&other != this) {
+        clear();
+        insertAll(Core::ToSpan(other));
+    }
+
+    return *this;
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+InlineArray<T, INLINE_CAPACITY, ALLOCATOR>& InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::operator=(InlineArray&& other) {
+    if(&other != this) {
+        clear();
+        releaseHeapData();
+        allocatorInstance = other.allocatorInstance;
+        takeElementsFrom(other);
+    }
+
+    return *this;
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::~InlineArray() {
+    destructAllElements();
+    releaseHeapData();
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+T& InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::operator[](u64 i) {
+    ASSERT_WITH_MESSAGE(i < elementCount, "Index: {}, Count: {}", i, elementCount);
+    return *(data + i);
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+const T& InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::operator[](u64 i) const {
+    ASSERT_WITH_MESSAGE(i < elementCount, "Index: {}, Count: {}", i, elementCount);
+    return *(data + i);
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+template <typename... ARGS>
+T& InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::emplaceAt(u64 index, ARGS&&... args) {
+    ASSERT(index <= elementCount);
+
+    if(index < elementCount) {
+        shiftElementsRight(index, 1);
+    } else {
+        ensureCapacity(elementCount + 1);
+    }
+
+    T* newElement = std::construct_at(data + index, std::forward<ARGS>(args)...);
+    elementCount++;
+    return *newElement;
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+template <typename... ARGS>
+T& InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::emplace(ARGS&&... args) {
+    return emplaceAt(elementCount, std::forward<ARGS>(args)...);
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+T& InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::insertAt(u64 index, const T& elementToInsert) {
+    return emplaceAt(index, elementToInsert);
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+T& InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::insertAt(u64 index, T&& elementToInsert) {
+    if constexpr(std::is_move_constructible_v<T>) {
+        return emplaceAt(index, std::move(elementToInsert));
+    } else {
+        return emplaceAt(index, elementToInsert);
+    }
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+T& InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::insert(const T& elementToInsert) {
+    return emplace(elementToInsert);
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+T& InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::insert(T&& elementToInsert) {
+    if constexpr(std::is_move_constructible_v<T>) {
+        return emplace(std::forward<T>(elementToInsert));
+    } else {
+        return emplace(elementToInsert);
+    }
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+template <typename U>
+Core::Span<T> InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::insertAll(Core::Span<U> elements) {
+    ensureCapacity(elementCount + elements.count());
+    if constexpr(std::is_same_v<std::remove_cv_t<U>, T> && std::is_trivially_copyable_v<T>) {
+        std::memcpy(data + elementCount, elements.rawData(), elements.count() * ElementSize);
+    } else {
+        std::uninitialized_copy_n(elements.rawData(), elements.count(), end());
+    }
+
+    elementCount += elements.count();
+
+    return Core::Span<T>(data + elementCount - elements.count(), elements.count());
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+Core::Span<T> InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::insertUninitialized(u64 newElementCount) {
+    ensureCapacity(elementCount + newElementCount);
+    elementCount += newElementCount;
+
+    return Core::Span<T>(data + elementCount - newElementCount, newElementCount);
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+void InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::eraseAt(u64 index, u64 elementsToErase) {
+    shiftElementsLeft(index + elementsToErase, elementsToErase);
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+void InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::swapErase(u64 index) {
+    ASSERT_WITH_MESSAGE(index < elementCount, "Index: {}, Count: {}", index, elementCount);
+
+    u64 lastIndex = elementCount - 1;
+    if(index != lastIndex) {
+        if constexpr(Core::IsTriviallyRelocatable<T>) {
+            std::destroy_at(data + index);
+            Core::Algorithms::RelocateElements(data + lastIndex, data + index, 1);
+            elementCount--;
+            return;
+        }
+
+        Core::Algorithms::MoveElements(data + lastIndex, data + index, 1);
+    }
+
+    std::destroy_at(data + lastIndex);
+    elementCount--;
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+void InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::clear() {
+    destructAllElements();
+    elementCount = 0;
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+u64 InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::count() const {
+    return elementCount;
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+u64 InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::totalCapacity() const {
+    return capacity;
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+u64 InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::unusedCapacity() const {
+    return capacity - elementCount;
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+bool InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::isEmpty() const {
+    return elementCount == 0;
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+bool InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::isInline() const {
+    return data == reinterpret_cast<const T*>(inlineStorage);
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+T* InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::rawData() {
+    return data;
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+const T* InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::rawData() const {
+    return data;
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+T* InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::begin() {
+    return data;
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+const T* InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::begin() const {
+    return data;
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+T* InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::end() {
+    return data + elementCount;
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+const T* InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::end() const {
+    return data + elementCount;
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+void InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::ensureCapacity(u64 requiredCapacity) {
+    if(requiredCapacity <= capacity) {
+        return;
+    }
+
+    u64 newCapacity = capacity;
+    while(newCapacity < requiredCapacity) {
+        newCapacity =
+              std::max(static_cast<u64>(newCapacity * GrowthFactor), std::max(newCapacity + 1, MinimumCapacity));
+    }
+
+    T* newData = reinterpret_cast<T*>(allocatorInstance.allocate(newCapacity * ElementSize, alignof(T)));
+    Core::Algorithms::MoveElementsToUninitialized(data, newData, elementCount);
+
+    // Releasing the old block resets the capacity to the inline one, so the new capacity is only set afterwards
+    destructAllElements();
+    releaseHeapData();
+
+    data     = newData;
+    capacity = newCapacity;
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+const ALLOCATOR& InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::allocator() const {
+    return allocatorInstance;
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+T* InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::inlineData() {
+    return reinterpret_cast<T*>(inlineStorage);
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+void InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::destructAllElements() {
+    Core::Algorithms::DestroyElements(data, elementCount);
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+void InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::releaseHeapData() {
+    if(!isInline()) {
+        allocatorInstance.deallocate(data, capacity * ElementSize);
+        data     = inlineData();
+        capacity = INLINE_CAPACITY;
+    }
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+void InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::takeElementsFrom(InlineArray& other) {
+    ASSERT(isInline() && isEmpty());
+
+    if(other.isInline()) {
+        Core::Algorithms::MoveElementsToUninitialized(other.data, data, other.elementCount);
+        elementCount = other.elementCount;
+        other.clear();
+        return;
+    }
+
+    data         = other.data;
+    capacity     = other.capacity;
+    elementCount = other.elementCount;
+
+    other.data         = other.inlineData();
+    other.capacity     = INLINE_CAPACITY;
+    other.elementCount = 0;
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+void InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::shiftElementsLeft(u64 startIndex, u64 distance) {
+    ASSERT(distance <= startIndex);
+
+    T* source      = data + startIndex;
+    T* destination = source - distance;
+
+    Core::Algorithms::MoveElements(source, destination, elementCount - startIndex);
+
+    elementCount -= distance;
+    Core::Algorithms::DestroyElements(data + elementCount, distance);
+}
+
+template <typename T, u64 INLINE_CAPACITY, typename ALLOCATOR>
+void InlineArray<T, INLINE_CAPACITY, ALLOCATOR>::shiftElementsRight(u64 startIndex, u64 distance) {
+    ensureCapacity(elementCount + distance);
+
+    T* source      = data + startIndex;
+    T* destination = source + distance;
+    T* end         = data + elementCount;
+    u64 moveCount  = elementCount - startIndex;
+
+    // See Array::shiftElementsRight, the elements moved past the old end are constructed rather than assigned to
+    u64 constructCount = std::min(distance, moveCount);
+    Core::Algorithms::MoveElementsToUninitialized(
+          end - constructCount, end + distance - constructCount, constructCount);
+    Core::Algorithms::MoveElementsBackwards(source, destination, moveCount - constructCount);
+    Core::Algorithms::DestroyElements(source, constructCount);
+}
+
+}    // namespace Core
@@ -0,0 +1,164 @@
+#pragma once
+
+#include "core/containers/MPMCQueue.h"
+
+#include "core/assert/Assert.h"
+
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <utility>
+
+namespace Core {
+
+template <typename T>
+MPMCQueue<T>::MPMCQueue(u64 capacity) {
+    ASSERT_WITH_MESSAGE(capacity > 0, "A queue needs a capacity");
+
+    u64 roundedCapacity = std::bit_ceil(capacity);
+    slots = reinterpret_cast<Slot*>(
+          Core::Memory::MallocAllocator().allocate(roundedCapacity * sizeof(Slot), alignof(Slot)));
+    mask = roundedCapacity - 1;
+
+    // Slot i is first written at position i
+    for(u64 i = 0; i < roundedCapacity; i++) {
+        new(&slots[i].sequence) std::atomic<u64>(i);
+    }
+}
+
+template <typename T>
+MPMCQueue<T>::~MPMCQueue() {
+    u64 end = enqueuePosition.load(std::memory_order_relaxed);
+    for(u64 position = dequeuePosition.load(std::memory_order_relaxed); position != end; position++) {
+        std::destroy_at(slots[position & mask].element());
+    }
+
+    for(u64 i = 0; i < capacity(); i++) {
+        std::destroy_at(&slots[i].sequence);
+    }
+
+    Core::Memory::MallocAllocator().deallocate(slots, capacity() * sizeof(Slot));
+}
+
+template <typename T>
+template <typename... ARGS>
+bool MPMCQueue<T>::tryEmplace(ARGS&&... args) {
+    u64 claimCount = 1;
+    u64 position   = claim(enqueuePosition, 0, claimCount);
+    if(claimCount == 0) {
+        return false;
+    }
+
+    Slot& slot = slots[position & mask];
+    new(slot.storage) T(std::forward<ARGS>(args)...);
+    slot.sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+bool MPMCQueue<T>::tryPush(const T& element) {
+    return tryEmplace(element);
+}
+
+template <typename T>
+bool MPMCQueue<T>::tryPush(T&& element) {
+    return tryEmplace(std::move(element));
+}
+
+template <typename T>
+u64 MPMCQueue<T>::tryPushBatch(Core::Span<T> elements) {
+    u64 claimCount = elements.count();
+    u64 position   = claim(enqueuePosition, 0, claimCount);
+
+    for(u64 i = 0; i < claimCount; i++) {
+        Slot& slot = slots[(position + i) & mask];
+        new(slot.storage) T(std::move(elements[i]));
+        slot.sequence.store(position + i + 1, std::memory_order_release);
+    }
+
+    return claimCount;
+}
+
+template <typename T>
+std::optional<T> MPMCQueue<T>::tryPop() {
+    u64 claimCount = 1;
+    u64 position   = claim(dequeuePosition, 1, claimCount);
+    if(claimCount == 0) {
+        return std::nullopt;
+    }
+
+    Slot& slot = slots[position & mask];
+    std::optional<T> element(std::move(*slot.element()));
+    std::destroy_at(slot.element());
+
+    // Ready to be written again on the next trip around the ring
+    slot.sequence.store(position + mask + 1, std::memory_order_release);
+    return element;
+}
+
+template <typename T>
+u64 MPMCQueue<T>::tryPopBatch(Core::Span<T> destination) {
+    u64 claimCount = destination.count();
+    u64 position   = claim(dequeuePosition, 1, claimCount);
+
+    for(u64 i = 0; i < claimCount; i++) {
+        Slot& slot     = slots[(position + i) & mask];
+        destination[i] = std::move(*slot.element());
+        std::destroy_at(slot.element());
+        slot.sequence.store(position + i + mask + 1, std::memory_order_release);
+    }
+
+    return claimCount;
+}
+
+template <typename T>
+u64 MPMCQueue<T>::capacity() const {
+    return mask + 1;
+}
+
+template <typename T>
+u64 MPMCQueue<T>::approximateCount() const {
+    u64 end = enqueuePosition.load(std::memory_order_acquire);
+    return end - std::min(end, dequeuePosition.load(std::memory_order_acquire));
+}
+
+template <typename T>
+u64 MPMCQueue<T>::claim(std::atomic<u64>& position, u64 readyOffset, u64& maximumCount) {
+    u64 current = position.load(std::memory_order_relaxed);
+    while(maximumCount > 0) {
+        u64 firstSequence = slots[current & mask].sequence.load(std::memory_order_acquire);
+        i64 difference    = static_cast<i64>(firstSequence - (current + readyOffset));
+
+        if(difference < 0) {
+            // The slot still belongs to the previous trip around the ring, so the queue is full or empty
+            maximumCount = 0;
+            break;
+        }
+
+        if(difference > 0) {
+            // Another thread claimed this position first
+            current = position.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        // Nobody else can touch the ready slots after the first one until the position moves past them, so if the
+        // exchange succeeds they are all still ready
+        u64 readyCount = 1;
+        while(readyCount < maximumCount) {
+            u64 sequence = slots[(current + readyCount) & mask].sequence.load(std::memory_order_acquire);
+            if(sequence != current + readyCount + readyOffset) {
+                break;
+            }
+            readyCount++;
+        }
+
+        if(position.compare_exchange_weak(current, current + readyCount, std::memory_order_relaxed)) {
+            maximumCount = readyCount;
+            return current;
+        }
+    }
+
+    return current;
+}
+
+}    // namespace Core
@@ -0,0 +1,248 @@
+#pragma once
+
+#include "core/containers/OrderedMap.h"
+
+#include <algorithm>
+#include <tuple>
+
+namespace Core {
+
+template <typename KEY, typename VALUE, typename COMPARE>
+OrderedMap<KEY, VALUE, COMPARE>::OrderedMap(u64 initialCapacity) : sortedEntries(initialCapacity) {}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+OrderedMap<KEY, VALUE, COMPARE>::OrderedMap(std::initializer_list<value_type> initializerList) {
+    buildFrom(Core::ToSpan(initializerList));
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+void OrderedMap<KEY, VALUE, COMPARE>::buildFrom(Core::Span<const value_type> newEntries) {
+    sortedEntries.clear();
+    sortedEntries.insertAll(newEntries);
+    sortAndRemoveDuplicates();
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+void OrderedMap<KEY, VALUE, COMPARE>::buildFrom(Core::Array<value_type>&& newEntries) {
+    sortedEntries = std::move(newEntries);
+    sortAndRemoveDuplicates();
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+VALUE& OrderedMap<KEY, VALUE, COMPARE>::operator[](const KEY& key) {
+    return emplace(key).first->second;
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+VALUE& OrderedMap<KEY, VALUE, COMPARE>::at(const KEY& key) {
+    u64 index = lowerBoundIndex(key);
+    ASSERT_WITH_MESSAGE(isMatch(index, key), "Tried to access a key that is not in the map!");
+    return sortedEntries[index].second;
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+const VALUE& OrderedMap<KEY, VALUE, COMPARE>::at(const KEY& key) const {
+    u64 index = lowerBoundIndex(key);
+    ASSERT_WITH_MESSAGE(isMatch(index, key), "Tried to access a key that is not in the map!");
+    return sortedEntries[index].second;
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+auto OrderedMap<KEY, VALUE, COMPARE>::find(const KEY& key) -> iterator {
+    u64 index = lowerBoundIndex(key);
+    return isMatch(index, key) ? begin() + index : end();
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+auto OrderedMap<KEY, VALUE, COMPARE>::find(const KEY& key) const -> const_iterator {
+    u64 index = lowerBoundIndex(key);
+    return isMatch(index, key) ? begin() + index : end();
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+auto OrderedMap<KEY, VALUE, COMPARE>::lowerBound(const KEY& key) -> iterator {
+    return begin() + lowerBoundIndex(key);
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+auto OrderedMap<KEY, VALUE, COMPARE>::lowerBound(const KEY& key) const -> const_iterator {
+    return begin() + lowerBoundIndex(key);
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+auto OrderedMap<KEY, VALUE, COMPARE>::upperBound(const KEY& key) -> iterator {
+    u64 index = lowerBoundIndex(key);
+    return begin() + index + (isMatch(index, key) ? 1 : 0);
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+auto OrderedMap<KEY, VALUE, COMPARE>::upperBound(const KEY& key) const -> const_iterator {
+    u64 index = lowerBoundIndex(key);
+    return begin() + index + (isMatch(index, key) ? 1 : 0);
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+bool OrderedMap<KEY, VALUE, COMPARE>::contains(const KEY& key) const {
+    return isMatch(lowerBoundIndex(key), key);
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+u64 OrderedMap<KEY, VALUE, COMPARE>::count(const KEY& key) const {
+    return contains(key) ? 1 : 0;
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+template <typename... ARGS>
+auto OrderedMap<KEY, VALUE, COMPARE>::emplace(const KEY& key, ARGS&&... args) -> std::pair<iterator, bool> {
+    u64 index = lowerBoundIndex(key);
+    if(isMatch(index, key)) {
+        return {begin() + index, false};
+    }
+
+    sortedEntries.emplaceAt(index,
+                            std::piecewise_construct,
+                            std::forward_as_tuple(key),
+                            std::forward_as_tuple(std::forward<ARGS>(args)...));
+    return {begin() + index, true};
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+auto OrderedMap<KEY, VALUE, COMPARE>::insert(const value_type& value) -> std::pair<iterator, bool> {
+    return emplace(value.first, value.second);
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+auto OrderedMap<KEY, VALUE, COMPARE>::insert(value_type&& value) -> std::pair<iterator, bool> {
+    u64 index = lowerBoundIndex(value.first);
+    if(isMatch(index, value.first)) {
+        return {begin() + index, false};
+    }
+
+    sortedEntries.insertAt(index, std::move(value));
+    return {begin() + index, true};
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+template <typename V>
+auto OrderedMap<KEY, VALUE, COMPARE>::insertOrAssign(const KEY& key, V&& value) -> std::pair<iterator, bool> {
+    u64 index = lowerBoundIndex(key);
+    if(isMatch(index, key)) {
+        sortedEntries[index].second = std::forward<V>(value);
+        return {begin() + index, false};
+    }
+
+    sortedEntries.emplaceAt(index, key, std::forward<V>(value));
+    return {begin() + index, true};
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+u64 OrderedMap<KEY, VALUE, COMPARE>::erase(const KEY& key) {
+    u64 index = lowerBoundIndex(key);
+    if(!isMatch(index, key)) {
+        return 0;
+    }
+
+    sortedEntries.eraseAt(index);
+    return 1;
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+void OrderedMap<KEY, VALUE, COMPARE>::erase(const_iterator position) {
+    ASSERT_WITH_MESSAGE(position >= begin() && position < end(), "Tried to erase an iterator that is not in the map!");
+    sortedEntries.eraseAt(position - begin());
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+void OrderedMap<KEY, VALUE, COMPARE>::clear() {
+    sortedEntries.clear();
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+void OrderedMap<KEY, VALUE, COMPARE>::reserve(u64 elementCount) {
+    sortedEntries.ensureCapacity(elementCount);
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+u64 OrderedMap<KEY, VALUE, COMPARE>::size() const {
+    return sortedEntries.count();
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+bool OrderedMap<KEY, VALUE, COMPARE>::empty() const {
+    return sortedEntries.isEmpty();
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+auto OrderedMap<KEY, VALUE, COMPARE>::entries() const -> Core::Span<const value_type> {
+    return Core::ToSpan(sortedEntries);
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+auto OrderedMap<KEY, VALUE, COMPARE>::begin() -> iterator {
+    return sortedEntries.begin();
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+auto OrderedMap<KEY, VALUE, COMPARE>::begin() const -> const_iterator {
+    return sortedEntries.begin();
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+auto OrderedMap<KEY, VALUE, COMPARE>::end() -> iterator {
+    return sortedEntries.end();
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+auto OrderedMap<KEY, VALUE, COMPARE>::end() const -> const_iterator {
+    return sortedEntries.end();
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+bool OrderedMap<KEY, VALUE, COMPARE>::operator==(const OrderedMap& other) const {
+    return std::equal(begin(), end(), other.begin(), other.end());
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+u64 OrderedMap<KEY, VALUE, COMPARE>::lowerBoundIndex(const KEY& key) const {
+    u64 remaining = sortedEntries.count();
+    if(remaining == 0) {
+        return 0;
+    }
+
+    // Each step halves the candidate range without branching on the comparison, so the loop runs a fixed number of
+    // times for a given size and compiles to conditional moves instead of mispredicted jumps.
+    const value_type* base = sortedEntries.begin();
+    while(remaining > 1) {
+        u64 half = remaining / 2;
+        base     = compare(base[half].first, key) ? base + half : base;
+        remaining -= half;
+    }
+
+    return (base - sortedEntries.begin()) + (compare(base->first, key) ? 1 : 0);
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+bool OrderedMap<KEY, VALUE, COMPARE>::isMatch(u64 index, const KEY& key) const {
+    return index < sortedEntries.count() && !compare(key, sortedEntries[index].first);
+}
+
+template <typename KEY, typename VALUE, typename COMPARE>
+void OrderedMap<KEY, VALUE, COMPARE>::sortAndRemoveDuplicates() {
+    auto keyLess   = [&](const value_type& a, const value_type& b) { return compare(a.first, b.first); };
+    auto keysEqual = [&](const value_type& a, const value_type& b) {
+        return !compare(a.first, b.first) && !compare(b.first, a.first);
+    };
+
+    // Data that was serialized from another map is already sorted, so it's worth checking before sorting
+    if(!std::is_sorted(sortedEntries.begin(), sortedEntries.end(), keyLess)) {
+        std::stable_sort(sortedEntries.begin(), sortedEntries.end(), keyLess);
+    }
+
+    value_type* uniqueEnd = std::unique(sortedEntries.begin(), sortedEntries.end(), keysEqual);
+    u64 duplicateCount    = sortedEntries.end() - uniqueEnd;
+    if(duplicateCount > 0) {
+        sortedEntries.eraseAt(uniqueEnd - sortedEntries.begin(), duplicateCount);
+    }
+}
+
+}    // namespace Core
@@ -0,0 +1,298 @@
+#pragma once
+
+#include "core/containers/Queue.h"
+
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <utility>
+
+namespace Core {
+
+template <typename T, typename ALLOCATOR>
+Queue<T, ALLOCATOR>::Queue() {}
+
+template <typename T, typename ALLOCATOR>
+Queue<T, ALLOCATOR>::Queue(const ALLOCATOR& allocator) : allocatorInstance(allocator) {}
+
+template <typename T, typename ALLOCATOR>
+Queue<T, ALLOCATOR>::Queue(std::initializer_list<T> initializerList) {
+    ensureCapacity(initializerList.size());
+    for(const T& element : initializerList) {
+        pushBack(element);
+    }
+}
+
+template <typename T, typename ALLOCATOR>
+Queue<T, ALLOCATOR>::Queue(const Queue& other) : allocatorInstance(other.allocatorInstance) {
+    ensureCapacity(other.count());
+    for(const T& element : other) {
+        pushBack(element);
+    }
+}
+
+template <typename T, typename ALLOCATOR>
+Queue<T, ALLOCATOR>::Queue(Queue&& other)
+  : data(std::exchange(other.data, nullptr)),
+    capacity(std::exchange(other.capacity, 0)),
+    head(std::exchange(other.head, 0)),
+    elementCount(std::exchange(other.elementCount, 0)),
+    allocatorInstance(other.allocatorInstance) {}
+
+template <typename T, typename ALLOCATOR>
+Queue<T, ALLOCATOR>& Queue<T, ALLOCATOR>::operator=(const Queue& other) {
+    if(&other != this) {
+        clear();
+        ensureCapacity(other.count());
+        for(const T& element : other) {
+            pushBack(element);
+        }
+    }
+
+    return *this;
+}
+
+template <typename T, typename ALLOCATOR>
+Queue<T, ALLOCATOR>& Queue<T, ALLOCATOR>::operator=(Queue&& other) {
+    if(&other != this) {
+        clear();
+        releaseData();
+
+        data              = std::exchange(other.data, nullptr);
+        capacity          = std::exchange(other.capacity, 0);
+        head              = std::exchange(other.head, 0);
+        elementCount      = std::exchange(other.elementCount, 0);
+        allocatorInstance = other.allocatorInstance;
+    }
+
+    return *this;
+}
+
+template <typename T, typename ALLOCATOR>
+Queue<T, ALLOCATOR>::~Queue() {
+    clear();
+    releaseData();
+}
+
+template <typename T, typename ALLOCATOR>
+T& Queue<T, ALLOCATOR>::operator[](u64 i) {
+    ASSERT_WITH_MESSAGE(i < elementCount, "Index: {}, Count: {}", i, elementCount);
+    return *slot(i);
+}
+
+template <typename T, typename ALLOCATOR>
+const T& Queue<T, ALLOCATOR>::operator[](u64 i) const {
+    ASSERT_WITH_MESSAGE(i < elementCount, "Index: {}, Count: {}", i, elementCount);
+    return *slot(i);
+}
+
+template <typename T, typename ALLOCATOR>
+template <typename... ARGS>
+T& Queue<T, ALLOCATOR>::emplaceBack(ARGS&&... args) {
+    if(elementCount < capacity) {
+        T* element = new(slot(elementCount)) T(std::forward<ARGS>(args)...);
+        elementCount++;
+        return *element;
+    }
+
+    // args may refer to an element of this queue, so the new element is built before the old buffer is freed
+    u64 newCapacity = grownCapacity();
+    T* newData      = allocateData(newCapacity);
+    T* element      = new(newData + elementCount) T(std::forward<ARGS>(args)...);
+    adoptData(newData, newCapacity);
+    elementCount++;
+    return *element;
+}
+
+template <typename T, typename ALLOCATOR>
+template <typename... ARGS>
+T& Queue<T, ALLOCATOR>::emplaceFront(ARGS&&... args) {
+    if(elementCount < capacity) {
+        u64 newHead = (head - 1) & (capacity - 1);
+        T* element  = new(data + newHead) T(std::forward<ARGS>(args)...);
+        head        = newHead;
+        elementCount++;
+        return *element;
+    }
+
+    // Same as emplaceBack, the new element goes in the last slot of the new buffer and wraps around to the front
+    u64 newCapacity = grownCapacity();
+    T* newData      = allocateData(newCapacity);
+    T* element      = new(newData + newCapacity - 1) T(std::forward<ARGS>(args)...);
+    adoptData(newData, newCapacity);
+    head = newCapacity - 1;
+    elementCount++;
+    return *element;
+}
+
+template <typename T, typename ALLOCATOR>
+T& Queue<T, ALLOCATOR>::pushBack(const T& element) {
+    return emplaceBack(element);
+}
+
+template <typename T, typename ALLOCATOR>
+T& Queue<T, ALLOCATOR>::pushBack(T&& element) {
+    return emplaceBack(std::move(element));
+}
+
+template <typename T, typename ALLOCATOR>
+T& Queue<T, ALLOCATOR>::pushFront(const T& element) {
+    return emplaceFront(element);
+}
+
+template <typename T, typename ALLOCATOR>
+T& Queue<T, ALLOCATOR>::pushFront(T&& element) {
+    return emplaceFront(std::move(element));
+}
+
+template <typename T, typename ALLOCATOR>
+T Queue<T, ALLOCATOR>::popFront() {
+    ASSERT_WITH_MESSAGE(elementCount > 0, "Popping from an empty queue");
+
+    T* element = slot(0);
+    T value    = std::move(*element);
+    std::destroy_at(element);
+
+    head = (head + 1) & (capacity - 1);
+    elementCount--;
+    return value;
+}
+
+template <typename T, typename ALLOCATOR>
+T Queue<T, ALLOCATOR>::popBack() {
+    ASSERT_WITH_MESSAGE(elementCount > 0, "Popping from an empty queue");
+
+    T* element = slot(elementCount - 1);
+    T value    = std::move(*element);
+    std::destroy_at(element);
+
+    elementCount--;
+    return value;
+}
+
+template <typename T, typename ALLOCATOR>
+T& Queue<T, ALLOCATOR>::front() {
+    return (*this)[0];
+}
+
+template <typename T, typename ALLOCATOR>
+const T& Queue<T, ALLOCATOR>::front() const {
+    return (*this)[0];
+}
+
+template <typename T, typename ALLOCATOR>
+T& Queue<T, ALLOCATOR>::back() {
+    return (*this)[elementCount - 1];
+}
+
+template <typename T, typename ALLOCATOR>
+const T& Queue<T, ALLOCATOR>::back() const {
+    return (*this)[elementCount - 1];
+}
+
+template <typename T, typename ALLOCATOR>
+void Queue<T, ALLOCATOR>::clear() {
+    for(u64 i = 0; i < elementCount; i++) {
+        std::destroy_at(slot(i));
+    }
+
+    head         = 0;
+    elementCount = 0;
+}
+
+template <typename T, typename ALLOCATOR>
+u64 Queue<T, ALLOCATOR>::count() const {
+    return elementCount;
+}
+
+template <typename T, typename ALLOCATOR>
+u64 Queue<T, ALLOCATOR>::totalCapacity() const {
+    return capacity;
+}
+
+template <typename T, typename ALLOCATOR>
+bool Queue<T, ALLOCATOR>::isEmpty() const {
+    return elementCount == 0;
+}
+
+template <typename T, typename ALLOCATOR>
+typename Queue<T, ALLOCATOR>::iterator Queue<T, ALLOCATOR>::begin() {
+    return iterator(this, 0);
+}
+
+template <typename T, typename ALLOCATOR>
+typename Queue<T, ALLOCATOR>::const_iterator Queue<T, ALLOCATOR>::begin() const {
+    return const_iterator(this, 0);
+}
+
+template <typename T, typename ALLOCATOR>
+typename Queue<T, ALLOCATOR>::iterator Queue<T, ALLOCATOR>::end() {
+    return iterator(this, elementCount);
+}
+
+template <typename T, typename ALLOCATOR>
+typename Queue<T, ALLOCATOR>::const_iterator Queue<T, ALLOCATOR>::end() const {
+    return const_iterator(this, elementCount);
+}
+
+template <typename T, typename ALLOCATOR>
+void Queue<T, ALLOCATOR>::ensureCapacity(u64 requiredCapacity) {
+    if(requiredCapacity <= capacity) {
+        return;
+    }
+
+    u64 newCapacity = std::bit_ceil(std::max(requiredCapacity, MinimumCapacity));
+    adoptData(allocateData(newCapacity), newCapacity);
+}
+
+template <typename T, typename ALLOCATOR>
+const ALLOCATOR& Queue<T, ALLOCATOR>::allocator() const {
+    return allocatorInstance;
+}
+
+template <typename T, typename ALLOCATOR>
+T* Queue<T, ALLOCATOR>::slot(u64 i) {
+    return data + ((head + i) & (capacity - 1));
+}
+
+template <typename T, typename ALLOCATOR>
+const T* Queue<T, ALLOCATOR>::slot(u64 i) const {
+    return data + ((head + i) & (capacity - 1));
+}
+
+template <typename T, typename ALLOCATOR>
+u64 Queue<T, ALLOCATOR>::grownCapacity() const {
+    // Rounding up to the next power of two doubles the capacity
+    return std::bit_ceil(std::max(capacity + 1, MinimumCapacity));
+}
+
+template <typename T, typename ALLOCATOR>
+T* Queue<T, ALLOCATOR>::allocateData(u64 newCapacity) {
+    return reinterpret_cast<T*>(allocatorInstance.allocate(newCapacity * sizeof(T), alignof(T)));
+}
+
+template <typename T, typename ALLOCATOR>
+void Queue<T, ALLOCATOR>::adoptData(T* newData, u64 newCapacity) {
+    // Unwrap the ring while moving, so the front of the queue ends up at the start of the new buffer
+    for(u64 i = 0; i < elementCount; i++) {
+        T* element = slot(i);
+        new(newData + i) T(std::move(*element));
+        std::destroy_at(element);
+    }
+
+    releaseData();
+    data     = newData;
+    capacity = newCapacity;
+    head     = 0;
+}
+
+template <typename T, typename ALLOCATOR>
+void Queue<T, ALLOCATOR>::releaseData() {
+    if(data != nullptr) {
+        allocatorInstance.deallocate(data, capacity * sizeof(T));
+        data     = nullptr;
+        capacity = 0;
+    }
+}
+
+}    // namespace Core
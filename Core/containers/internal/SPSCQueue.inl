@@ -0,0 +1,127 @@
+#pragma once
+
+#include "core/containers/SPSCQueue.h"
+
+#include "core/assert/Assert.h"
+
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <utility>
+
+namespace Core {
+
+template <typename T>
+SPSCQueue<T>::SPSCQueue(u64 capacity) {
+    ASSERT_WITH_MESSAGE(capacity > 0, "A queue needs a capacity");
+
+    u64 roundedCapacity = std::bit_ceil(capacity);
+    slots = reinterpret_cast<T*>(Core::Memory::MallocAllocator().allocate(roundedCapacity * sizeof(T), alignof(T)));
+    mask  = roundedCapacity - 1;
+}
+
+template <typename T>
+SPSCQueue<T>::~SPSCQueue() {
+    u64 end = tail.load(std::memory_order_relaxed);
+    for(u64 position = head.load(std::memory_order_relaxed); position != end; position++) {
+        std::destroy_at(slots + (position & mask));
+    }
+
+    Core::Memory::MallocAllocator().deallocate(slots, capacity() * sizeof(T));
+}
+
+template <typename T>
+template <typename... ARGS>
+bool SPSCQueue<T>::tryEmplace(ARGS&&... args) {
+    u64 position = tail.load(std::memory_order_relaxed);
+    if(position - cachedHead > mask) {
+        cachedHead = head.load(std::memory_order_acquire);
+        if(position - cachedHead > mask) {
+            return false;
+        }
+    }
+
+    new(slots + (position & mask)) T(std::forward<ARGS>(args)...);
+    tail.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+bool SPSCQueue<T>::tryPush(const T& element) {
+    return tryEmplace(element);
+}
+
+template <typename T>
+bool SPSCQueue<T>::tryPush(T&& element) {
+    return tryEmplace(std::move(element));
+}
+
+template <typename T>
+u64 SPSCQueue<T>::tryPushBatch(Core::Span<T> elements) {
+    u64 position = tail.load(std::memory_order_relaxed);
+    u64 space    = capacity() - (position - cachedHead);
+    if(space < elements.count()) {
+        cachedHead = head.load(std::memory_order_acquire);
+        space      = capacity() - (position - cachedHead);
+    }
+
+    u64 pushCount = std::min(space, elements.count());
+    for(u64 i = 0; i < pushCount; i++) {
+        new(slots + ((position + i) & mask)) T(std::move(elements[i]));
+    }
+
+    // A single release publishes the whole batch
+    tail.store(position + pushCount, std::memory_order_release);
+    return pushCount;
+}
+
+template <typename T>
+std::optional<T> SPSCQueue<T>::tryPop() {
+    u64 position = head.load(std::memory_order_relaxed);
+    if(position == cachedTail) {
+        cachedTail = tail.load(std::memory_order_acquire);
+        if(position == cachedTail) {
+            return std::nullopt;
+        }
+    }
+
+    T* slot = slots + (position & mask);
+    std::optional<T> element(std::move(*slot));
+    std::destroy_at(slot);
+
+    head.store(position + 1, std::memory_order_release);
+    return element;
+}
+
+template <typename T>
+u64 SPSCQueue<T>::tryPopBatch(Core::Span<T> destination) {
+    u64 position  = head.load(std::memory_order_relaxed);
+    u64 available = cachedTail - position;
+    if(available < destination.count()) {
+        cachedTail = tail.load(std::memory_order_acquire);
+        available  = cachedTail - position;
+    }
+
+    u64 popCount = std::min(available, destination.count());
+    for(u64 i = 0; i < popCount; i++) {
+        T* slot        = slots + ((position + i) & mask);
+        destination[i] = std::move(*slot);
+        std::destroy_at(slot);
+    }
+
+    head.store(position + popCount, std::memory_order_release);
+    return popCount;
+}
+
+template <typename T>
+u64 SPSCQueue<T>::capacity() const {
+    return mask + 1;
+}
+
+template <typename T>
+u64 SPSCQueue<T>::approximateCount() const {
+    u64 end = tail.load(std::memory_order_acquire);
+    return end - std::min(end, head.load(std::memory_order_acquire));
+}
+
+}    // namespace Core
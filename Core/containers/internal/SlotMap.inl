@@ -0,0 +1,192 @@
+#pragma once
+
+#include "core/containers/SlotMap.h"
+
+#include <utility>
+
+namespace Core {
+
+template <typename T, typename ID>
+SlotMap<T, ID>::SlotMap(u64 initialCapacity)
+  : denseElements(initialCapacity), denseIDs(initialCapacity), slots(initialCapacity) {}
+
+template <typename T, typename ID>
+template <typename... ARGS>
+ID SlotMap<T, ID>::emplace(ARGS&&... args) {
+    BaseType slotIndex;
+    if(firstFreeSlot != EndOfFreeList) {
+        slotIndex     = firstFreeSlot;
+        firstFreeSlot = slots[slotIndex].denseIndexOrNextFree;
+    } else {
+        ASSERT_WITH_MESSAGE(slots.count() < EndOfFreeList, "Slot map is full with {} elements", slots.count());
+        slotIndex = static_cast<BaseType>(slots.count());
+        slots.emplace();
+    }
+
+    // The largest generation is skipped so that no ID can ever be equal to the invalid ID
+    Slot& slot                = slots[slotIndex];
+    slot.generation           = slot.generation + 1 == ID::MaxGeneration ? 1 : slot.generation + 1;
+    slot.denseIndexOrNextFree = static_cast<BaseType>(denseElements.count());
+
+    ID id = ID::FromIndexAndGeneration(slotIndex, slot.generation);
+    denseElements.emplace(std::forward<ARGS>(args)...);
+    denseIDs.insert(id);
+
+    return id;
+}
+
+template <typename T, typename ID>
+ID SlotMap<T, ID>::insert(const T& element) {
+    return emplace(element);
+}
+
+template <typename T, typename ID>
+ID SlotMap<T, ID>::insert(T&& element) {
+    return emplace(std::move(element));
+}
+
+template <typename T, typename ID>
+bool SlotMap<T, ID>::erase(ID id) {
+    if(liveSlot(id) == nullptr) {
+        return false;
+    }
+
+    BaseType slotIndex = id.index();
+    Slot& slot         = slots[slotIndex];
+    u64 denseIndex     = slot.denseIndexOrNextFree;
+    u64 lastIndex      = denseElements.count() - 1;
+
+    // Fill the gap with the last element so the elements stay packed
+    if(denseIndex != lastIndex) {
+        denseElements[denseIndex] = std::move(denseElements[lastIndex]);
+        denseIDs[denseIndex]      = denseIDs[lastIndex];
+
+        slots[denseIDs[denseIndex].index()].denseIndexOrNextFree = static_cast<BaseType>(denseIndex);
+    }
+
+    denseElements.eraseAt(lastIndex);
+    denseIDs.eraseAt(lastIndex);
+
+    slot.generation++;
+    slot.denseIndexOrNextFree = firstFreeSlot;
+    firstFreeSlot             = slotIndex;
+
+    return true;
+}
+
+template <typename T, typename ID>
+void SlotMap<T, ID>::clear() {
+    for(const ID& id : denseIDs) {
+        Slot& slot = slots[id.index()];
+        slot.generation++;
+        slot.denseIndexOrNextFree = firstFreeSlot;
+        firstFreeSlot             = id.index();
+    }
+
+    denseElements.clear();
+    denseIDs.clear();
+}
+
+template <typename T, typename ID>
+bool SlotMap<T, ID>::contains(ID id) const {
+    return liveSlot(id) != nullptr;
+}
+
+template <typename T, typename ID>
+T* SlotMap<T, ID>::find(ID id) {
+    const Slot* slot = liveSlot(id);
+    return slot != nullptr ? &denseElements[slot->denseIndexOrNextFree] : nullptr;
+}
+
+template <typename T, typename ID>
+const T* SlotMap<T, ID>::find(ID id) const {
+    const Slot* slot = liveSlot(id);
+    return slot != nullptr ? &denseElements[slot->denseIndexOrNextFree] : nullptr;
+}
+
+template <typename T, typename ID>
+T& SlotMap<T, ID>::operator[](ID id) {
+    T* element = find(id);
+    ASSERT_WITH_MESSAGE(element != nullptr, "No element with ID {}", id.value());
+    return *element;
+}
+
+template <typename T, typename ID>
+const T& SlotMap<T, ID>::operator[](ID id) const {
+    const T* element = find(id);
+    ASSERT_WITH_MESSAGE(element != nullptr, "No element with ID {}", id.value());
+    return *element;
+}
+
+template <typename T, typename ID>
+ID SlotMap<T, ID>::idAt(u64 denseIndex) const {
+    return denseIDs[denseIndex];
+}
+
+template <typename T, typename ID>
+Core::Span<T> SlotMap<T, ID>::elements() {
+    return Core::ToSpan(denseElements);
+}
+
+template <typename T, typename ID>
+Core::Span<const T> SlotMap<T, ID>::elements() const {
+    return Core::ToSpan(denseElements);
+}
+
+template <typename T, typename ID>
+Core::Span<const ID> SlotMap<T, ID>::ids() const {
+    return Core::ToSpan(denseIDs);
+}
+
+template <typename T, typename ID>
+u64 SlotMap<T, ID>::count() const {
+    return denseElements.count();
+}
+
+template <typename T, typename ID>
+bool SlotMap<T, ID>::isEmpty() const {
+    return denseElements.isEmpty();
+}
+
+template <typename T, typename ID>
+typename SlotMap<T, ID>::iterator SlotMap<T, ID>::begin() {
+    return denseElements.begin();
+}
+
+template <typename T, typename ID>
+typename SlotMap<T, ID>::const_iterator SlotMap<T, ID>::begin() const {
+    return denseElements.begin();
+}
+
+template <typename T, typename ID>
+typename SlotMap<T, ID>::iterator SlotMap<T, ID>::end() {
+    return denseElements.end();
+}
+
+template <typename T, typename ID>
+typename SlotMap<T, ID>::const_iterator SlotMap<T, ID>::end() const {
+    return denseElements.end();
+}
+
+template <typename T, typename ID>
+void SlotMap<T, ID>::ensureCapacity(u64 requiredCapacity) {
+    denseElements.ensureCapacity(requiredCapacity);
+    denseIDs.ensureCapacity(requiredCapacity);
+    slots.ensureCapacity(requiredCapacity);
+}
+
+template <typename T, typename ID>
+const typename SlotMap<T, ID>::Slot* SlotMap<T, ID>::liveSlot(ID id) const {
+    if(!id.isValid() || id.index() >= slots.count()) {
+        return nullptr;
+    }
+
+    const Slot& slot = slots[id.index()];
+    if(slot.generation != id.generation()) {
+        return nullptr;
+    }
+
+    return &slot;
+}
+
+}    // namespace Core
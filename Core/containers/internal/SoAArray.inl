@@ -0,0 +1,267 @@
+#pragma once
+
+#include "core/containers/SoAArray.h"
+
+#include "core/algorithms/Memory.h"
+
+#include <algorithm>
+#include <memory>
+
+namespace Core {
+
+template <typename ALLOCATOR, typename... Ts>
+BasicSoAArray<ALLOCATOR, Ts...>::BasicSoAArray(u64 initialCapacity) {
+    ensureCapacity(initialCapacity);
+}
+
+template <typename ALLOCATOR, typename... Ts>
+BasicSoAArray<ALLOCATOR, Ts...>::BasicSoAArray(const ALLOCATOR& allocator) : allocatorInstance(allocator) {}
+
+template <typename ALLOCATOR, typename... Ts>
+BasicSoAArray<ALLOCATOR, Ts...>::BasicSoAArray(const BasicSoAArray& other)
+  : allocatorInstance(other.allocatorInstance) {
+    copyElementsFrom(other);
+}
+
+template <typename ALLOCATOR, typename... Ts>
+BasicSoAArray<ALLOCATOR, Ts...>::BasicSoAArray(BasicSoAArray&& other)
+  : data(std::exchange(other.data, nullptr)),
+    columns(std::exchange(other.columns, Columns{})),
+    capacity(std::exchange(other.capacity, 0)),
+    elementCount(std::exchange(other.elementCount, 0)),
+    allocatorInstance(other.allocatorInstance) {}
+
+template <typename ALLOCATOR, typename... Ts>
+BasicSoAArray<ALLOCATOR, Ts...>& BasicSoAArray<ALLOCATOR, Ts...>::operator=(const BasicSoAArray& other) {
+    if(&other != this) {
+        clear();
+        copyElementsFrom(other);
+    }
+
+    return *this;
+}
+
+template <typename ALLOCATOR, typename... Ts>
+BasicSoAArray<ALLOCATOR, Ts...>& BasicSoAArray<ALLOCATOR, Ts...>::operator=(BasicSoAArray&& other) {
+    if(&other != this) {
+        destructAllElements();
+        releaseData();
+
+        data              = std::exchange(other.data, nullptr);
+        columns           = std::exchange(other.columns, Columns{});
+        capacity          = std::exchange(other.capacity, 0);
+        elementCount      = std::exchange(other.elementCount, 0);
+        allocatorInstance = other.allocatorInstance;
+    }
+
+    return *this;
+}
+
+template <typename ALLOCATOR, typename... Ts>
+BasicSoAArray<ALLOCATOR, Ts...>::~BasicSoAArray() {
+    destructAllElements();
+    releaseData();
+}
+
+template <typename ALLOCATOR, typename... Ts>
+template <typename... US>
+u64 BasicSoAArray<ALLOCATOR, Ts...>::emplace(US&&... values) requires(sizeof...(US) == ColumnCount) {
+    if(elementCount == capacity) {
+        ensureCapacity(std::max(static_cast<u64>(capacity * GrowthFactor), MinimumCapacity));
+    }
+
+    constructAt(elementCount, ColumnIndices(), std::forward<US>(values)...);
+    return elementCount++;
+}
+
+template <typename ALLOCATOR, typename... Ts>
+void BasicSoAArray<ALLOCATOR, Ts...>::eraseAt(u64 index) {
+    ASSERT_WITH_MESSAGE(index < elementCount, "Index: {}, Count: {}", index, elementCount);
+
+    u64 lastIndex = elementCount - 1;
+    std::apply([&](Ts*... columnData) { (EraseFromColumn(columnData, index, lastIndex), ...); }, columns);
+
+    elementCount--;
+}
+
+template <typename ALLOCATOR, typename... Ts>
+void BasicSoAArray<ALLOCATOR, Ts...>::resize(u64 newCount) {
+    if(newCount < elementCount) {
+        std::apply(
+              [&](Ts*... columnData) {
+                  (Core::Algorithms::DestroyElements(columnData + newCount, elementCount - newCount), ...);
+              },
+              columns);
+    } else if(newCount > elementCount) {
+        ensureCapacity(newCount);
+        std::apply(
+              [&](Ts*... columnData) {
+                  (std::uninitialized_value_construct(columnData + elementCount, columnData + newCount), ...);
+              },
+              columns);
+    }
+
+    elementCount = newCount;
+}
+
+template <typename ALLOCATOR, typename... Ts>
+void BasicSoAArray<ALLOCATOR, Ts...>::clear() {
+    destructAllElements();
+    elementCount = 0;
+}
+
+template <typename ALLOCATOR, typename... Ts>
+template <u64 COLUMN>
+Core::Span<typename BasicSoAArray<ALLOCATOR, Ts...>::template ColumnType<COLUMN>>
+BasicSoAArray<ALLOCATOR, Ts...>::column() {
+    return Core::Span<ColumnType<COLUMN>>(std::get<COLUMN>(columns), elementCount);
+}
+
+template <typename ALLOCATOR, typename... Ts>
+template <u64 COLUMN>
+Core::Span<const typename BasicSoAArray<ALLOCATOR, Ts...>::template ColumnType<COLUMN>>
+BasicSoAArray<ALLOCATOR, Ts...>::column() const {
+    return Core::Span<const ColumnType<COLUMN>>(std::get<COLUMN>(columns), elementCount);
+}
+
+template <typename ALLOCATOR, typename... Ts>
+template <u64 COLUMN>
+typename BasicSoAArray<ALLOCATOR, Ts...>::template ColumnType<COLUMN>& BasicSoAArray<ALLOCATOR, Ts...>::get(u64 index) {
+    ASSERT_WITH_MESSAGE(index < elementCount, "Index: {}, Count: {}", index, elementCount);
+    return std::get<COLUMN>(columns)[index];
+}
+
+template <typename ALLOCATOR, typename... Ts>
+template <u64 COLUMN>
+const typename BasicSoAArray<ALLOCATOR, Ts...>::template ColumnType<COLUMN>&
+BasicSoAArray<ALLOCATOR, Ts...>::get(u64 index) const {
+    ASSERT_WITH_MESSAGE(index < elementCount, "Index: {}, Count: {}", index, elementCount);
+    return std::get<COLUMN>(columns)[index];
+}
+
+template <typename ALLOCATOR, typename... Ts>
+u64 BasicSoAArray<ALLOCATOR, Ts...>::count() const {
+    return elementCount;
+}
+
+template <typename ALLOCATOR, typename... Ts>
+u64 BasicSoAArray<ALLOCATOR, Ts...>::totalCapacity() const {
+    return capacity;
+}
+
+template <typename ALLOCATOR, typename... Ts>
+bool BasicSoAArray<ALLOCATOR, Ts...>::isEmpty() const {
+    return elementCount == 0;
+}
+
+template <typename ALLOCATOR, typename... Ts>
+void BasicSoAArray<ALLOCATOR, Ts...>::ensureCapacity(u64 requiredCapacity) {
+    if(requiredCapacity <= capacity) {
+        return;
+    }
+
+    std::byte* newData =
+          reinterpret_cast<std::byte*>(allocatorInstance.allocate(AllocationSize(requiredCapacity), ColumnAlignment));
+    Columns newColumns = LayOutColumns(newData, requiredCapacity);
+
+    if(elementCount > 0) {
+        std::apply(
+              [&](Ts*... newColumnData) {
+                  std::apply(
+                        [&](Ts*... columnData) {
+                            (Core::Algorithms::MoveElementsToUninitialized(columnData, newColumnData, elementCount),
+                             ...);
+                            (Core::Algorithms::DestroyElements(columnData, elementCount), ...);
+                        },
+                        columns);
+              },
+              newColumns);
+    }
+
+    releaseData();
+    data     = newData;
+    columns  = newColumns;
+    capacity = requiredCapacity;
+}
+
+template <typename ALLOCATOR, typename... Ts>
+const ALLOCATOR& BasicSoAArray<ALLOCATOR, Ts...>::allocator() const {
+    return allocatorInstance;
+}
+
+template <typename ALLOCATOR, typename... Ts>
+u64 BasicSoAArray<ALLOCATOR, Ts...>::AllocationSize(u64 capacity) {
+    auto columnSize = [&](u64 elementSize) {
+        return (capacity * elementSize + ColumnAlignment - 1) & ~(ColumnAlignment - 1);
+    };
+    return (columnSize(sizeof(Ts)) + ...);
+}
+
+template <typename ALLOCATOR, typename... Ts>
+typename BasicSoAArray<ALLOCATOR, Ts...>::Columns
+BasicSoAArray<ALLOCATOR, Ts...>::LayOutColumns(std::byte* allocation, u64 capacity) {
+    std::byte* next = allocation;
+    auto place      = [&]<typename T>(T*) {
+        T* column = reinterpret_cast<T*>(next);
+        next += (capacity * sizeof(T) + ColumnAlignment - 1) & ~(ColumnAlignment - 1);
+        return column;
+    };
+
+    // Braced initialization evaluates left to right, so the columns are laid out in order
+    return Columns{place(static_cast<Ts*>(nullptr))...};
+}
+
+template <typename ALLOCATOR, typename... Ts>
+template <u64... COLUMNS, typename... US>
+void BasicSoAArray<ALLOCATOR, Ts...>::constructAt(u64 index, std::index_sequence<COLUMNS...>, US&&... values) {
+    (new(std::get<COLUMNS>(columns) + index) Ts(std::forward<US>(values)), ...);
+}
+
+template <typename ALLOCATOR, typename... Ts>
+template <typename T>
+void BasicSoAArray<ALLOCATOR, Ts...>::EraseFromColumn(T* column, u64 index, u64 lastIndex) {
+    if(index != lastIndex) {
+        column[index] = std::move(column[lastIndex]);
+    }
+    std::destroy_at(column + lastIndex);
+}
+
+template <typename ALLOCATOR, typename... Ts>
+void BasicSoAArray<ALLOCATOR, Ts...>::copyElementsFrom(const BasicSoAArray& other) {
+    if(other.elementCount == 0) {
+        return;
+    }
+
+    ensureCapacity(other.elementCount);
+
+    std::apply(
+          [&](const Ts*... otherColumnData) {
+              std::apply(
+                    [&](Ts*... columnData) {
+                        (std::uninitialized_copy(otherColumnData, otherColumnData + other.elementCount, columnData),
+                         ...);
+                    },
+                    columns);
+          },
+          Columns(other.columns));
+
+    elementCount = other.elementCount;
+}
+
+template <typename ALLOCATOR, typename... Ts>
+void BasicSoAArray<ALLOCATOR, Ts...>::destructAllElements() {
+    std::apply([&](Ts*... columnData) { (Core::Algorithms::DestroyElements(columnData, elementCount), ...); },
+               columns);
+}
+
+template <typename ALLOCATOR, typename... Ts>
+void BasicSoAArray<ALLOCATOR, Ts...>::releaseData() {
+    if(data != nullptr) {
+        allocatorInstance.deallocate(data, AllocationSize(capacity));
+    }
+    data     = nullptr;
+    columns  = Columns{};
+    capacity = 0;
+}
+
+}    // namespace Core
@@ -7,6 +7,8 @@
 #include "core/io/serialization/InputStream.h"
 #include "core/io/serialization/OutputStream.h"
 
+#include <memory>
+#include <string>
 #include <type_traits>
 
 struct Movable {
@@ -119,6 +121,29 @@ std::ostream& operator<<(std::ostream& stream, const ConstCopyMovable& i) {
     return stream << i.id;
 }
 
+// Counts its move constructions, which a relocatable type should never need when the array grows or shifts
+struct Relocatable {
+    static inline u64 MoveCount = 0;
+
+    std::unique_ptr<i32> id;
+    Relocatable(i32 id) : id(std::make_unique<i32>(id)) {}
+    Relocatable(Relocatable&& other) : id(std::move(other.id)) {
+        MoveCount++;
+    }
+    Relocatable& operator=(Relocatable&& other) = default;
+
+    bool operator==(const Relocatable& other) const {
+        return *other.id == *id;
+    }
+};
+
+template <>
+constexpr bool Core::IsTriviallyRelocatable<Relocatable> = true;
+
+std::ostream& operator<<(std::ostream& stream, const Relocatable& i) {
+    return stream << *i.id;
+}
+
 
 TEMPLATE_TEST_CASE("Insert Inline Move", "", Movable, CopyMovable, ConstCopyMovable) {
     Core::Array<TestType> array;
@@ -384,6 +409,20 @@ TEMPLATE_TEST_CASE("Insert At", "", u64, Movable, Copyable, ConstCopyable, CopyM
     REQUIRE(array[4] == TestType(3));
 }
 
+TEST_CASE("Insert At Owning Type") {
+    // Elements shifted past the old end must be constructed rather than assigned to
+    Core::Array<std::string> array{"a long string that does not fit in the small buffer", "b"};
+
+    array.insertAt(0, "c");
+    array.insertAt(3, "d");
+
+    REQUIRE(array.count() == 4);
+    REQUIRE(array[0] == "c");
+    REQUIRE(array[1] == "a long string that does not fit in the small buffer");
+    REQUIRE(array[2] == "b");
+    REQUIRE(array[3] == "d");
+}
+
 TEMPLATE_TEST_CASE("Emplace At", "", u64, Movable, ConstCopyMovable) {
     Core::Array<TestType> array;
 
@@ -420,6 +459,94 @@ TEMPLATE_TEST_CASE("Erase At", "", u64, Movable, Copyable, ConstCopyable, CopyMo
     REQUIRE(array[2] == TestType(3));
 }
 
+TEMPLATE_TEST_CASE(
+      "Swap Erase", "", u64, Movable, Copyable, ConstCopyable, CopyMovable, ConstCopyMovable, Relocatable) {
+    Core::Array<TestType> array;
+
+    array.insert(TestType(0));
+    array.insert(TestType(1));
+    array.insert(TestType(2));
+    array.insert(TestType(3));
+
+    array.swapErase(1);
+
+    REQUIRE(array.count() == 3);
+    REQUIRE(array[0] == TestType(0));
+    REQUIRE(array[1] == TestType(3));
+    REQUIRE(array[2] == TestType(2));
+
+    array.swapErase(2);
+
+    REQUIRE(array.count() == 2);
+    REQUIRE(array[0] == TestType(0));
+    REQUIRE(array[1] == TestType(3));
+}
+
+TEST_CASE("Trivially Relocatable Trait") {
+    STATIC_REQUIRE(Core::IsTriviallyRelocatable<u64>);
+    STATIC_REQUIRE(Core::IsTriviallyRelocatable<std::unique_ptr<std::string>>);
+    STATIC_REQUIRE(Core::IsTriviallyRelocatable<Core::Array<std::string>>);
+    STATIC_REQUIRE(!Core::IsTriviallyRelocatable<Movable>);
+}
+
+TEST_CASE("Relocatable Elements Are Not Moved") {
+    Relocatable::MoveCount = 0;
+
+    Core::Array<Relocatable> array;
+    for(i32 i = 0; i < 1000; i++) {
+        array.emplace(i);
+    }
+
+    array.emplaceAt(0, -1);
+    array.eraseAt(500, 10);
+    array.swapErase(0);
+
+    REQUIRE(Relocatable::MoveCount == 0);
+    REQUIRE(array.count() == 990);
+    REQUIRE(*array[0].id == 999);
+    for(i32 i = 1; i < 500; i++) {
+        REQUIRE(*array[i].id == i - 1);
+    }
+    for(i32 i = 500; i < 989; i++) {
+        REQUIRE(*array[i].id == i + 9);
+    }
+}
+
+TEST_CASE("Owning Elements Survive Shifts") {
+    Core::Array<std::unique_ptr<u64>> array;
+    for(u64 i = 0; i < 100; i++) {
+        array.insertAt(0, std::make_unique<u64>(i));
+    }
+
+    array.eraseAt(10, 20);
+    array.swapErase(5);
+
+    REQUIRE(array.count() == 79);
+    REQUIRE(*array[0] == 99);
+    REQUIRE(*array[5] == 0);
+    REQUIRE(*array[10] == 69);
+}
+
+TEST_CASE("Large Array Growth") {
+    // Large enough for the allocator to remap pages instead of copying on systems that support it
+    constexpr u64 ELEMENT_COUNT = 4 * 1024 * 1024;
+
+    Core::Array<u64, Core::Memory::RemappingAllocator> array;
+    for(u64 i = 0; i < ELEMENT_COUNT; i++) {
+        array.insert(i);
+    }
+
+    REQUIRE(array.count() == ELEMENT_COUNT);
+    for(u64 i = 0; i < ELEMENT_COUNT; i += 4099) {
+        REQUIRE(array[i] == i);
+    }
+    REQUIRE(array[ELEMENT_COUNT - 1] == ELEMENT_COUNT - 1);
+
+    Core::Array<u64, Core::Memory::RemappingAllocator> copy(array);
+    copy.insertAt(0, 7);
+    REQUIRE(copy[1] == 0);
+    REQUIRE(copy[ELEMENT_COUNT] == ELEMENT_COUNT - 1);
+}
 
 TEMPLATE_TEST_CASE("Clear", "", u64, Movable, Copyable, ConstCopyable, CopyMovable, ConstCopyMovable) {
     Core::Array<TestType> array;
@@ -0,0 +1,146 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/Types.h"
+#include "core/containers/Array.h"
+#include "core/containers/BitArray.h"
+#include "core/io/serialization/ArrayBuffer.h"
+#include "core/io/serialization/InputStream.h"
+#include "core/io/serialization/OutputStream.h"
+
+#include <random>
+#include <vector>
+
+TEST_CASE("Bit Array Set And Test") {
+    Core::BitArray bits(130);
+
+    REQUIRE(bits.count() == 130);
+    REQUIRE(bits.none());
+
+    bits.set(0);
+    bits.set(64);
+    bits.set(129, true);
+    bits.toggle(5);
+    bits.toggle(5);
+
+    REQUIRE(bits[0]);
+    REQUIRE(bits.test(64));
+    REQUIRE(bits[129]);
+    REQUIRE(!bits[5]);
+    REQUIRE(bits.countSet() == 3);
+
+    bits.reset(64);
+    REQUIRE(!bits[64]);
+    REQUIRE(bits.countSet() == 2);
+}
+
+TEST_CASE("Bit Array Resize") {
+    Core::BitArray bits(70, true);
+    REQUIRE(bits.countSet() == 70);
+
+    bits.resize(200, false);
+    REQUIRE(bits.countSet() == 70);
+    REQUIRE(!bits[70]);
+
+    bits.resize(250, true);
+    REQUIRE(bits.countSet() == 120);
+    REQUIRE(!bits[199]);
+    REQUIRE(bits[200]);
+
+    bits.resize(10);
+    REQUIRE(bits.countSet() == 10);
+
+    // Bits dropped by shrinking must not come back when growing again
+    bits.resize(100);
+    REQUIRE(bits.countSet() == 10);
+
+    bits.setAll();
+    REQUIRE(bits.countSet() == 100);
+    bits.resetAll();
+    REQUIRE(bits.none());
+
+    bits.clear();
+    REQUIRE(bits.isEmpty());
+}
+
+TEST_CASE("Bit Array Combines Bitwise") {
+    std::mt19937_64 random(3);
+
+    // Big enough for the vectorized loops and a scalar tail
+    constexpr u64 BIT_COUNT = 1000;
+    Core::BitArray a(BIT_COUNT);
+    Core::BitArray b(BIT_COUNT);
+    std::vector<bool> expectedA(BIT_COUNT);
+    std::vector<bool> expectedB(BIT_COUNT);
+
+    for(u64 i = 0; i < BIT_COUNT; i++) {
+        expectedA[i] = random() % 2;
+        expectedB[i] = random() % 3 == 0;
+        a.set(i, expectedA[i]);
+        b.set(i, expectedB[i]);
+    }
+
+    Core::BitArray andBits = a;
+    andBits &= b;
+    Core::BitArray orBits = a;
+    orBits |= b;
+    Core::BitArray xorBits = a;
+    xorBits ^= b;
+    Core::BitArray andNotBits = a;
+    andNotBits.andNot(b);
+
+    u64 expectedOrCount = 0;
+    for(u64 i = 0; i < BIT_COUNT; i++) {
+        REQUIRE(andBits[i] == (expectedA[i] && expectedB[i]));
+        REQUIRE(orBits[i] == (expectedA[i] || expectedB[i]));
+        REQUIRE(xorBits[i] == (expectedA[i] != expectedB[i]));
+        REQUIRE(andNotBits[i] == (expectedA[i] && !expectedB[i]));
+        expectedOrCount += expectedA[i] || expectedB[i];
+    }
+
+    REQUIRE(orBits.countSet() == expectedOrCount);
+    REQUIRE(a != b);
+    REQUIRE(andBits == andBits);
+}
+
+TEST_CASE("Bit Array Finds Set Bits") {
+    Core::BitArray bits(2000);
+    REQUIRE(bits.findFirstSet() == Core::BitArray::NotFound);
+
+    Core::Array<u64> setIndices = {3, 63, 64, 700, 1999};
+    for(u64 index : setIndices) {
+        bits.set(index);
+    }
+
+    Core::Array<u64> found;
+    for(u64 i = bits.findFirstSet(); i != Core::BitArray::NotFound; i = bits.findNextSet(i + 1)) {
+        found.insert(i);
+    }
+
+    Core::Array<u64> visited;
+    bits.forEachSetBit([&](u64 index) { visited.insert(index); });
+
+    REQUIRE(found.count() == setIndices.count());
+    REQUIRE(visited.count() == setIndices.count());
+    for(u64 i = 0; i < setIndices.count(); i++) {
+        REQUIRE(found[i] == setIndices[i]);
+        REQUIRE(visited[i] == setIndices[i]);
+    }
+
+    REQUIRE(bits.findNextSet(701) == 1999);
+    REQUIRE(bits.findNextSet(2000) == Core::BitArray::NotFound);
+}
+
+TEST_CASE("Bit Array Serialization") {
+    Core::BitArray bits(77);
+    bits.set(1);
+    bits.set(76);
+
+    Core::IO::ArrayBuffer buffer;
+    Core::IO::OutputStream out(&buffer);
+    out.write(bits);
+
+    Core::IO::InputStream in(&buffer);
+    Core::BitArray result = in.read<Core::BitArray>();
+
+    REQUIRE(result == bits);
+}
@@ -0,0 +1,166 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/Types.h"
+#include "core/containers/Array.h"
+#include "core/containers/Colony.h"
+
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+TEST_CASE("Colony Starts Empty") {
+    Core::Colony<u64> colony;
+
+    REQUIRE(colony.isEmpty());
+    REQUIRE(colony.count() == 0);
+    REQUIRE(colony.begin() == colony.end());
+}
+
+TEST_CASE("Colony Element Addresses Are Stable") {
+    Core::Colony<std::string> colony;
+
+    Core::Array<std::string*> pointers;
+    for(u64 i = 0; i < 10000; i++) {
+        pointers.insert(&colony.emplace(std::to_string(i)));
+    }
+
+    for(u64 i = 0; i < 10000; i += 2) {
+        colony.erase(pointers[i]);
+    }
+
+    for(u64 i = 0; i < 5000; i++) {
+        colony.emplace("new");
+    }
+
+    REQUIRE(colony.count() == 10000);
+    for(u64 i = 1; i < 10000; i += 2) {
+        REQUIRE(*pointers[i] == std::to_string(i));
+    }
+}
+
+TEST_CASE("Colony Iteration Skips Holes") {
+    Core::Colony<u64> colony;
+
+    Core::Array<u64*> pointers;
+    for(u64 i = 0; i < 100; i++) {
+        pointers.insert(&colony.insert(i));
+    }
+
+    // Erase a mix of single holes, runs and whole blocks, in an order that merges runs from both sides
+    for(u64 i : {0, 1, 5, 7, 6, 20, 22, 21, 23, 99, 98}) {
+        colony.erase(pointers[i]);
+    }
+    for(u64 i = 8; i < 16; i++) {
+        colony.erase(pointers[i]);
+    }
+
+    u64 expectedSum = 99 * 100 / 2;
+    for(u64 i : {0, 1, 5, 7, 6, 20, 22, 21, 23, 99, 98, 8, 9, 10, 11, 12, 13, 14, 15}) {
+        expectedSum -= i;
+    }
+
+    u64 sum     = 0;
+    u64 visited = 0;
+    for(u64 value : colony) {
+        sum += value;
+        visited++;
+    }
+
+    REQUIRE(visited == colony.count());
+    REQUIRE(visited == 81);
+    REQUIRE(sum == expectedSum);
+}
+
+TEST_CASE("Colony Erase Returns The Next Element") {
+    Core::Colony<u64> colony;
+    for(u64 i = 0; i < 50; i++) {
+        colony.insert(i);
+    }
+
+    for(auto it = colony.begin(); it != colony.end();) {
+        if(*it % 3 == 0) {
+            it = colony.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    REQUIRE(colony.count() == 33);
+    for(u64 value : colony) {
+        REQUIRE(value % 3 != 0);
+    }
+}
+
+TEST_CASE("Colony Reuses Holes") {
+    Core::Colony<u64> colony;
+
+    Core::Array<u64*> pointers;
+    for(u64 i = 0; i < 8; i++) {
+        pointers.insert(&colony.insert(i));
+    }
+
+    colony.erase(pointers[3]);
+    colony.erase(pointers[4]);
+
+    u64* first  = &colony.insert(100);
+    u64* second = &colony.insert(101);
+    REQUIRE(((first == pointers[3] && second == pointers[4]) || (first == pointers[4] && second == pointers[3])));
+}
+
+TEST_CASE("Colony Copy Move And Clear") {
+    std::shared_ptr<u64> shared = std::make_shared<u64>(1);
+
+    Core::Colony<std::shared_ptr<u64>> colony;
+    for(u64 i = 0; i < 20; i++) {
+        colony.insert(shared);
+    }
+    colony.erase(colony.begin());
+    REQUIRE(shared.use_count() == 20);
+
+    Core::Colony<std::shared_ptr<u64>> copy(colony);
+    REQUIRE(copy.count() == 19);
+    REQUIRE(shared.use_count() == 39);
+
+    Core::Colony<std::shared_ptr<u64>> moved(std::move(copy));
+    REQUIRE(copy.isEmpty());
+    REQUIRE(moved.count() == 19);
+
+    moved = colony;
+    REQUIRE(shared.use_count() == 39);
+
+    moved.clear();
+    colony.clear();
+    REQUIRE(shared.use_count() == 1);
+    REQUIRE(colony.begin() == colony.end());
+
+    colony.insert(shared);
+    REQUIRE(colony.count() == 1);
+}
+
+TEST_CASE("Colony Random Operations") {
+    Core::Colony<u64> colony;
+    std::unordered_map<u64*, u64> expected;
+    std::mt19937_64 random(5);
+
+    for(u64 i = 0; i < 50000; i++) {
+        if(random() % 5 < 3 || expected.empty()) {
+            u64* element = &colony.insert(i);
+            REQUIRE(expected.find(element) == expected.end());
+            expected[element] = i;
+        } else {
+            auto victim = std::next(expected.begin(), random() % std::min<u64>(expected.size(), 16));
+            colony.erase(victim->first);
+            expected.erase(victim);
+        }
+    }
+
+    REQUIRE(colony.count() == expected.size());
+
+    u64 visited = 0;
+    for(u64& value : colony) {
+        REQUIRE(expected.at(&value) == value);
+        visited++;
+    }
+    REQUIRE(visited == expected.size());
+}
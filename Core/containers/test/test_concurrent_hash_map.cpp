@@ -0,0 +1,128 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/Types.h"
+#include "core/containers/Array.h"
+#include "core/containers/ConcurrentHashMap.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+
+TEST_CASE("Concurrent Hash Map Single Thread") {
+    Core::ConcurrentHashMap<std::string, u64> map(5);
+
+    REQUIRE(map.shardCount() == 8);
+    REQUIRE(map.empty());
+    REQUIRE(!map.find("a").has_value());
+
+    REQUIRE(map.insert("a", 1));
+    REQUIRE(!map.insert("a", 2));
+    REQUIRE(map.find("a") == 1);
+
+    map.insertOrAssign("a", 3);
+    REQUIRE(map.find("a") == 3);
+
+    REQUIRE(map.getOrInsert("a", []() { return u64(4); }) == 3);
+    REQUIRE(map.getOrInsert("b", []() { return u64(5); }) == 5);
+    REQUIRE(map.contains("b"));
+    REQUIRE(map.size() == 2);
+
+    map.upsert("b", [](u64& value) { value++; });
+    map.upsert("c", [](u64& value) { value += 10; });
+    REQUIRE(map.find("b") == 6);
+    REQUIRE(map.find("c") == 10);
+
+    u64 visited = 0;
+    REQUIRE(map.visit("c", [&](const u64& value) { visited = value; }));
+    REQUIRE(!map.visit("d", [&](const u64& value) { visited = value; }));
+    REQUIRE(visited == 10);
+
+    REQUIRE(map.erase("a"));
+    REQUIRE(!map.erase("a"));
+    REQUIRE(map.size() == 2);
+
+    REQUIRE(map.extract("b") == 6);
+    REQUIRE(!map.extract("b"));
+    REQUIRE(map.size() == 1);
+
+    map.clear();
+    REQUIRE(map.empty());
+}
+
+TEST_CASE("Concurrent Hash Map For Each") {
+    Core::ConcurrentHashMap<u64, u64> map;
+    for(u64 i = 0; i < 1000; i++) {
+        map.insert(i, i * 2);
+    }
+
+    u64 count = 0;
+    map.forEach([&](const u64& key, const u64& value) {
+        REQUIRE(value == key * 2);
+        count++;
+    });
+    REQUIRE(count == 1000);
+}
+
+TEST_CASE("Concurrent Hash Map Get Or Insert Creates Once") {
+    const u64 threadCount = 8;
+    const u64 keyCount    = 2000;
+
+    Core::ConcurrentHashMap<u64, std::shared_ptr<u64>> map;
+    std::atomic<u64> created   = 0;
+    std::atomic<bool> allMatch = true;
+
+    Core::Array<std::thread> threads;
+    for(u64 t = 0; t < threadCount; t++) {
+        threads.emplace([&]() {
+            for(u64 i = 0; i < keyCount; i++) {
+                std::shared_ptr<u64> value = map.getOrInsert(i, [&]() {
+                    created++;
+                    return std::make_shared<u64>(i);
+                });
+                if(*value != i) {
+                    allMatch = false;
+                }
+            }
+        });
+    }
+    for(std::thread& thread : threads) {
+        thread.join();
+    }
+
+    REQUIRE(allMatch);
+    REQUIRE(created == keyCount);
+    REQUIRE(map.size() == keyCount);
+}
+
+TEST_CASE("Concurrent Hash Map Mixed Operations Across Threads") {
+    const u64 threadCount = 8;
+    const u64 iterations  = 20000;
+
+    Core::ConcurrentHashMap<u64, u64> map(4);
+    std::atomic<bool> allPositive = true;
+
+    Core::Array<std::thread> threads;
+    for(u64 t = 0; t < threadCount; t++) {
+        threads.emplace([&, t]() {
+            for(u64 i = 0; i < iterations; i++) {
+                u64 key = (i * 7 + t) % 512;
+                switch(i % 4) {
+                case 0: map.upsert(key, [](u64& value) { value++; }); break;
+                case 1: (void) map.find(key); break;
+                case 2: map.visit(key, [&](const u64& value) { allPositive = allPositive && value > 0; }); break;
+                case 3: map.upsert(key % 64, [](u64& value) { value++; }); break;
+                }
+            }
+        });
+    }
+    for(std::thread& thread : threads) {
+        thread.join();
+    }
+
+    REQUIRE(allPositive);
+
+    u64 total = 0;
+    map.forEach([&](const u64&, const u64& value) { total += value; });
+    REQUIRE(total == threadCount * iterations / 2);
+}
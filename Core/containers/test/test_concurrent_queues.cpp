@@ -0,0 +1,204 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/Types.h"
+#include "core/containers/Array.h"
+#include "core/containers/MPMCQueue.h"
+#include "core/containers/SPSCQueue.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+
+TEST_CASE("SPSC Queue Single Thread") {
+    Core::SPSCQueue<std::string> queue(3);
+
+    REQUIRE(queue.capacity() == 4);
+    REQUIRE(!queue.tryPop().has_value());
+
+    REQUIRE(queue.tryPush("a"));
+    REQUIRE(queue.tryPush("b"));
+    REQUIRE(queue.tryEmplace(3, 'c'));
+    REQUIRE(queue.tryPush("d"));
+    REQUIRE(!queue.tryPush("e"));
+    REQUIRE(queue.approximateCount() == 4);
+
+    REQUIRE(queue.tryPop() == "a");
+    REQUIRE(queue.tryPush("e"));
+
+    REQUIRE(queue.tryPop() == "b");
+    REQUIRE(queue.tryPop() == "ccc");
+    REQUIRE(queue.tryPop() == "d");
+    REQUIRE(queue.tryPop() == "e");
+    REQUIRE(!queue.tryPop().has_value());
+}
+
+TEST_CASE("SPSC Queue Batches") {
+    Core::SPSCQueue<u64> queue(8);
+
+    Core::Array<u64> input{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    REQUIRE(queue.tryPushBatch(Core::ToSpan(input)) == 8);
+
+    Core::Array<u64> output(0, 5);
+    REQUIRE(queue.tryPopBatch(Core::ToSpan(output)) == 5);
+    for(u64 i = 0; i < 5; i++) {
+        REQUIRE(output[i] == i);
+    }
+
+    REQUIRE(queue.tryPushBatch(Core::ToSpan(input).subspan(8, 2)) == 2);
+    REQUIRE(queue.tryPopBatch(Core::ToSpan(output)) == 5);
+    for(u64 i = 0; i < 5; i++) {
+        REQUIRE(output[i] == i + 5);
+    }
+}
+
+TEST_CASE("SPSC Queue Destroys Remaining Elements") {
+    std::shared_ptr<u64> shared = std::make_shared<u64>(0);
+    {
+        Core::SPSCQueue<std::shared_ptr<u64>> queue(4);
+        REQUIRE(queue.tryPush(shared));
+        REQUIRE(queue.tryPush(shared));
+        REQUIRE(shared.use_count() == 3);
+    }
+    REQUIRE(shared.use_count() == 1);
+}
+
+TEST_CASE("SPSC Queue Across Threads") {
+    const u64 elementCount = 200000;
+    Core::SPSCQueue<u64> queue(64);
+
+    std::thread producer([&]() {
+        Core::Array<u64> batch;
+        for(u64 i = 0; i < elementCount;) {
+            if(i % 3 == 0) {
+                if(queue.tryPush(i)) {
+                    i++;
+                }
+            } else {
+                batch.clear();
+                for(u64 j = i; j < std::min(i + 7, elementCount); j++) {
+                    batch.insert(j);
+                }
+                i += queue.tryPushBatch(Core::ToSpan(batch));
+            }
+        }
+    });
+
+    bool inOrder = true;
+    u64 expected = 0;
+    Core::Array<u64> batch(0, 5);
+    while(expected < elementCount) {
+        u64 popped = queue.tryPopBatch(Core::ToSpan(batch));
+        for(u64 i = 0; i < popped; i++) {
+            inOrder = inOrder && batch[i] == expected;
+            expected++;
+        }
+    }
+
+    producer.join();
+    REQUIRE(inOrder);
+    REQUIRE(!queue.tryPop().has_value());
+}
+
+TEST_CASE("MPMC Queue Single Thread") {
+    Core::MPMCQueue<std::string> queue(4);
+
+    REQUIRE(queue.capacity() == 4);
+    REQUIRE(!queue.tryPop().has_value());
+
+    for(u64 round = 0; round < 3; round++) {
+        REQUIRE(queue.tryPush("a"));
+        REQUIRE(queue.tryPush("b"));
+        REQUIRE(queue.tryEmplace(2, 'c'));
+        REQUIRE(queue.tryPush("d"));
+        REQUIRE(!queue.tryPush("e"));
+
+        REQUIRE(queue.tryPop() == "a");
+        REQUIRE(queue.tryPop() == "b");
+        REQUIRE(queue.tryPop() == "cc");
+        REQUIRE(queue.tryPop() == "d");
+        REQUIRE(!queue.tryPop().has_value());
+    }
+}
+
+TEST_CASE("MPMC Queue Batches") {
+    Core::MPMCQueue<u64> queue(8);
+
+    Core::Array<u64> input{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    REQUIRE(queue.tryPushBatch(Core::ToSpan(input)) == 8);
+    REQUIRE(queue.approximateCount() == 8);
+
+    Core::Array<u64> output(0, 3);
+    REQUIRE(queue.tryPopBatch(Core::ToSpan(output)) == 3);
+    REQUIRE(output[0] == 0);
+    REQUIRE(output[2] == 2);
+
+    REQUIRE(queue.tryPushBatch(Core::ToSpan(input).subspan(8, 2)) == 2);
+
+    Core::Array<u64> rest(0, 10);
+    REQUIRE(queue.tryPopBatch(Core::ToSpan(rest)) == 7);
+    for(u64 i = 0; i < 7; i++) {
+        REQUIRE(rest[i] == i + 3);
+    }
+}
+
+TEST_CASE("MPMC Queue Across Threads") {
+    const u64 producerCount       = 4;
+    const u64 consumerCount       = 4;
+    const u64 elementsPerProducer = 50000;
+
+    Core::MPMCQueue<u64> queue(128);
+    std::atomic<u64> consumedCount = 0;
+    std::atomic<u64> consumedSum   = 0;
+
+    Core::Array<std::thread> threads;
+    for(u64 producer = 0; producer < producerCount; producer++) {
+        threads.emplace([&, producer]() {
+            Core::Array<u64> batch;
+            u64 next = producer * elementsPerProducer;
+            u64 end  = next + elementsPerProducer;
+            while(next < end) {
+                if(next % 2 == 0) {
+                    if(queue.tryPush(next)) {
+                        next++;
+                    }
+                } else {
+                    batch.clear();
+                    for(u64 j = next; j < std::min(next + 4, end); j++) {
+                        batch.insert(j);
+                    }
+                    next += queue.tryPushBatch(Core::ToSpan(batch));
+                }
+            }
+        });
+    }
+
+    for(u64 consumer = 0; consumer < consumerCount; consumer++) {
+        threads.emplace([&, consumer]() {
+            Core::Array<u64> batch(0, 3);
+            while(consumedCount.load() < producerCount * elementsPerProducer) {
+                if(consumer % 2 == 0) {
+                    if(std::optional<u64> value = queue.tryPop()) {
+                        consumedSum += *value;
+                        consumedCount++;
+                    }
+                } else {
+                    u64 popped = queue.tryPopBatch(Core::ToSpan(batch));
+                    for(u64 i = 0; i < popped; i++) {
+                        consumedSum += batch[i];
+                    }
+                    consumedCount += popped;
+                }
+            }
+        });
+    }
+
+    for(std::thread& thread : threads) {
+        thread.join();
+    }
+
+    const u64 total = producerCount * elementsPerProducer;
+    REQUIRE(consumedCount == total);
+    REQUIRE(consumedSum == total * (total - 1) / 2);
+}
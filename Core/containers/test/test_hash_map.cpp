@@ -0,0 +1,175 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/Types.h"
+#include "core/containers/HashMap.h"
+#include "core/io/serialization/ArrayBuffer.h"
+#include "core/io/serialization/InputStream.h"
+#include "core/io/serialization/OutputStream.h"
+
+#include <string>
+#include <unordered_map>
+
+TEST_CASE("Empty Map") {
+    Core::HashMap<u64, u64> map;
+
+    REQUIRE(map.size() == 0);
+    REQUIRE(map.empty());
+    REQUIRE(map.capacity() == 0);
+    REQUIRE(map.begin() == map.end());
+    REQUIRE(map.find(4) == map.end());
+    REQUIRE(!map.contains(4));
+    REQUIRE(map.erase(4) == 0);
+}
+
+TEST_CASE("Insert And Find") {
+    Core::HashMap<u64, u64> map;
+
+    auto [inserted, wasInserted] = map.emplace(1, 10);
+    REQUIRE(wasInserted);
+    REQUIRE(inserted->first == 1);
+    REQUIRE(inserted->second == 10);
+
+    auto [existing, wasInsertedAgain] = map.emplace(1, 20);
+    REQUIRE(!wasInsertedAgain);
+    REQUIRE(existing->second == 10);
+
+    REQUIRE(map.size() == 1);
+    REQUIRE(map.contains(1));
+    REQUIRE(map.count(1) == 1);
+    REQUIRE(map.at(1) == 10);
+    REQUIRE(map.find(2) == map.end());
+}
+
+TEST_CASE("Subscript Inserts Default") {
+    Core::HashMap<std::string, u64> map;
+
+    REQUIRE(map["a"] == 0);
+    map["a"] = 5;
+    map["b"]++;
+
+    REQUIRE(map.size() == 2);
+    REQUIRE(map["a"] == 5);
+    REQUIRE(map["b"] == 1);
+}
+
+TEST_CASE("Insert Or Assign") {
+    Core::HashMap<u64, std::string> map;
+
+    REQUIRE(map.insertOrAssign(1, "one").second);
+    REQUIRE(!map.insertOrAssign(1, "uno").second);
+    REQUIRE(map.at(1) == "uno");
+}
+
+TEST_CASE("Growth Keeps Every Element") {
+    constexpr u64 ELEMENT_COUNT = 10000;
+
+    Core::HashMap<u64, u64> map;
+    for(u64 i = 0; i < ELEMENT_COUNT; i++) {
+        map[i] = i * 2;
+    }
+
+    REQUIRE(map.size() == ELEMENT_COUNT);
+    for(u64 i = 0; i < ELEMENT_COUNT; i++) {
+        REQUIRE(map.contains(i));
+        REQUIRE(map.at(i) == i * 2);
+    }
+    REQUIRE(!map.contains(ELEMENT_COUNT));
+}
+
+TEST_CASE("Iteration Visits Every Element Once") {
+    constexpr u64 ELEMENT_COUNT = 1000;
+
+    Core::HashMap<u64, u64> map;
+    for(u64 i = 0; i < ELEMENT_COUNT; i++) {
+        map.emplace(i, i);
+    }
+
+    std::unordered_map<u64, u64> visits;
+    for(const auto& [key, value] : map) {
+        REQUIRE(key == value);
+        visits[key]++;
+    }
+
+    REQUIRE(visits.size() == ELEMENT_COUNT);
+    for(const auto& [key, count] : visits) {
+        REQUIRE(count == 1);
+    }
+}
+
+TEST_CASE("Erase") {
+    Core::HashMap<std::string, u64> map{{"a", 1}, {"b", 2}, {"c", 3}};
+
+    REQUIRE(map.erase("b") == 1);
+    REQUIRE(map.erase("b") == 0);
+    REQUIRE(map.size() == 2);
+    REQUIRE(!map.contains("b"));
+
+    map.erase(map.find("a"));
+    REQUIRE(map.size() == 1);
+    REQUIRE(map.at("c") == 3);
+}
+
+TEST_CASE("Erase And Reinsert Many Times") {
+    // Repeatedly filling the table with tombstones must not grow it without bound
+    Core::HashMap<u64, u64> map;
+    for(u64 round = 0; round < 100; round++) {
+        for(u64 i = 0; i < 100; i++) {
+            map.emplace(round * 100 + i, i);
+        }
+        for(u64 i = 0; i < 100; i++) {
+            REQUIRE(map.erase(round * 100 + i) == 1);
+        }
+    }
+
+    REQUIRE(map.empty());
+    REQUIRE(map.capacity() < 1024);
+}
+
+TEST_CASE("Clear") {
+    Core::HashMap<u64, std::string> map{{1, "a"}, {2, "b"}};
+
+    map.clear();
+    REQUIRE(map.empty());
+    REQUIRE(map.begin() == map.end());
+
+    map[3] = "c";
+    REQUIRE(map.size() == 1);
+}
+
+TEST_CASE("Copy And Move") {
+    Core::HashMap<std::string, std::string> map{{"a", "1"}, {"b", "2"}};
+
+    Core::HashMap<std::string, std::string> copy(map);
+    REQUIRE(copy == map);
+
+    copy["c"] = "3";
+    REQUIRE(map.size() == 2);
+    REQUIRE(copy.size() == 3);
+
+    Core::HashMap<std::string, std::string> moved(std::move(copy));
+    REQUIRE(moved.size() == 3);
+    REQUIRE(copy.empty());
+
+    copy = moved;
+    REQUIRE(copy == moved);
+
+    map = std::move(moved);
+    REQUIRE(map.size() == 3);
+    REQUIRE(map.at("c") == "3");
+}
+
+TEST_CASE("Serialize Hash Map") {
+    Core::HashMap<u64, std::string> map;
+    for(u64 i = 0; i < 100; i++) {
+        map[i] = std::to_string(i);
+    }
+
+    Core::IO::ArrayBuffer buffer;
+    Core::IO::OutputStream out(&buffer);
+    out.write(map);
+
+    Core::IO::InputStream in(&buffer);
+    Core::HashMap<u64, std::string> result = in.read<Core::HashMap<u64, std::string>>();
+
+    REQUIRE(result == map);
+}
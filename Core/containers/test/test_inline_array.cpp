@@ -0,0 +1,179 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/Types.h"
+#include "core/containers/Array.h"
+#include "core/containers/InlineArray.h"
+#include "core/io/serialization/ArrayBuffer.h"
+#include "core/io/serialization/InputStream.h"
+#include "core/io/serialization/OutputStream.h"
+
+#include <string>
+
+TEST_CASE("Inline Array Starts Inline") {
+    Core::InlineArray<u64, 4> array;
+
+    REQUIRE(array.count() == 0);
+    REQUIRE(array.isEmpty());
+    REQUIRE(array.isInline());
+    REQUIRE(array.totalCapacity() == 4);
+}
+
+TEST_CASE("Inline Array Spills To Heap") {
+    Core::InlineArray<u64, 2> array;
+
+    array.insert(0);
+    array.insert(1);
+    REQUIRE(array.isInline());
+
+    array.insert(2);
+    REQUIRE(!array.isInline());
+    REQUIRE(array.totalCapacity() >= 3);
+
+    // Grows through several heap reallocations, which must keep the capacity ahead of the count
+    u64 reallocations = 0;
+    for(u64 i = 3; i < 100; i++) {
+        const u64* oldData = array.rawData();
+        array.emplace(i);
+        if(array.rawData() != oldData) {
+            reallocations++;
+        }
+
+        REQUIRE(array.totalCapacity() >= array.count());
+        REQUIRE(array.unusedCapacity() == array.totalCapacity() - array.count());
+    }
+    REQUIRE(reallocations >= 3);
+    REQUIRE(reallocations < 20);
+
+    REQUIRE(array.count() == 100);
+    for(u64 i = 0; i < 100; i++) {
+        REQUIRE(array[i] == i);
+    }
+}
+
+TEST_CASE("Inline Array Insert And Erase") {
+    Core::InlineArray<std::string, 3> array{"a", "b"};
+
+    array.insertAt(0, "c");
+    REQUIRE(array.isInline());
+
+    array.insertAt(1, "a string long enough to need its own allocation");
+    REQUIRE(!array.isInline());
+
+    REQUIRE(array.count() == 4);
+    REQUIRE(array[0] == "c");
+    REQUIRE(array[1] == "a string long enough to need its own allocation");
+    REQUIRE(array[2] == "a");
+    REQUIRE(array[3] == "b");
+
+    array.eraseAt(0, 2);
+    REQUIRE(array.count() == 2);
+    REQUIRE(array[0] == "a");
+    REQUIRE(array[1] == "b");
+}
+
+TEST_CASE("Inline Array Swap Erase") {
+    Core::InlineArray<std::string, 4> array{"a", "b", "c"};
+
+    array.swapErase(0);
+    REQUIRE(array.count() == 2);
+    REQUIRE(array[0] == "c");
+    REQUIRE(array[1] == "b");
+
+    array.swapErase(1);
+    REQUIRE(array.count() == 1);
+    REQUIRE(array[0] == "c");
+
+    Core::InlineArray<u64, 2> spilled{0, 1, 2, 3, 4};
+    REQUIRE(!spilled.isInline());
+
+    spilled.swapErase(1);
+    REQUIRE(spilled.count() == 4);
+    REQUIRE(spilled[0] == 0);
+    REQUIRE(spilled[1] == 4);
+    REQUIRE(spilled[2] == 2);
+    REQUIRE(spilled[3] == 3);
+}
+
+TEST_CASE("Inline Array Insert All And Uninitialized") {
+    Core::InlineArray<u32, 4> array;
+    Core::Array<u32> source{1, 2, 3};
+
+    Core::Span<u32> inserted = array.insertAll(Core::ToSpan(source));
+    REQUIRE(inserted.count() == 3);
+    REQUIRE(array.isInline());
+
+    Core::Span<u32> uninitialized = array.insertUninitialized(2);
+    uninitialized[0]              = 4;
+    uninitialized[1]              = 5;
+
+    REQUIRE(array.count() == 5);
+    Core::Span<const u32> span = Core::ToSpan(static_cast<const Core::InlineArray<u32, 4>&>(array));
+    for(u64 i = 0; i < span.count(); i++) {
+        REQUIRE(span[i] == i + 1);
+    }
+}
+
+TEST_CASE("Inline Array Copy And Move") {
+    Core::InlineArray<std::string, 2> small{"a"};
+    Core::InlineArray<std::string, 2> large{"a", "b", "c"};
+
+    SECTION("Copy") {
+        Core::InlineArray<std::string, 2> smallCopy(small);
+        Core::InlineArray<std::string, 2> largeCopy(large);
+
+        REQUIRE(smallCopy.isInline());
+        REQUIRE(smallCopy.count() == 1);
+        REQUIRE(largeCopy.count() == 3);
+        REQUIRE(largeCopy[2] == "c");
+
+        smallCopy = largeCopy;
+        REQUIRE(smallCopy.count() == 3);
+        REQUIRE(largeCopy.count() == 3);
+    }
+
+    SECTION("Move Inline") {
+        Core::InlineArray<std::string, 2> moved(std::move(small));
+
+        REQUIRE(moved.isInline());
+        REQUIRE(moved.count() == 1);
+        REQUIRE(moved[0] == "a");
+        REQUIRE(small.isEmpty());
+    }
+
+    SECTION("Move Heap") {
+        const std::string* elements = large.rawData();
+        Core::InlineArray<std::string, 2> moved(std::move(large));
+
+        REQUIRE(moved.rawData() == elements);
+        REQUIRE(moved.count() == 3);
+        REQUIRE(large.isEmpty());
+        REQUIRE(large.isInline());
+
+        large = std::move(moved);
+        REQUIRE(large.rawData() == elements);
+        REQUIRE(moved.isEmpty());
+
+        moved = std::move(small);
+        REQUIRE(moved.count() == 1);
+        REQUIRE(moved.isInline());
+    }
+}
+
+TEST_CASE("Inline Array Serialization Matches Array") {
+    Core::InlineArray<u32, 2> trivial{1, 2, 3};
+    Core::InlineArray<std::string, 2> nonTrivial{"a", "b"};
+
+    Core::IO::ArrayBuffer buffer;
+    Core::IO::OutputStream out(&buffer);
+    out.write(trivial);
+    out.write(nonTrivial);
+
+    Core::IO::InputStream in(&buffer);
+    Core::Array<u32> trivialResult                     = in.read<Core::Array<u32>>();
+    Core::InlineArray<std::string, 2> nonTrivialResult = in.read<Core::InlineArray<std::string, 2>>();
+
+    REQUIRE(trivialResult.count() == 3);
+    REQUIRE(trivialResult[2] == 3);
+    REQUIRE(nonTrivialResult.count() == 2);
+    REQUIRE(nonTrivialResult[1] == "b");
+}
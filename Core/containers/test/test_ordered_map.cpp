@@ -0,0 +1,127 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/Types.h"
+#include "core/containers/OrderedMap.h"
+#include "core/io/serialization/ArrayBuffer.h"
+#include "core/io/serialization/InputStream.h"
+#include "core/io/serialization/OutputStream.h"
+
+#include <map>
+#include <string>
+
+TEST_CASE("Empty Ordered Map") {
+    Core::OrderedMap<u64, u64> map;
+
+    REQUIRE(map.size() == 0);
+    REQUIRE(map.empty());
+    REQUIRE(map.begin() == map.end());
+    REQUIRE(map.find(4) == map.end());
+    REQUIRE(map.lowerBound(4) == map.end());
+    REQUIRE(!map.contains(4));
+    REQUIRE(map.erase(4) == 0);
+}
+
+TEST_CASE("Ordered Insert And Find") {
+    Core::OrderedMap<u64, u64> map;
+
+    auto [inserted, wasInserted] = map.emplace(5, 50);
+    REQUIRE(wasInserted);
+    REQUIRE(inserted->first == 5);
+    REQUIRE(inserted->second == 50);
+
+    auto [existing, wasInsertedAgain] = map.emplace(5, 60);
+    REQUIRE(!wasInsertedAgain);
+    REQUIRE(existing->second == 50);
+
+    map.insert({1, 10});
+    map[3] = 30;
+
+    REQUIRE(map.size() == 3);
+    REQUIRE(map.at(1) == 10);
+    REQUIRE(map.at(3) == 30);
+    REQUIRE(map.count(5) == 1);
+    REQUIRE(map.find(2) == map.end());
+    REQUIRE(!map.insertOrAssign(3, 33).second);
+    REQUIRE(map.at(3) == 33);
+}
+
+TEST_CASE("Iteration Is In Key Order") {
+    Core::OrderedMap<u64, u64> map;
+    std::map<u64, u64> expected;
+    for(u64 i = 0; i < 1000; i++) {
+        u64 key = (i * 7919) % 1009;
+        map[key] = i;
+        expected[key] = i;
+    }
+
+    REQUIRE(map.size() == expected.size());
+
+    auto expectedIt = expected.begin();
+    for(const auto& [key, value] : map) {
+        REQUIRE(key == expectedIt->first);
+        REQUIRE(value == expectedIt->second);
+        expectedIt++;
+    }
+}
+
+TEST_CASE("Lower And Upper Bound") {
+    Core::OrderedMap<u64, u64> map{{10, 1}, {20, 2}, {30, 3}};
+
+    for(u64 key = 0; key < 40; key++) {
+        INFO(key);
+        u64 expectedLower = (key > 10) + (key > 20) + (key > 30);
+        u64 expectedUpper = (key >= 10) + (key >= 20) + (key >= 30);
+        REQUIRE(static_cast<u64>(map.lowerBound(key) - map.begin()) == expectedLower);
+        REQUIRE(static_cast<u64>(map.upperBound(key) - map.begin()) == expectedUpper);
+        REQUIRE(map.contains(key) == (key % 10 == 0 && key > 0));
+    }
+}
+
+TEST_CASE("Build From Unsorted Entries") {
+    Core::Array<std::pair<std::string, u64>> entries{{"c", 3}, {"a", 1}, {"b", 2}, {"a", 4}, {"c", 5}};
+
+    Core::OrderedMap<std::string, u64> map;
+    map.buildFrom(Core::ToSpan(static_cast<const Core::Array<std::pair<std::string, u64>>&>(entries)));
+
+    REQUIRE(map.size() == 3);
+    REQUIRE(map.begin()->first == "a");
+    REQUIRE(map.at("a") == 1);
+    REQUIRE(map.at("b") == 2);
+    REQUIRE(map.at("c") == 3);
+
+    Core::OrderedMap<std::string, u64> moved;
+    moved.buildFrom(std::move(entries));
+    REQUIRE(moved == map);
+}
+
+TEST_CASE("Ordered Erase") {
+    Core::OrderedMap<std::string, u64> map{{"a", 1}, {"b", 2}, {"c", 3}};
+
+    REQUIRE(map.erase("b") == 1);
+    REQUIRE(map.erase("b") == 0);
+    REQUIRE(map.size() == 2);
+    REQUIRE(!map.contains("b"));
+
+    map.erase(map.find("a"));
+    REQUIRE(map.size() == 1);
+    REQUIRE(map.at("c") == 3);
+
+    map.clear();
+    REQUIRE(map.empty());
+}
+
+TEST_CASE("Serialize Ordered Map") {
+    Core::OrderedMap<u64, std::string> map;
+    for(u64 i = 0; i < 100; i++) {
+        map[99 - i] = std::to_string(i);
+    }
+
+    Core::IO::ArrayBuffer buffer;
+    Core::IO::OutputStream out(&buffer);
+    out.write(map);
+
+    Core::IO::InputStream in(&buffer);
+    Core::OrderedMap<u64, std::string> result = in.read<Core::OrderedMap<u64, std::string>>();
+
+    REQUIRE(result == map);
+}
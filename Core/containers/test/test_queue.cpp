@@ -0,0 +1,178 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/Types.h"
+#include "core/containers/Queue.h"
+
+#include <deque>
+#include <memory>
+#include <random>
+#include <string>
+
+TEST_CASE("Queue Starts Empty") {
+    Core::Queue<u64> queue;
+
+    REQUIRE(queue.count() == 0);
+    REQUIRE(queue.isEmpty());
+    REQUIRE(queue.totalCapacity() == 0);
+    REQUIRE(queue.begin() == queue.end());
+}
+
+TEST_CASE("Queue Is First In First Out") {
+    Core::Queue<u64> queue;
+
+    for(u64 i = 0; i < 100; i++) {
+        queue.pushBack(i);
+    }
+
+    REQUIRE(queue.count() == 100);
+    REQUIRE(queue.front() == 0);
+    REQUIRE(queue.back() == 99);
+
+    for(u64 i = 0; i < 100; i++) {
+        REQUIRE(queue.popFront() == i);
+    }
+
+    REQUIRE(queue.isEmpty());
+}
+
+TEST_CASE("Queue Wraps Around Without Growing") {
+    Core::Queue<u64> queue;
+    queue.ensureCapacity(8);
+
+    for(u64 i = 0; i < 6; i++) {
+        queue.pushBack(i);
+    }
+
+    // Keep six elements in the queue while the ring goes around several times
+    for(u64 i = 6; i < 100; i++) {
+        REQUIRE(queue.popFront() == i - 6);
+        queue.pushBack(i);
+    }
+
+    REQUIRE(queue.totalCapacity() == 8);
+    for(u64 i = 0; i < 6; i++) {
+        REQUIRE(queue[i] == 94 + i);
+    }
+}
+
+TEST_CASE("Queue Grows While Wrapped") {
+    Core::Queue<std::string> queue;
+
+    for(u64 i = 0; i < 5; i++) {
+        queue.pushBack(std::to_string(i));
+    }
+    for(u64 i = 0; i < 5; i++) {
+        queue.pushFront(std::to_string(100 + i));
+    }
+
+    REQUIRE(queue.count() == 10);
+    REQUIRE(queue.totalCapacity() == 16);
+
+    u64 index = 0;
+    for(const std::string& element : queue) {
+        if(index < 5) {
+            REQUIRE(element == std::to_string(104 - index));
+        } else {
+            REQUIRE(element == std::to_string(index - 5));
+        }
+        index++;
+    }
+    REQUIRE(index == 10);
+}
+
+TEST_CASE("Queue Grows While Pushing Its Own Elements") {
+    Core::Queue<std::string> queue;
+    queue.ensureCapacity(8);
+
+    // Long enough that the strings live on the heap, so reading one after it was freed would show
+    for(u64 i = 0; i < queue.totalCapacity(); i++) {
+        queue.pushBack(std::string(64, static_cast<char>('a' + i)));
+    }
+    REQUIRE(queue.count() == queue.totalCapacity());
+
+    queue.pushBack(queue.front());
+    REQUIRE(queue.totalCapacity() == 16);
+    REQUIRE(queue.back() == std::string(64, 'a'));
+
+    while(queue.count() < queue.totalCapacity()) {
+        queue.pushBack(std::string(64, 'z'));
+    }
+
+    queue.pushFront(queue.back());
+    REQUIRE(queue.totalCapacity() == 32);
+    REQUIRE(queue.front() == std::string(64, 'z'));
+    REQUIRE(queue[1] == std::string(64, 'a'));
+    REQUIRE(queue[9] == std::string(64, 'a'));
+    REQUIRE(queue.count() == 17);
+}
+
+TEST_CASE("Queue Works At Both Ends") {
+    Core::Queue<u64> queue;
+    std::deque<u64> expected;
+    std::mt19937_64 random(7);
+
+    for(u64 i = 0; i < 10000; i++) {
+        switch(random() % 4) {
+            case 0:
+                queue.pushBack(i);
+                expected.push_back(i);
+                break;
+            case 1:
+                queue.pushFront(i);
+                expected.push_front(i);
+                break;
+            case 2:
+                if(!expected.empty()) {
+                    REQUIRE(queue.popFront() == expected.front());
+                    expected.pop_front();
+                }
+                break;
+            case 3:
+                if(!expected.empty()) {
+                    REQUIRE(queue.popBack() == expected.back());
+                    expected.pop_back();
+                }
+                break;
+        }
+
+        REQUIRE(queue.count() == expected.size());
+    }
+
+    for(u64 i = 0; i < expected.size(); i++) {
+        REQUIRE(queue[i] == expected[i]);
+    }
+}
+
+TEST_CASE("Queue Move Only Elements") {
+    Core::Queue<std::unique_ptr<u64>> queue;
+
+    for(u64 i = 0; i < 20; i++) {
+        queue.emplaceBack(std::make_unique<u64>(i));
+    }
+
+    Core::Queue<std::unique_ptr<u64>> moved = std::move(queue);
+    REQUIRE(queue.isEmpty());
+    REQUIRE(moved.count() == 20);
+
+    std::unique_ptr<u64> first = moved.popFront();
+    REQUIRE(*first == 0);
+    REQUIRE(*moved.back() == 19);
+}
+
+TEST_CASE("Queue Copy") {
+    Core::Queue<std::string> queue{"a", "b", "c"};
+    queue.popFront();
+    queue.pushBack("d");
+
+    Core::Queue<std::string> copy(queue);
+    REQUIRE(copy.count() == 3);
+    REQUIRE(copy[0] == "b");
+    REQUIRE(copy[2] == "d");
+
+    copy.clear();
+    REQUIRE(copy.isEmpty());
+    REQUIRE(queue.count() == 3);
+
+    copy = queue;
+    REQUIRE(copy.popBack() == "d");
+}
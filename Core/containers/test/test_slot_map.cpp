@@ -0,0 +1,136 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/Types.h"
+#include "core/containers/HashMap.h"
+#include "core/containers/OpaqueID.h"
+#include "core/containers/SlotMap.h"
+
+#include <random>
+#include <string>
+#include <unordered_map>
+
+using TestID = Core::OpaqueID<struct TestLabel, u32>;
+
+TEST_CASE("Opaque ID") {
+    TestID invalid;
+    REQUIRE(!invalid.isValid());
+
+    TestID id = TestID::FromIndexAndGeneration(5, 3);
+    REQUIRE(id.isValid());
+    REQUIRE(id.index() == 5);
+    REQUIRE(id.generation() == 3);
+    REQUIRE(id == TestID(id.value()));
+    REQUIRE(id != TestID::FromIndexAndGeneration(5, 4));
+
+    Core::HashMap<TestID, std::string> names;
+    names[id] = "five";
+    REQUIRE(names[TestID::FromIndexAndGeneration(5, 3)] == "five");
+}
+
+TEST_CASE("Slot Map Insert And Find") {
+    Core::SlotMap<std::string, TestID> map;
+
+    TestID a = map.insert("a");
+    TestID b = map.emplace(2, 'b');
+    TestID c = map.insert("c");
+
+    REQUIRE(map.count() == 3);
+    REQUIRE(map[a] == "a");
+    REQUIRE(map[b] == "bb");
+    REQUIRE(*map.find(c) == "c");
+    REQUIRE(map.contains(b));
+    REQUIRE(!map.contains(TestID()));
+    REQUIRE(map.find(TestID::FromIndexAndGeneration(10, 1)) == nullptr);
+}
+
+TEST_CASE("Slot Map Detects Stale IDs") {
+    Core::SlotMap<std::string, TestID> map;
+
+    TestID a = map.insert("a");
+    TestID b = map.insert("b");
+
+    REQUIRE(map.erase(a));
+    REQUIRE(!map.erase(a));
+    REQUIRE(!map.contains(a));
+    REQUIRE(map.find(a) == nullptr);
+
+    // The new element reuses the slot of the erased one, but the old ID must not find it
+    TestID reused = map.insert("reused");
+    REQUIRE(reused.index() == a.index());
+    REQUIRE(reused != a);
+    REQUIRE(map.find(a) == nullptr);
+    REQUIRE(map[reused] == "reused");
+    REQUIRE(map[b] == "b");
+}
+
+TEST_CASE("Slot Map Keeps Elements Packed") {
+    Core::SlotMap<u64, TestID> map;
+
+    Core::Array<TestID> ids;
+    for(u64 i = 0; i < 10; i++) {
+        ids.insert(map.insert(i));
+    }
+
+    map.erase(ids[0]);
+    map.erase(ids[5]);
+
+    REQUIRE(map.count() == 8);
+    REQUIRE(map.elements().count() == 8);
+
+    u64 sum = 0;
+    for(u64 value : map) {
+        sum += value;
+    }
+    REQUIRE(sum == 45 - 5);
+
+    for(u64 i = 0; i < map.count(); i++) {
+        REQUIRE(map[map.idAt(i)] == map.elements()[i]);
+    }
+}
+
+TEST_CASE("Slot Map Clear") {
+    Core::SlotMap<std::string, TestID> map;
+
+    TestID a = map.insert("a");
+    TestID b = map.insert("b");
+    map.clear();
+
+    REQUIRE(map.isEmpty());
+    REQUIRE(!map.contains(a));
+    REQUIRE(!map.contains(b));
+
+    TestID c = map.insert("c");
+    REQUIRE(map[c] == "c");
+    REQUIRE(!map.contains(a));
+    REQUIRE(!map.contains(b));
+}
+
+TEST_CASE("Slot Map Random Operations") {
+    Core::SlotMap<u64> map;
+    std::unordered_map<u64, u64> expected;
+    Core::Array<Core::OpaqueID<u64>> erased;
+    std::mt19937_64 random(11);
+
+    for(u64 i = 0; i < 20000; i++) {
+        if(random() % 3 != 0 || expected.empty()) {
+            Core::OpaqueID<u64> id = map.insert(i);
+            REQUIRE(expected.find(id.value()) == expected.end());
+            expected[id.value()] = i;
+        } else {
+            auto victim = std::next(expected.begin(), random() % expected.size());
+            Core::OpaqueID<u64> id(victim->first);
+            REQUIRE(map.erase(id));
+            erased.insert(id);
+            expected.erase(victim);
+        }
+    }
+
+    REQUIRE(map.count() == expected.size());
+    for(const auto& [id, value] : expected) {
+        REQUIRE(map[Core::OpaqueID<u64>(id)] == value);
+    }
+
+    for(Core::OpaqueID<u64> id : erased) {
+        REQUIRE(!map.contains(id));
+    }
+}
@@ -0,0 +1,121 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/Types.h"
+#include "core/containers/SoAArray.h"
+#include "core/io/serialization/ArrayBuffer.h"
+#include "core/io/serialization/InputStream.h"
+#include "core/io/serialization/OutputStream.h"
+
+#include <memory>
+#include <string>
+
+TEST_CASE("SoA Array Starts Empty") {
+    Core::SoAArray<u32, f64> array;
+
+    REQUIRE(array.isEmpty());
+    REQUIRE(array.count() == 0);
+    REQUIRE(array.column<0>().count() == 0);
+}
+
+TEST_CASE("SoA Array Columns Are Contiguous And Aligned") {
+    Core::SoAArray<u8, f64, std::string> array;
+
+    for(u64 i = 0; i < 100; i++) {
+        REQUIRE(array.emplace(static_cast<u8>(i), i * 0.5, std::to_string(i)) == i);
+    }
+
+    REQUIRE(array.count() == 100);
+
+    Core::Span<u8> bytes         = array.column<0>();
+    Core::Span<f64> halves       = array.column<1>();
+    Core::Span<std::string> text = array.column<2>();
+
+    REQUIRE(reinterpret_cast<uintptr_t>(bytes.rawData()) % Core::SoAArray<u8>::ColumnAlignment == 0);
+    REQUIRE(reinterpret_cast<uintptr_t>(halves.rawData()) % Core::SoAArray<u8>::ColumnAlignment == 0);
+    REQUIRE(reinterpret_cast<uintptr_t>(text.rawData()) % Core::SoAArray<u8>::ColumnAlignment == 0);
+
+    for(u64 i = 0; i < 100; i++) {
+        REQUIRE(bytes[i] == i);
+        REQUIRE(halves[i] == i * 0.5);
+        REQUIRE(text[i] == std::to_string(i));
+        REQUIRE(array.get<2>(i) == std::to_string(i));
+    }
+}
+
+TEST_CASE("SoA Array Erase Moves The Last Element") {
+    Core::SoAArray<u64, std::string> array;
+    for(u64 i = 0; i < 5; i++) {
+        array.emplace(i, std::to_string(i));
+    }
+
+    array.eraseAt(1);
+    REQUIRE(array.count() == 4);
+    REQUIRE(array.get<0>(1) == 4);
+    REQUIRE(array.get<1>(1) == "4");
+
+    array.eraseAt(3);
+    REQUIRE(array.count() == 3);
+    REQUIRE(array.get<0>(2) == 2);
+}
+
+TEST_CASE("SoA Array Resize And Clear") {
+    std::shared_ptr<u64> shared = std::make_shared<u64>(1);
+
+    Core::SoAArray<std::shared_ptr<u64>, u32> array;
+    array.emplace(shared, 1u);
+    array.emplace(shared, 2u);
+    REQUIRE(shared.use_count() == 3);
+
+    array.resize(5);
+    REQUIRE(array.count() == 5);
+    REQUIRE(array.get<0>(4) == nullptr);
+    REQUIRE(array.get<1>(4) == 0);
+
+    array.resize(1);
+    REQUIRE(shared.use_count() == 2);
+
+    array.clear();
+    REQUIRE(shared.use_count() == 1);
+    REQUIRE(array.isEmpty());
+}
+
+TEST_CASE("SoA Array Copy And Move") {
+    Core::SoAArray<u32, std::string> array;
+    array.emplace(1u, "one");
+    array.emplace(2u, "two");
+
+    Core::SoAArray<u32, std::string> copy(array);
+    REQUIRE(copy.count() == 2);
+    REQUIRE(copy.get<1>(1) == "two");
+
+    copy.get<1>(1) = "changed";
+    REQUIRE(array.get<1>(1) == "two");
+
+    Core::SoAArray<u32, std::string> moved(std::move(copy));
+    REQUIRE(copy.isEmpty());
+    REQUIRE(moved.get<1>(1) == "changed");
+
+    moved = array;
+    REQUIRE(moved.get<1>(1) == "two");
+}
+
+TEST_CASE("SoA Array Serialization") {
+    Core::SoAArray<u32, f32, std::string> array;
+    for(u32 i = 0; i < 50; i++) {
+        array.emplace(i, i * 2.0f, std::to_string(i));
+    }
+
+    Core::IO::ArrayBuffer buffer;
+    Core::IO::OutputStream out(&buffer);
+    out.write(array);
+
+    Core::IO::InputStream in(&buffer);
+    Core::SoAArray<u32, f32, std::string> result = in.read<Core::SoAArray<u32, f32, std::string>>();
+
+    REQUIRE(result.count() == 50);
+    for(u32 i = 0; i < 50; i++) {
+        REQUIRE(result.get<0>(i) == i);
+        REQUIRE(result.get<1>(i) == i * 2.0f);
+        REQUIRE(result.get<2>(i) == std::to_string(i));
+    }
+}
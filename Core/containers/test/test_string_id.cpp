@@ -0,0 +1,103 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/Types.h"
+#include "core/containers/Array.h"
+#include "core/containers/StringId.h"
+#include "core/io/serialization/ArrayBuffer.h"
+#include "core/io/serialization/InputStream.h"
+#include "core/io/serialization/OutputStream.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+using namespace Core::Literals;
+
+TEST_CASE("String Id Equal Strings Share An Id") {
+    std::string position = "position";
+
+    Core::StringId first(position);
+    Core::StringId second(std::string_view("position"));
+    Core::StringId other("normal");
+
+    REQUIRE(first == second);
+    REQUIRE(first != other);
+    REQUIRE(first.view() == "position");
+    REQUIRE(std::string(first.c_str()) == "position");
+    REQUIRE(first.hash() == Core::HashString("position"));
+}
+
+TEST_CASE("String Id Empty String") {
+    Core::StringId empty;
+
+    REQUIRE(empty.empty());
+    REQUIRE(empty.view().empty());
+    REQUIRE(empty == Core::StringId(""));
+    REQUIRE(!Core::StringId("a").empty());
+}
+
+TEST_CASE("String Id Literals") {
+    static_assert(Core::HashString("uv") == 0x08c44007b566e3b2);
+
+    REQUIRE("uv"_id == Core::StringId("uv"));
+    REQUIRE("uv"_id.view() == "uv");
+    REQUIRE(""_id.empty());
+}
+
+TEST_CASE("String Id Find Does Not Intern") {
+    REQUIRE(!Core::StringId::Find("never interned anywhere else").has_value());
+
+    Core::StringId interned("found");
+    REQUIRE(Core::StringId::Find("found") == interned);
+}
+
+TEST_CASE("String Id Long Strings") {
+    std::string longText(100000, 'x');
+    Core::StringId id(longText);
+
+    REQUIRE(id.view() == longText);
+    REQUIRE(Core::StringId(longText) == id);
+}
+
+TEST_CASE("String Id Serializes As Text") {
+    Core::IO::ArrayBuffer buffer;
+    Core::IO::OutputStream out(&buffer);
+    out.write("tangent"_id);
+
+    Core::IO::InputStream stringIn(&buffer);
+    REQUIRE(stringIn.read<std::string>() == "tangent");
+
+    Core::IO::ArrayBuffer secondBuffer;
+    Core::IO::OutputStream secondOut(&secondBuffer);
+    secondOut.write(std::string("bitangent"));
+
+    Core::IO::InputStream idIn(&secondBuffer);
+    REQUIRE(idIn.read<Core::StringId>() == "bitangent"_id);
+}
+
+TEST_CASE("String Id Interning Across Threads") {
+    const u64 threadCount = 8;
+    const u64 nameCount   = 2000;
+
+    Core::Array<Core::Array<Core::StringId>> idsPerThread(Core::Array<Core::StringId>(), threadCount);
+
+    Core::Array<std::thread> threads;
+    for(u64 t = 0; t < threadCount; t++) {
+        threads.emplace([&, t]() {
+            for(u64 i = 0; i < nameCount; i++) {
+                idsPerThread[t].emplace("name " + std::to_string((i + t * 31) % nameCount));
+            }
+        });
+    }
+    for(std::thread& thread : threads) {
+        thread.join();
+    }
+
+    for(u64 t = 0; t < threadCount; t++) {
+        for(u64 i = 0; i < nameCount; i++) {
+            Core::StringId id = idsPerThread[t][i];
+            REQUIRE(id.view() == "name " + std::to_string((i + t * 31) % nameCount));
+            REQUIRE(id == idsPerThread[0][(i + t * 31) % nameCount]);
+        }
+    }
+}
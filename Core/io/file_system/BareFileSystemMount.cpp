@@ -1,49 +1,63 @@
 #include "core/io/file_system/BareFileSystemMount.h"
 
 #include "core/assert/Assert.h"
-#include "core/containers/HashMap.h"
+#include "core/containers/ConcurrentHashMap.h"
 #include "core/containers/HashSet.h"
+#include "core/io/file_system/FileStreamBuffer.h"
 
 #include <FileWatcher/FileWatcher.h>
 
 #include <fstream>
+#include <mutex>
 
 namespace {
 std::unique_ptr<FW::FileWatcher> fileWatcher = std::make_unique<FW::FileWatcher>();
 
+// Assets can be loaded, and so start being watched, from any thread, while changes are only picked up by the thread
+// that calls updateWatchers.
 class UpdateListener : public FW::FileWatchListener {
 private:
-    Core::HashMap<std::filesystem::path, Core::Array<std::function<Core::Status()>>> watchers;
+    Core::ConcurrentHashMap<std::filesystem::path, Core::Array<std::function<Core::Status()>>> watchers;
+
+    std::mutex watchedDirectoriesLock;
     Core::HashSet<std::filesystem::path> watchedDirectories;
 
-    Core::HashSet<std::function<Core::Status()>*> deduplicatedObservers;
+    Core::HashSet<std::filesystem::path> modifiedFiles;
 
 public:
     void handleFileAction(FW::WatchID watchID, const FW::String& dir, const FW::String& file, FW::Action action) {
         std::filesystem::path directory = dir;
         std::filesystem::path filename  = file;
         std::filesystem::path fullPath  = directory / filename;
-        if(action == FW::Action::Modified) {
-            if(watchers.count(fullPath) > 0) {
-                for(auto& observer : watchers[fullPath]) {
-                    deduplicatedObservers.insert(&observer);
-                }
-            }
+        if(action == FW::Action::Modified && watchers.contains(fullPath)) {
+            modifiedFiles.insert(fullPath);
         }
     }
 
     Core::Status postProcess() {
-        for(auto observer : deduplicatedObservers) {
-            RETURN_IF_ERROR((*observer)());
+        // The observers are copied out so that they can watch more files without deadlocking on the shard they are in
+        for(const std::filesystem::path& file : modifiedFiles) {
+            std::optional<Core::Array<std::function<Core::Status()>>> observers = watchers.find(file);
+            if(!observers) {
+                continue;
+            }
+
+            for(auto& observer : *observers) {
+                RETURN_IF_ERROR(observer());
+            }
         }
 
-        deduplicatedObservers.clear();
+        modifiedFiles.clear();
         return Core::Status::Ok();
     }
 
     void add(const std::filesystem::path& filename, const std::function<Core::Status()>& observer) {
-        watchers[filename].emplace(observer);
+        watchers.upsert(filename, [&](Core::Array<std::function<Core::Status()>>& observers) {
+            observers.emplace(observer);
+        });
+
         std::filesystem::path directory = filename.parent_path();
+        std::scoped_lock lock(watchedDirectoriesLock);
         if(watchedDirectories.count(directory) == 0) {
             fileWatcher->addWatch(directory.string(), this);
             watchedDirectories.insert(directory);
@@ -61,14 +75,8 @@ std::filesystem::path BareFileSystemMount::translatePath(const Path& path) const
 }
 
 Core::StatusOr<InputStream> BareFileSystemMount::openFileForRead(const Path& file) const {
-    std::unique_ptr<class std::basic_istream<std::byte>> reader =
-          std::make_unique<std::basic_ifstream<std::byte>>(file.path, std::ios::in | std::ios::binary);
-
-    if(*reader) {
-        return Core::IO::InputStream(std::move(reader));
-    } else {
-        return Core::Status::Error("Unable to open file to read at path: {}", file.path.string());
-    }
+    ASSIGN_OR_RETURN(std::unique_ptr<FileStreamBuffer> reader, FileStreamBuffer::OpenForRead(file.path));
+    return Core::IO::InputStream(std::move(reader));
 }
 
 Core::StatusOr<std::string> BareFileSystemMount::readTextFile(const Path& file) const {
@@ -84,35 +92,44 @@ Core::StatusOr<std::string> BareFileSystemMount::readTextFile(const Path& file)
 }
 
 Core::StatusOr<Core::Array<std::byte>> BareFileSystemMount::readBinaryFile(const Path& file) const {
-    std::basic_ifstream<std::byte> reader(file.path, std::ios::in | std::ios::binary);
-    if(!reader) {
+    std::filebuf reader;
+    if(reader.open(file.path, std::ios::in | std::ios::binary) == nullptr) {
         return Core::Status::Error("Unable to open file to read at path: {}", file.path.string());
     }
 
     uint64_t fileSize = std::filesystem::file_size(file.path);
 
-    Core::Array<std::byte> contents;
+    Core::Array<std::byte> contents(fileSize);
     Core::Span<std::byte> data = contents.insertUninitialized(fileSize);
 
-    reader.read(data.rawData(), data.count());
+    uint64_t readSize = reader.sgetn(reinterpret_cast<char*>(data.rawData()), data.count());
+    if(readSize != fileSize) {
+        return Core::Status::Error(
+              "Only read {} of the {} bytes of the file at path: {}", readSize, fileSize, file.path.string());
+    }
     return contents;
 }
 
-Core::StatusOr<OutputStream> BareFileSystemMount::openFileForWrite(const Path& file) const {
-    std::unique_ptr<std::basic_ostream<std::byte>> writer =
-          std::make_unique<std::basic_ofstream<std::byte>>(file.path, std::ios::out | std::ios::binary);
+Core::StatusOr<MappedFile> BareFileSystemMount::mapFile(const Path& file, MappedFileOptions options) const {
+    return MappedFile::Map(file.path, options);
+}
 
-    if(*writer) {
-        return OutputStream(std::move(writer));
-    } else {
-        return Core::Status::Error("Unable to open file to write at path: {}", file.path.string());
-    }
+Core::StatusOr<OutputStream> BareFileSystemMount::openFileForWrite(const Path& file) const {
+    ASSIGN_OR_RETURN(std::unique_ptr<FileStreamBuffer> writer, FileStreamBuffer::OpenForWrite(file.path));
+    return OutputStream(std::move(writer));
 }
 
 void BareFileSystemMount::writeBinaryFile(const Path& file, std::span<const std::byte> data) const {
-    std::basic_ofstream<std::byte> writer(file.path, std::ios::out | std::ios::binary);
-    ASSERT(writer);
-    writer.write(data.data(), data.size());
+    std::filebuf writer;
+    std::filebuf* opened = writer.open(file.path, std::ios::out | std::ios::binary);
+    ASSERT_WITH_MESSAGE(opened != nullptr, "Unable to open file to write at path: {}", file.path.string());
+
+    uint64_t writtenSize = writer.sputn(reinterpret_cast<const char*>(data.data()), data.size());
+    ASSERT_WITH_MESSAGE(writtenSize == data.size(),
+                        "Only wrote {} of the {} bytes of the file at path: {}",
+                        writtenSize,
+                        data.size(),
+                        file.path.string());
 }
 
 void BareFileSystemMount::watchForChanges(const Path& file, const std::function<Core::Status()>& observer) const {
@@ -0,0 +1,85 @@
+#include "core/io/file_system/FileStreamBuffer.h"
+
+#include "core/assert/Assert.h"
+
+#include <cstring>
+
+namespace Core::IO {
+
+FileStreamBuffer::FileStreamBuffer() : window(BufferSize) {
+    file.pubsetbuf(nullptr, 0);
+    (void)window.insertUninitialized(BufferSize);
+}
+
+FileStreamBuffer::~FileStreamBuffer() {
+    writeWindowToFile();
+}
+
+Core::StatusOr<std::unique_ptr<FileStreamBuffer>> FileStreamBuffer::OpenForRead(const std::filesystem::path& path) {
+    std::unique_ptr<FileStreamBuffer> buffer(new FileStreamBuffer());
+    if(buffer->file.open(path, std::ios::in | std::ios::binary) == nullptr) {
+        return Core::Status::Error("Unable to open file to read at path: {}", path.string());
+    }
+
+    return buffer;
+}
+
+Core::StatusOr<std::unique_ptr<FileStreamBuffer>> FileStreamBuffer::OpenForWrite(const std::filesystem::path& path) {
+    std::unique_ptr<FileStreamBuffer> buffer(new FileStreamBuffer());
+    if(buffer->file.open(path, std::ios::out | std::ios::binary) == nullptr) {
+        return Core::Status::Error("Unable to open file to write at path: {}", path.string());
+    }
+
+    buffer->setWriteWindow(buffer->window.begin(), buffer->window.end());
+    return buffer;
+}
+
+void FileStreamBuffer::flush() {
+    writeWindowToFile();
+    file.pubsync();
+}
+
+bool FileStreamBuffer::refill() {
+    std::streamsize read = file.sgetn(reinterpret_cast<char*>(window.rawData()), window.count());
+    setReadWindow(window.begin(), window.begin() + read);
+    return read != 0;
+}
+
+u64 FileStreamBuffer::underflow(std::byte* destination, u64 size) {
+    if(size < BufferSize) {
+        return StreamBuffer::underflow(destination, size);
+    }
+
+    return file.sgetn(reinterpret_cast<char*>(destination), size);
+}
+
+void FileStreamBuffer::overflow(const std::byte* source, u64 size) {
+    // Buffers opened for reading have no write window, so writing to them is an error
+    if(writeBegin == nullptr) {
+        StreamBuffer::overflow(source, size);
+        return;
+    }
+
+    writeWindowToFile();
+    if(size < BufferSize) {
+        std::memcpy(writeCursor, source, size);
+        writeCursor += size;
+        return;
+    }
+
+    std::streamsize written = file.sputn(reinterpret_cast<const char*>(source), size);
+    ASSERT_WITH_MESSAGE(static_cast<u64>(written) == size, "Only wrote {} of {} bytes to the file", written, size);
+}
+
+void FileStreamBuffer::writeWindowToFile() {
+    u64 size = static_cast<u64>(writeCursor - writeBegin);
+    if(size == 0) {
+        return;
+    }
+
+    std::streamsize written = file.sputn(reinterpret_cast<const char*>(writeBegin), size);
+    ASSERT_WITH_MESSAGE(static_cast<u64>(written) == size, "Only wrote {} of {} bytes to the file", written, size);
+    writeCursor = writeBegin;
+}
+
+}    // namespace Core::IO
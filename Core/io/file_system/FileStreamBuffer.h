@@ -0,0 +1,42 @@
+#pragma once
+
+#include "core/Types.h"
+#include "core/containers/Array.h"
+#include "core/io/serialization/StreamBuffer.h"
+#include "core/status/StatusOr.h"
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+
+namespace Core::IO {
+
+// Reads or writes a file through a window of BufferSize bytes, so small reads and writes only reach the file once the
+// window is used up. Reads and writes at least as large as the window skip it and go straight to the file.
+class FileStreamBuffer : public StreamBuffer {
+public:
+    constexpr static u64 BufferSize = 64 * 1024;
+
+    static Core::StatusOr<std::unique_ptr<FileStreamBuffer>> OpenForRead(const std::filesystem::path& path);
+    static Core::StatusOr<std::unique_ptr<FileStreamBuffer>> OpenForWrite(const std::filesystem::path& path);
+
+    ~FileStreamBuffer() override;
+
+    void flush() override;
+
+protected:
+    bool refill() override;
+    u64 underflow(std::byte* destination, u64 size) override;
+    void overflow(const std::byte* source, u64 size) override;
+
+private:
+    FileStreamBuffer();
+
+    void writeWindowToFile();
+
+    // Unbuffered, the window is the only buffer
+    std::filebuf file;
+    Core::Array<std::byte> window;
+};
+
+}    // namespace Core::IO
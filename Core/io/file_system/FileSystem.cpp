@@ -2,6 +2,8 @@
 
 #include "core/io/file_system/BareFileSystemMount.h"
 
+#include <memory>
+
 namespace {
 Core::IO::BareFileSystemMount DefaultMount("");
 
@@ -44,6 +46,14 @@ Core::StatusOr<Core::Array<std::byte>> ReadBinaryFile(const Path& file) {
     return DefaultFileSystem.readBinaryFile(file);
 }
 
+Core::StatusOr<MappedFile> MapFile(const Path& file, MappedFileOptions options) {
+    return DefaultFileSystem.mapFile(file, options);
+}
+
+Core::StatusOr<InputStream> OpenMappedFileForRead(const Path& file) {
+    return DefaultFileSystem.openMappedFileForRead(file);
+}
+
 Core::StatusOr<OutputStream> OpenFileForWrite(const Path& file) {
     return DefaultFileSystem.openFileForWrite(file);
 }
@@ -92,6 +102,20 @@ Core::StatusOr<Core::Array<std::byte>> FileSystem::readBinaryFile(const Path& fi
     }
 }
 
+Core::StatusOr<MappedFile> FileSystem::mapFile(const Path& file, MappedFileOptions options) const {
+    if(file.type == PathType::Explicit) {
+        return DefaultMount.mapFile(file, options);
+    } else {
+        return findMountPoint(file, mounts).mapFile(file, options);
+    }
+}
+
+Core::StatusOr<InputStream> FileSystem::openMappedFileForRead(const Path& file) const {
+    MappedFileOptions options{.access = MappedFileAccess::Sequential, .populate = true};
+    ASSIGN_OR_RETURN(MappedFile mapped, mapFile(file, options));
+    return InputStream(std::make_unique<MappedFileBuffer>(std::move(mapped)));
+}
+
 Core::StatusOr<OutputStream> FileSystem::openFileForWrite(const Path& file) const {
     if(file.type == PathType::Explicit) {
         return DefaultMount.openFileForWrite(file);
@@ -27,6 +27,12 @@ public:
     Core::StatusOr<std::string> readTextFile(const Path& file) const;
     Core::StatusOr<Core::Array<std::byte>> readBinaryFile(const Path& file) const;
 
+    // Maps the file into memory instead of reading it, see MappedFile
+    Core::StatusOr<MappedFile> mapFile(const Path& file, MappedFileOptions options = {}) const;
+    // Like openFileForRead, but reads the file through a mapping that is populated up front. Whole files read this way
+    // are only copied out of the system's file cache where the stream copies them, and the stream can borrow them.
+    Core::StatusOr<InputStream> openMappedFileForRead(const Path& file) const;
+
     Core::StatusOr<OutputStream> openFileForWrite(const Path& file) const;
     void writeBinaryFile(const Path& file, std::span<const std::byte> data) const;
 
@@ -40,6 +46,9 @@ Core::StatusOr<InputStream> OpenFileForRead(const Path& file);
 Core::StatusOr<std::string> ReadTextFile(const Path& file);
 Core::StatusOr<Core::Array<std::byte>> ReadBinaryFile(const Path& file);
 
+Core::StatusOr<MappedFile> MapFile(const Path& file, MappedFileOptions options = {});
+Core::StatusOr<InputStream> OpenMappedFileForRead(const Path& file);
+
 Core::StatusOr<OutputStream> OpenFileForWrite(const Path& file);
 void WriteBinaryFile(const Path& file, const Core::Array<std::byte>& data);
 
@@ -3,6 +3,7 @@
 #include "core/io/file_system/Path.h"
 
 #include "core/containers/Array.h"
+#include "core/io/file_system/MappedFile.h"
 #include "core/io/serialization/InputStream.h"
 #include "core/io/serialization/OutputStream.h"
 #include "core/status/StatusOr.h"
@@ -22,6 +23,8 @@ struct FileSystemMount {
     virtual Core::StatusOr<std::string> readTextFile(const Path& file) const              = 0;
     virtual Core::StatusOr<Core::Array<std::byte>> readBinaryFile(const Path& file) const = 0;
 
+    virtual Core::StatusOr<MappedFile> mapFile(const Path& file, MappedFileOptions options) const = 0;
+
     virtual Core::StatusOr<OutputStream> openFileForWrite(const Path& file) const         = 0;
     virtual void writeBinaryFile(const Path& file, std::span<const std::byte> data) const = 0;
 
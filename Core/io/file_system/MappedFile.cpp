@@ -0,0 +1,162 @@
+#include "core/io/file_system/MappedFile.h"
+
+#include <utility>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Core::IO {
+
+#if defined(_WIN32)
+
+Core::StatusOr<MappedFile> MappedFile::Map(const std::filesystem::path& path, MappedFileOptions options) {
+    DWORD accessFlags = FILE_ATTRIBUTE_NORMAL;
+    switch(options.access) {
+        case MappedFileAccess::Normal: break;
+        case MappedFileAccess::Sequential: accessFlags |= FILE_FLAG_SEQUENTIAL_SCAN; break;
+        case MappedFileAccess::Random: accessFlags |= FILE_FLAG_RANDOM_ACCESS; break;
+    }
+
+    HANDLE file = CreateFileW(
+          path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, accessFlags, nullptr);
+    if(file == INVALID_HANDLE_VALUE) {
+        return Core::Status::Error("Unable to open file to map at path: {}", path.string());
+    }
+
+    LARGE_INTEGER fileSize;
+    if(!GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
+        return Core::Status::Error("Unable to get the size of the file to map at path: {}", path.string());
+    }
+
+    // Empty files can't be mapped, and don't need to be
+    if(fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        return MappedFile(nullptr, 0);
+    }
+
+    // The view keeps the file and the mapping open by itself
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if(mapping == nullptr) {
+        return Core::Status::Error("Unable to map file at path: {}", path.string());
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if(view == nullptr) {
+        return Core::Status::Error("Unable to map file at path: {}", path.string());
+    }
+
+    u64 size = static_cast<u64>(fileSize.QuadPart);
+    if(options.populate) {
+        WIN32_MEMORY_RANGE_ENTRY range{.VirtualAddress = view, .NumberOfBytes = size};
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+    }
+
+    return MappedFile(static_cast<const std::byte*>(view), size);
+}
+
+void MappedFile::unmap() {
+    if(data != nullptr) {
+        UnmapViewOfFile(data);
+    }
+}
+
+#else
+
+Core::StatusOr<MappedFile> MappedFile::Map(const std::filesystem::path& path, MappedFileOptions options) {
+    int file = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if(file == -1) {
+        return Core::Status::Error("Unable to open file to map at path: {}", path.string());
+    }
+
+    struct stat fileStatus;
+    if(fstat(file, &fileStatus) != 0) {
+        close(file);
+        return Core::Status::Error("Unable to get the size of the file to map at path: {}", path.string());
+    }
+
+    // Empty files can't be mapped, and don't need to be
+    u64 size = static_cast<u64>(fileStatus.st_size);
+    if(size == 0) {
+        close(file);
+        return MappedFile(nullptr, 0);
+    }
+
+    int mapFlags = MAP_PRIVATE;
+#if defined(MAP_POPULATE)
+    if(options.populate) {
+        mapFlags |= MAP_POPULATE;
+    }
+#endif
+
+    // The mapping keeps the file open by itself
+    void* view = mmap(nullptr, size, PROT_READ, mapFlags, file, 0);
+    close(file);
+    if(view == MAP_FAILED) {
+        return Core::Status::Error("Unable to map file at path: {}", path.string());
+    }
+
+    switch(options.access) {
+        case MappedFileAccess::Normal: break;
+        case MappedFileAccess::Sequential: madvise(view, size, MADV_SEQUENTIAL); break;
+        case MappedFileAccess::Random: madvise(view, size, MADV_RANDOM); break;
+    }
+
+#if !defined(MAP_POPULATE)
+    if(options.populate) {
+        madvise(view, size, MADV_WILLNEED);
+    }
+#endif
+
+    return MappedFile(static_cast<const std::byte*>(view), size);
+}
+
+void MappedFile::unmap() {
+    if(data != nullptr) {
+        munmap(const_cast<std::byte*>(data), byteCount);
+    }
+}
+
+#endif
+
+MappedFile::MappedFile(const std::byte* data, u64 byteCount) : data(data), byteCount(byteCount) {}
+
+MappedFile::MappedFile(MappedFile&& other)
+  : data(std::exchange(other.data, nullptr)), byteCount(std::exchange(other.byteCount, 0)) {}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) {
+    if(this != &other) {
+        unmap();
+        data      = std::exchange(other.data, nullptr);
+        byteCount = std::exchange(other.byteCount, 0);
+    }
+    return *this;
+}
+
+MappedFile::~MappedFile() {
+    unmap();
+}
+
+Core::Span<const std::byte> MappedFile::bytes() const {
+    return Core::Span<const std::byte>(data, byteCount);
+}
+
+u64 MappedFile::size() const {
+    return byteCount;
+}
+
+// The mapped bytes stay where they are when the file is moved into the buffer
+MappedFileBuffer::MappedFileBuffer(MappedFile&& mapped)
+  : ContiguousStreamBuffer(mapped.bytes()), file(std::move(mapped)) {}
+
+}    // namespace Core::IO
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "core/Types.h"
+#include "core/containers/Span.h"
+#include "core/io/serialization/ContiguousStreamBuffer.h"
+#include "core/status/StatusOr.h"
+
+#include <cstddef>
+#include <filesystem>
+
+namespace Core::IO {
+
+// How a mapped file is going to be read, so that the system knows whether reading ahead pays off
+enum class MappedFileAccess {
+    Normal,
+    Sequential,
+    Random,
+};
+
+struct MappedFileOptions {
+    MappedFileAccess access = MappedFileAccess::Normal;
+
+    // Reads the whole file in while mapping it, instead of each page the first time it is touched. Worth it for files
+    // that are read completely right after they are mapped.
+    bool populate = false;
+};
+
+// A file mapped into memory read only. Its bytes are the system's cached pages of the file, so nothing is copied to
+// read them, and parts of the file that are never touched are never read from disk.
+//
+// The file must not be truncated while it is mapped, touching the pages past its new end crashes on most systems.
+class MappedFile {
+public:
+    static Core::StatusOr<MappedFile> Map(const std::filesystem::path& path, MappedFileOptions options = {});
+
+    MappedFile(MappedFile&& other);
+    MappedFile& operator=(MappedFile&& other);
+    ~MappedFile();
+
+    [[nodiscard]] Core::Span<const std::byte> bytes() const;
+    [[nodiscard]] u64 size() const;
+
+private:
+    MappedFile(const std::byte* data, u64 byteCount);
+
+    void unmap();
+
+    const std::byte* data;
+    u64 byteCount;
+};
+
+// Reads a mapped file, which it keeps mapped for as long as it exists. Streams reading from it are memory backed, so
+// they can borrow the file's bytes, see InputStream::readView.
+class MappedFileBuffer : public ContiguousStreamBuffer {
+public:
+    explicit MappedFileBuffer(MappedFile&& mapped);
+
+private:
+    MappedFile file;
+};
+
+}    // namespace Core::IO
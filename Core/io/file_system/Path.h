@@ -14,6 +14,8 @@ struct Path {
     Path(const char* path, PathType type = PathType::Mappable);
     Path(const std::string& path, PathType type = PathType::Mappable);
     Path(const std::filesystem::path& path, PathType type = PathType::Mappable);
+
+    bool operator==(const Path& other) const = default;
 };
 }    // namespace Core::IO
 
@@ -21,8 +23,13 @@ struct Path {
 namespace std {
 template <>
 struct hash<Core::IO::Path> {
+    // Paths are equal when their elements are, so "a//b" and "a/b" have to hash the same
     size_t operator()(const Core::IO::Path& value) const noexcept {
-        return Core::Algorithms::CombineHashes(value.path, value.type);
+        size_t hash = static_cast<size_t>(value.type);
+        for(const std::filesystem::path& element : value.path) {
+            hash = Core::Algorithms::MixInteger(hash + Core::Algorithms::HashBytes(Core::AsBytes(element.native())));
+        }
+        return hash;
     }
 };
 }    // namespace std
@@ -22,6 +22,11 @@ Core::StatusOr<Core::Array<std::byte>> VirtualFileSystemMount::readBinaryFile(co
     return BareFileSystemMount::readBinaryFile(translatedPath);
 }
 
+Core::StatusOr<MappedFile> VirtualFileSystemMount::mapFile(const Path& file, MappedFileOptions options) const {
+    Path translatedPath(translatePath(file), file.type);
+    return BareFileSystemMount::mapFile(translatedPath, options);
+}
+
 
 Core::StatusOr<OutputStream> VirtualFileSystemMount::openFileForWrite(const Path& file) const {
     Path translatedPath(translatePath(file), file.type);
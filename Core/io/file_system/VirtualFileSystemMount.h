@@ -14,6 +14,8 @@ struct VirtualFileSystemMount : public BareFileSystemMount {
     Core::StatusOr<std::string> readTextFile(const Path& file) const override;
     Core::StatusOr<Core::Array<std::byte>> readBinaryFile(const Path& file) const override;
 
+    Core::StatusOr<MappedFile> mapFile(const Path& file, MappedFileOptions options) const override;
+
     Core::StatusOr<OutputStream> openFileForWrite(const Path& file) const override;
     void writeBinaryFile(const Path& file, std::span<const std::byte> data) const override;
 
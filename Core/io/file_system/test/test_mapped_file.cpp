@@ -0,0 +1,109 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/io/file_system/FileSystem.h"
+#include "core/io/file_system/MappedFile.h"
+#include "core/io/file_system/VirtualFileSystemMount.h"
+#include "core/io/serialization/InputStream.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace {
+
+std::filesystem::path WriteTemporaryFile(const std::string& name, const std::string& contents) {
+    std::filesystem::path file = std::filesystem::temp_directory_path() / name;
+    std::ofstream out(file, std::ios::binary);
+    out.write(contents.data(), contents.size());
+    return file;
+}
+
+}    // namespace
+
+TEST_CASE("Mapped File Reads The File Contents") {
+    std::string contents(100000, '\0');
+    for(size_t i = 0; i < contents.size(); i++) {
+        contents[i] = static_cast<char>(i * 31);
+    }
+    std::filesystem::path file = WriteTemporaryFile("bengine_test_mapped_file.bin", contents);
+
+    {
+        Core::StatusOr<Core::IO::MappedFile> mapped = Core::IO::MappedFile::Map(
+              file, Core::IO::MappedFileOptions{.access = Core::IO::MappedFileAccess::Sequential, .populate = true});
+        REQUIRE(mapped.isOk());
+
+        Core::Span<const std::byte> bytes = mapped.value().bytes();
+        REQUIRE(bytes.count() == contents.size());
+        REQUIRE(std::memcmp(bytes.rawData(), contents.data(), contents.size()) == 0);
+
+        Core::IO::InputStream stream(std::make_unique<Core::IO::MappedFileBuffer>(std::move(mapped.value())));
+        REQUIRE(stream.isMemoryBacked());
+
+        std::optional<Core::Span<const std::byte>> view = stream.readBytesView(contents.size());
+        REQUIRE(view.has_value());
+        REQUIRE(view->rawData() == bytes.rawData());
+    }
+
+    std::filesystem::remove(file);
+}
+
+TEST_CASE("Mapped File Of An Empty File Is Empty") {
+    std::filesystem::path file = WriteTemporaryFile("bengine_test_mapped_file_empty.bin", "");
+
+    Core::StatusOr<Core::IO::MappedFile> mapped = Core::IO::MappedFile::Map(file);
+    REQUIRE(mapped.isOk());
+    REQUIRE(mapped.value().size() == 0);
+
+    std::filesystem::remove(file);
+}
+
+TEST_CASE("Mapped File Fails For A Missing File") {
+    std::filesystem::path file = std::filesystem::temp_directory_path() / "bengine_test_mapped_file_missing.bin";
+    std::filesystem::remove(file);
+
+    REQUIRE(!Core::IO::MappedFile::Map(file).isOk());
+}
+
+TEST_CASE("Mapped File Through A Mount") {
+    const std::filesystem::path root = std::filesystem::temp_directory_path() / "bengine_test_mapped_file_mount";
+    std::filesystem::create_directories(root / "models");
+    std::filesystem::path file = root / "models" / "mesh.bin";
+    {
+        std::ofstream out(file, std::ios::binary);
+        out << "mounted contents";
+    }
+
+    // The default file system holds on to its mounts for the rest of the run
+    static Core::IO::VirtualFileSystemMount mount("mapped_assets", root);
+
+    SECTION("Map File") {
+        Core::IO::FileSystem fileSystem;
+        fileSystem.addMount(&mount);
+
+        Core::StatusOr<Core::IO::MappedFile> mapped = fileSystem.mapFile("mapped_assets/models/mesh.bin");
+        REQUIRE(mapped.isOk());
+
+        Core::Span<const std::byte> bytes = mapped.value().bytes();
+        REQUIRE(std::string_view(reinterpret_cast<const char*>(bytes.rawData()), bytes.count()) == "mounted contents");
+
+        REQUIRE(!fileSystem.mapFile("mapped_assets/models/missing.bin").isOk());
+    }
+
+    SECTION("Open Mapped File For Read") {
+        Core::IO::DefaultFileSystem.addMount(&mount);
+
+        Core::StatusOr<Core::IO::InputStream> stream = Core::IO::OpenMappedFileForRead("mapped_assets/models/mesh.bin");
+        REQUIRE(stream.isOk());
+        REQUIRE(stream.value().isMemoryBacked());
+
+        std::optional<Core::Span<const std::byte>> view = stream.value().readBytesView(16);
+        REQUIRE(view.has_value());
+        REQUIRE(std::string_view(reinterpret_cast<const char*>(view->rawData()), view->count()) == "mounted contents");
+    }
+
+    std::filesystem::remove_all(root);
+}
@@ -1,61 +1,99 @@
 #include "core/io/serialization/ArrayBuffer.h"
 
+#include <cstring>
+
 namespace Core::IO {
 
-ArrayBuffer::ArrayBuffer(size_t initialSize) : ArrayBuffer(Core::Array<std::byte>(initialSize)) {}
-ArrayBuffer::ArrayBuffer(Core::Array<std::byte>&& initialData) : data(std::move(initialData)) {
-    updatePointers(0, data.count());
+template <typename ALLOCATOR>
+BasicArrayBuffer<ALLOCATOR>::BasicArrayBuffer(u64 initialCapacity)
+  : BasicArrayBuffer(Core::Array<std::byte, ALLOCATOR>(initialCapacity)) {}
+
+template <typename ALLOCATOR>
+BasicArrayBuffer<ALLOCATOR>::BasicArrayBuffer(u64 initialCapacity, const ALLOCATOR& allocator)
+  : BasicArrayBuffer(Core::Array<std::byte, ALLOCATOR>(initialCapacity, allocator)) {}
+
+template <typename ALLOCATOR>
+BasicArrayBuffer<ALLOCATOR>::BasicArrayBuffer(Core::Array<std::byte, ALLOCATOR>&& initialData)
+  : data(std::move(initialData)) {
+    updateWindows(0);
 }
 
-const Core::Array<std::byte>& ArrayBuffer::buffer() const {
+template <typename ALLOCATOR>
+const Core::Array<std::byte, ALLOCATOR>& BasicArrayBuffer<ALLOCATOR>::buffer() const {
+    commitWrites();
     return data;
 }
 
-Core::Array<std::byte> ArrayBuffer::takeBuffer() {
-    return std::move(data);
-}
+template <typename ALLOCATOR>
+Core::Array<std::byte, ALLOCATOR> BasicArrayBuffer<ALLOCATOR>::takeBuffer() {
+    commitWrites();
+    Core::Array<std::byte, ALLOCATOR> taken = std::move(data);
 
-std::streamsize ArrayBuffer::xsputn(const std::byte* s, std::streamsize n) {
-    std::streamsize bytesWritten = 0;
-    size_t outputOffset          = currentOutputOffset();
+    setReadWindow(nullptr, nullptr);
+    setWriteWindow(nullptr, nullptr);
+    return taken;
+}
 
-    while(outputOffset < data.count() && bytesWritten < n) {
-        data[outputOffset++] = s[bytesWritten++];
-    }
+template <typename ALLOCATOR>
+Core::Span<std::byte> BasicArrayBuffer<ALLOCATOR>::reserveWrite(u64 size) {
+    if(size > static_cast<u64>(writeEnd - writeCursor)) {
+        commitWrites();
+        u64 readOffset = static_cast<u64>(readCursor - readBegin);
 
-    while(bytesWritten < n) {
-        data.emplace(s[bytesWritten++]);
-        outputOffset++;
+        data.ensureCapacity(data.count() + size);
+        updateWindows(readOffset);
     }
 
-    updatePointers(currentInputOffset(), outputOffset);
-    return bytesWritten;
+    return Core::Span<std::byte>(writeCursor, size);
 }
 
-std::streamsize ArrayBuffer::xsgetn(std::byte* s, std::streamsize n) {
-    std::streamsize bytesRead = 0;
-    size_t inputOffset        = currentInputOffset();
+template <typename ALLOCATOR>
+void BasicArrayBuffer<ALLOCATOR>::commit(u64 size) {
+    ASSERT_WITH_MESSAGE(size <= static_cast<u64>(writeEnd - writeCursor),
+                        "Committed {} bytes, but only {} fit into the buffer",
+                        size,
+                        static_cast<u64>(writeEnd - writeCursor));
+    writeCursor += size;
+}
 
-    while(inputOffset < data.count() && bytesRead < n) {
-        s[bytesRead++] = data[inputOffset++];
-    }
+template <typename ALLOCATOR>
+void BasicArrayBuffer<ALLOCATOR>::flush() {
+    commitWrites();
+}
 
-    updatePointers(inputOffset, currentOutputOffset());
-    return bytesRead;
+template <typename ALLOCATOR>
+bool BasicArrayBuffer<ALLOCATOR>::refill() {
+    commitWrites();
+    updateWindows(static_cast<u64>(readCursor - readBegin));
+    return readCursor != readEnd;
 }
 
-void ArrayBuffer::updatePointers(size_t inputOffset, size_t outputOffset) {
-    setg(data.begin(), data.begin(), data.end());
-    setp(data.begin(), data.begin(), data.begin() + data.totalCapacity());
-    gbump(static_cast<int>(inputOffset));
-    pbump(static_cast<int>(outputOffset));
+template <typename ALLOCATOR>
+void BasicArrayBuffer<ALLOCATOR>::overflow(const std::byte* source, u64 size) {
+    Core::Span<std::byte> reserved = reserveWrite(size);
+    if(size != 0) {
+        std::memcpy(reserved.rawData(), source, size);
+    }
+    commit(size);
 }
 
-size_t ArrayBuffer::currentOutputOffset() {
-    return pptr() - pbase();
+template <typename ALLOCATOR>
+void BasicArrayBuffer<ALLOCATOR>::commitWrites() const {
+    // The bytes are already there, this only counts them
+    u64 written = static_cast<u64>(writeCursor - (data.rawData() + data.count()));
+    (void)data.insertUninitialized(written);
 }
 
-size_t ArrayBuffer::currentInputOffset() {
-    return gptr() - eback();
+template <typename ALLOCATOR>
+void BasicArrayBuffer<ALLOCATOR>::updateWindows(u64 readOffset) {
+    std::byte* begin = data.rawData();
+
+    readBegin  = begin;
+    readCursor = begin + readOffset;
+    readEnd    = begin + data.count();
+    setWriteWindow(begin + data.count(), begin + data.totalCapacity());
 }
-}    // namespace Core::IO
\ No newline at end of file
+
+template struct BasicArrayBuffer<Core::Memory::MallocAllocator>;
+template struct BasicArrayBuffer<Core::Memory::ResourceAllocator>;
+}    // namespace Core::IO
@@ -1,27 +1,50 @@
 #pragma once
 
 #include "core/containers/Array.h"
-
-#include <ios>
-#include <streambuf>
+#include "core/io/serialization/StreamBuffer.h"
+#include "core/memory/Allocator.h"
 
 namespace Core::IO {
-struct ArrayBuffer : public std::basic_streambuf<std::byte> {
-    ArrayBuffer(size_t initialSize = 0);
-    ArrayBuffer(Core::Array<std::byte>&& initialData);
+// Only the MallocAllocator and ResourceAllocator versions are compiled, use ResourceAllocator to route the buffer's
+// memory somewhere else.
+//
+// Writes go straight into the array's unused capacity, which is the write window, and are counted as elements of the
+// array when the window is flushed, refilled or the array is looked at. Writes that don't fit grow the array the same
+// way inserting into it does.
+template <typename ALLOCATOR>
+struct BasicArrayBuffer : public StreamBuffer {
+    BasicArrayBuffer(u64 initialCapacity = 0);
+    BasicArrayBuffer(u64 initialCapacity, const ALLOCATOR& allocator);
+    BasicArrayBuffer(Core::Array<std::byte, ALLOCATOR>&& initialData);
+
+    const Core::Array<std::byte, ALLOCATOR>& buffer() const;
 
-    const Core::Array<std::byte>& buffer() const;
+    [[nodiscard]] Core::Array<std::byte, ALLOCATOR> takeBuffer();
 
-    [[nodiscard]] Core::Array<std::byte> takeBuffer();
+    // Room for size more bytes after everything written so far, for compressors and the like to write into directly
+    // instead of through a stream. Only the first bytes passed to commit are kept, and nothing else may be written to
+    // the buffer in between.
+    [[nodiscard]] Core::Span<std::byte> reserveWrite(u64 size);
+    void commit(u64 size);
+
+    void flush() override;
 
 protected:
-    std::streamsize xsputn(const std::byte* s, std::streamsize n) override;
-    std::streamsize xsgetn(std::byte* s, std::streamsize n) override;
+    bool refill() override;
+    void overflow(const std::byte* source, u64 size) override;
 
 private:
-    Core::Array<std::byte> data;
-    void updatePointers(size_t inputOffset, size_t outputOffset);
-    size_t currentOutputOffset();
-    size_t currentInputOffset();
+    // Counts the bytes written into the unused capacity as elements
+    void commitWrites() const;
+
+    // Points the windows at the array again after it was reallocated
+    void updateWindows(u64 readOffset);
+
+    mutable Core::Array<std::byte, ALLOCATOR> data;
 };
-}    // namespace Core::IO
\ No newline at end of file
+
+using ArrayBuffer = BasicArrayBuffer<Core::Memory::MallocAllocator>;
+
+extern template struct BasicArrayBuffer<Core::Memory::MallocAllocator>;
+extern template struct BasicArrayBuffer<Core::Memory::ResourceAllocator>;
+}    // namespace Core::IO
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "core/Types.h"
+#include "core/containers/Array.h"
+#include "core/containers/Span.h"
+#include "core/io/serialization/BinarySerializable.h"
+#include "core/io/serialization/InputStream.h"
+#include "core/io/serialization/OutputStream.h"
+
+#include <bit>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+namespace Core::IO {
+
+// An array that is deserialized in place. Read from a memory backed stream it points into the memory the stream reads
+// from, so it copies nothing but must not outlive that memory. Read from any other stream, or when the elements
+// aren't aligned to ALIGNMENT in memory, it copies them into an array it owns instead.
+//
+// It's serialized the same way as a Core::Array<T>, so a type can switch between owning and borrowing arrays without
+// changing its files.
+template <BinarySerializable T, u64 ALIGNMENT = alignof(T)>
+class BorrowedArray {
+public:
+    static_assert(std::has_single_bit(ALIGNMENT) && ALIGNMENT >= alignof(T));
+    static_assert(ALIGNMENT <= alignof(std::max_align_t), "Copied elements have to be aligned to ALIGNMENT too");
+
+    BorrowedArray() = default;
+    explicit BorrowedArray(Core::Span<const T> borrowed) : elements(borrowed) {}
+    explicit BorrowedArray(Core::Array<T>&& owned) : owned(std::move(owned)), elements(Core::ToSpan(*this->owned)) {}
+
+    // The owned array's elements stay where they are when it's moved, so the span stays valid
+    BorrowedArray(BorrowedArray&& other) = default;
+    BorrowedArray& operator=(BorrowedArray&& other) = default;
+    BorrowedArray(const BorrowedArray& other)       = delete;
+    BorrowedArray& operator=(const BorrowedArray& other) = delete;
+
+    [[nodiscard]] bool isBorrowed() const {
+        return !owned.has_value();
+    }
+
+    [[nodiscard]] Core::Span<const T> span() const {
+        return elements;
+    }
+
+    [[nodiscard]] std::string_view view() const requires std::is_same_v<T, char> {
+        return std::string_view(elements.rawData(), elements.count());
+    }
+
+    [[nodiscard]] const T& operator[](u64 i) const {
+        return elements[i];
+    }
+
+    [[nodiscard]] u64 count() const {
+        return elements.count();
+    }
+
+    [[nodiscard]] bool isEmpty() const {
+        return elements.isEmpty();
+    }
+
+    [[nodiscard]] const T* begin() const {
+        return elements.begin();
+    }
+
+    [[nodiscard]] const T* end() const {
+        return elements.end();
+    }
+
+private:
+    std::optional<Core::Array<T>> owned;
+    Core::Span<const T> elements = Core::Span<const T>(nullptr, 0);
+};
+
+// Serialized like a std::string, and only valid as long as the memory it was read from
+using BorrowedString = BorrowedArray<char>;
+
+template <BinarySerializable T, u64 ALIGNMENT>
+struct Serializer<BorrowedArray<T, ALIGNMENT>> {
+    static void serialize(OutputStream& stream, const BorrowedArray<T, ALIGNMENT>& values) {
+        stream.write(values.count());
+        stream.write(Core::AsBytes(values.span()));
+    }
+};
+
+template <BinarySerializable T, u64 ALIGNMENT>
+struct Deserializer<BorrowedArray<T, ALIGNMENT>> {
+    static BorrowedArray<T, ALIGNMENT> deserialize(InputStream& stream) {
+        u64 elementCount = stream.read<u64>();
+
+        std::optional<Core::Span<const std::byte>> bytes = stream.readBytesView(elementCount * sizeof(T), ALIGNMENT);
+        if(bytes.has_value()) {
+            return BorrowedArray<T, ALIGNMENT>(
+                  Core::Span<const T>(reinterpret_cast<const T*>(bytes->rawData()), elementCount));
+        }
+
+        Core::Array<T> owned(elementCount);
+        stream.readInto<T>(owned.insertUninitialized(elementCount));
+        return BorrowedArray<T, ALIGNMENT>(std::move(owned));
+    }
+};
+
+}    // namespace Core::IO
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "core/containers/Span.h"
+#include "core/io/serialization/StreamBuffer.h"
+
+#include <cstddef>
+
+namespace Core::IO {
+
+// A stream buffer that reads from a single block of memory it doesn't own. Its read window is that whole block, so
+// streams reading from one can hand out spans of the memory instead of copying bytes out of it, see
+// InputStream::readView.
+class ContiguousStreamBuffer : public StreamBuffer {
+protected:
+    explicit ContiguousStreamBuffer(Core::Span<const std::byte> memory) {
+        setReadWindow(memory.rawData(), memory.rawData() + memory.count());
+        contiguous = true;
+    }
+};
+
+}    // namespace Core::IO
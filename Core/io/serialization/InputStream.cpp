@@ -1,26 +1,37 @@
 #include "core/io/serialization/InputStream.h"
 
 namespace Core::IO {
-InputStream::InputStream(std::basic_streambuf<std::byte>* stream)
-  : stream(std::make_unique<class std::basic_istream<std::byte>>(stream)) {}
+InputStream::InputStream(StreamBuffer* buffer) : buffer(buffer) {}
 
-InputStream::InputStream(std::unique_ptr<class std::basic_istream<std::byte>>&& stream) : stream(std::move(stream)) {}
+InputStream::InputStream(std::unique_ptr<StreamBuffer>&& buffer)
+  : ownedBuffer(std::move(buffer)), buffer(ownedBuffer.get()) {}
 
-InputStream::InputStream(InputStream&& other) : stream(std::move(other.stream)) {}
+InputStream::InputStream(InputStream&& other) : ownedBuffer(std::move(other.ownedBuffer)), buffer(other.buffer) {}
 
-uint64_t InputStream::readInto(std::byte* buffer, uint64_t size) {
-    stream->read(buffer, size);
-    return stream->gcount();
+bool InputStream::isMemoryBacked() const {
+    return buffer->isContiguous();
 }
 
-Core::Status InputStream::rewind(uint64_t byteCount) {
-    for(uint64_t i = 0; i < byteCount; i++) {
-        if(!stream->unget()) {
-            return Core::Status::Error(
-                  "Tried to rewind the stream by {} bytes, but failed after {} bytes", byteCount, i);
-        }
+std::optional<Core::Span<const std::byte>> InputStream::readBytesView(uint64_t size, uint64_t alignment) {
+    if(!buffer->isContiguous()) {
+        return std::nullopt;
+    }
+
+    Core::Span<const std::byte> unread = buffer->unreadBytes();
+    ASSERT_WITH_MESSAGE(size <= unread.count(),
+                        "Expected to read {} bytes from the stream, but only {} were available",
+                        size,
+                        unread.count());
+
+    if(reinterpret_cast<uintptr_t>(unread.rawData()) % alignment != 0) {
+        return std::nullopt;
     }
 
-    return Core::Status::Ok();
+    buffer->skip(size);
+    return unread.first(size);
+}
+
+Core::Status InputStream::rewind(uint64_t byteCount) {
+    return buffer->rewind(byteCount);
 }
-}    // namespace Core::IO
\ No newline at end of file
+}    // namespace Core::IO
@@ -3,10 +3,11 @@
 #include "core/io/serialization/BinarySerializable.h"
 
 #include "core/containers/Span.h"
+#include "core/io/serialization/StreamBuffer.h"
 #include "core/status/Status.h"
 
-#include <istream>
 #include <memory>
+#include <optional>
 #include <span>
 #include <string>
 #include <variant>
@@ -23,13 +24,17 @@ concept Deserializable = requires(T a) {
     typename Deserializer<T>;
 };
 
+// Reads from a StreamBuffer. Reads that fit into the buffer's read window are inlined to a memcpy, only reads past it
+// call into the buffer.
 struct InputStream {
 private:
-    std::unique_ptr<std::basic_istream<std::byte>> stream;
+    // Set for streams that own their buffer, such as the ones reading files
+    std::unique_ptr<StreamBuffer> ownedBuffer;
+    StreamBuffer* buffer;
 
 public:
-    InputStream(std::basic_streambuf<std::byte>* stream);
-    InputStream(std::unique_ptr<std::basic_istream<std::byte>>&& stream);
+    InputStream(StreamBuffer* buffer);
+    InputStream(std::unique_ptr<StreamBuffer>&& buffer);
     InputStream(InputStream&& other);
 
     template <Deserializable T>
@@ -37,12 +42,14 @@ public:
         return Deserializer<T>::deserialize(*this);
     }
 
-    uint64_t readInto(std::byte* buffer, uint64_t size);
+    uint64_t readInto(std::byte* destination, uint64_t size) {
+        return buffer->read(destination, size);
+    }
 
     template <BinarySerializable T>
-    void readInto(Core::Span<T> buffer) {
-        uint64_t requiredSize = buffer.count() * sizeof(T);
-        uint64_t actualSize   = readInto(reinterpret_cast<std::byte*>(buffer.rawData()), requiredSize);
+    void readInto(Core::Span<T> destination) {
+        uint64_t requiredSize = destination.count() * sizeof(T);
+        uint64_t actualSize   = readInto(reinterpret_cast<std::byte*>(destination.rawData()), requiredSize);
 
         ASSERT_WITH_MESSAGE(requiredSize == actualSize,
                             "Expected to read {} bytes from the stream, but only {} were available",
@@ -50,6 +57,25 @@ public:
                             actualSize);
     }
 
+    // Whether the stream reads straight from a block of memory, so that readView can borrow from it
+    [[nodiscard]] bool isMemoryBacked() const;
+
+    // The next size bytes as a span of the memory the stream reads from, which is only valid as long as that memory
+    // is. Streams that aren't memory backed can't do this, and neither can any stream when the bytes don't start at a
+    // multiple of alignment. Nothing is read then, so the bytes can still be copied out with readInto.
+    [[nodiscard]] std::optional<Core::Span<const std::byte>> readBytesView(uint64_t size, uint64_t alignment = 1);
+
+    // The same for the next count Ts, which have to be aligned for T
+    template <BinarySerializable T>
+    [[nodiscard]] std::optional<Core::Span<const T>> readView(uint64_t count) {
+        std::optional<Core::Span<const std::byte>> bytes = readBytesView(count * sizeof(T), alignof(T));
+        if(!bytes.has_value()) {
+            return std::nullopt;
+        }
+
+        return Core::Span<const T>(reinterpret_cast<const T*>(bytes->rawData()), count);
+    }
+
     Core::Status rewind(uint64_t byteCount);
 };
 
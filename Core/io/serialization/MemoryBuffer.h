@@ -1,18 +1,18 @@
 #pragma once
 
 #include "core/containers/Span.h"
-
-#include <streambuf>
+#include "core/io/serialization/ContiguousStreamBuffer.h"
 
 namespace Core::IO {
-struct MemoryBuffer : public std::basic_streambuf<std::byte> {
+// Reads from and writes over a block of memory, writing past its end aborts
+struct MemoryBuffer : public ContiguousStreamBuffer {
     MemoryBuffer(std::byte* data, size_t size);
     MemoryBuffer(Core::Span<std::byte> data);
 };
 
-struct ReadOnlyMemoryBuffer : public std::basic_streambuf<std::byte> {
+struct ReadOnlyMemoryBuffer : public ContiguousStreamBuffer {
     ReadOnlyMemoryBuffer(const std::byte* data, size_t size);
     ReadOnlyMemoryBuffer(Core::Span<const std::byte> data);
 };
 
-}    // namespace Core::IO
\ No newline at end of file
+}    // namespace Core::IO
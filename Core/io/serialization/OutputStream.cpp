@@ -1,25 +1,19 @@
 #include "core/io/serialization/OutputStream.h"
 
-#include <ostream>
-
 namespace Core::IO {
-OutputStream::OutputStream(std::basic_streambuf<std::byte>* stream)
-  : stream(std::make_unique<std::basic_ostream<std::byte>>(stream)) {}
-
-OutputStream::OutputStream(std::unique_ptr<std::basic_ostream<std::byte>>&& stream) : stream(std::move(stream)) {}
+OutputStream::OutputStream(StreamBuffer* buffer) : buffer(buffer) {}
 
-OutputStream::OutputStream(OutputStream&& other) : stream(std::move(other.stream)) {}
+OutputStream::OutputStream(std::unique_ptr<StreamBuffer>&& buffer)
+  : ownedBuffer(std::move(buffer)), buffer(ownedBuffer.get()) {}
 
-void OutputStream::write(Core::Span<const std::byte> data) {
-    stream->write(data.rawData(), data.count());
-}
-
-void OutputStream::write(Core::Span<std::byte> data) {
-    stream->write(data.rawData(), data.count());
-}
+OutputStream::OutputStream(OutputStream&& other) : ownedBuffer(std::move(other.ownedBuffer)), buffer(other.buffer) {}
 
 void OutputStream::writeText(const std::string_view text) {
     write(Core::AsBytes(Core::ToSpan(text)));
 }
 
-}    // namespace Core::IO
\ No newline at end of file
+void OutputStream::flush() {
+    buffer->flush();
+}
+
+}    // namespace Core::IO
@@ -2,6 +2,7 @@
 
 #include "core/containers/Span.h"
 #include "core/io/serialization/BinarySerializable.h"
+#include "core/io/serialization/StreamBuffer.h"
 
 #include <memory>
 #include <span>
@@ -21,17 +22,26 @@ concept Serializable = requires(T a) {
     typename Serializer<T>;
 };
 
+// Writes to a StreamBuffer. Writes that fit into the buffer's write window are inlined to a memcpy, only writes past
+// it call into the buffer.
 struct OutputStream {
 private:
-    std::unique_ptr<class std::basic_ostream<std::byte>> stream;
+    // Set for streams that own their buffer, such as the ones writing files
+    std::unique_ptr<StreamBuffer> ownedBuffer;
+    StreamBuffer* buffer;
 
 public:
-    OutputStream(std::basic_streambuf<std::byte>* stream);
-    OutputStream(std::unique_ptr<class std::basic_ostream<std::byte>>&& stream);
+    OutputStream(StreamBuffer* buffer);
+    OutputStream(std::unique_ptr<StreamBuffer>&& buffer);
     OutputStream(OutputStream&& other);
 
-    void write(Core::Span<const std::byte> data);
-    void write(Core::Span<std::byte> data);
+    void write(Core::Span<const std::byte> data) {
+        buffer->write(data.rawData(), data.count());
+    }
+
+    void write(Core::Span<std::byte> data) {
+        buffer->write(data.rawData(), data.count());
+    }
 
     void writeText(const std::string_view text);
 
@@ -39,6 +49,10 @@ public:
     void write(const T& value) {
         Serializer<T>::serialize(*this, value);
     }
+
+    // Hands everything written so far on to wherever the buffer writes to, such as a file. Buffers flush by themselves
+    // when they are destroyed.
+    void flush();
 };
 
 template <typename T>
@@ -0,0 +1,51 @@
+#include "core/io/serialization/StreamBuffer.h"
+
+#include <algorithm>
+
+namespace Core::IO {
+
+Core::Status StreamBuffer::rewind(u64 byteCount) {
+    u64 readInWindow = static_cast<u64>(readCursor - readBegin);
+    if(byteCount > readInWindow) {
+        return Core::Status::Error(
+              "Tried to rewind the stream by {} bytes, but only {} can still be read again", byteCount, readInWindow);
+    }
+
+    readCursor -= byteCount;
+    return Core::Status::Ok();
+}
+
+void StreamBuffer::overflow(const std::byte*, u64 size) {
+    Core::AbortWithMessage("Tried to write {} bytes past the end of a stream buffer that can't take any more", size);
+}
+
+u64 StreamBuffer::underflow(std::byte* destination, u64 size) {
+    u64 copied = 0;
+    while(copied < size && refill()) {
+        u64 available = std::min<u64>(size - copied, static_cast<u64>(readEnd - readCursor));
+        std::memcpy(destination + copied, readCursor, available);
+        readCursor += available;
+        copied += available;
+    }
+    return copied;
+}
+
+u64 StreamBuffer::readPastWindow(std::byte* destination, u64 size) {
+    u64 available = static_cast<u64>(readEnd - readCursor);
+    if(available != 0) {
+        std::memcpy(destination, readCursor, available);
+        readCursor += available;
+    }
+    return available + underflow(destination + available, size - available);
+}
+
+void StreamBuffer::writePastWindow(const std::byte* source, u64 size) {
+    u64 fitting = static_cast<u64>(writeEnd - writeCursor);
+    if(fitting != 0) {
+        std::memcpy(writeCursor, source, fitting);
+        writeCursor += fitting;
+    }
+    overflow(source + fitting, size - fitting);
+}
+
+}    // namespace Core::IO
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "core/Types.h"
+#include "core/assert/Assert.h"
+#include "core/containers/Span.h"
+#include "core/status/Status.h"
+
+#include <cstddef>
+#include <cstring>
+
+namespace Core::IO {
+
+// Where an InputStream reads from and an OutputStream writes to. Reads and writes copy straight out of and into a
+// window of memory the buffer sets up, so reading or writing a u32 is a bounds check and a memcpy. Buffers are only
+// called through their virtual functions once a window runs out, to refill it from a file or to flush it into an
+// array, a compressor and so on.
+//
+// Reading and writing move separate windows, and all streams made from the same buffer share them.
+class StreamBuffer {
+public:
+    StreamBuffer()                               = default;
+    StreamBuffer(const StreamBuffer&)            = delete;
+    StreamBuffer& operator=(const StreamBuffer&) = delete;
+
+    virtual ~StreamBuffer() = default;
+
+    // Copies the next size bytes into destination, or as many as there are before the end. Returns how many that was.
+    u64 read(std::byte* destination, u64 size) {
+        if(size <= static_cast<u64>(readEnd - readCursor)) [[likely]] {
+            std::memcpy(destination, readCursor, size);
+            readCursor += size;
+            return size;
+        }
+        return readPastWindow(destination, size);
+    }
+
+    void write(const std::byte* source, u64 size) {
+        if(size <= static_cast<u64>(writeEnd - writeCursor)) [[likely]] {
+            std::memcpy(writeCursor, source, size);
+            writeCursor += size;
+            return;
+        }
+        writePastWindow(source, size);
+    }
+
+    // Whether the read window holds everything that is left to read, in memory that stays where it is for as long as
+    // the buffer does. Reads from these buffers can borrow that memory instead of copying out of it.
+    [[nodiscard]] bool isContiguous() const {
+        return contiguous;
+    }
+
+    // The bytes left in the read window
+    [[nodiscard]] Core::Span<const std::byte> unreadBytes() const {
+        return Core::Span<const std::byte>(readCursor, static_cast<u64>(readEnd - readCursor));
+    }
+
+    // Moves past bytes that were read through unreadBytes
+    void skip(u64 byteCount) {
+        ASSERT(byteCount <= static_cast<u64>(readEnd - readCursor));
+        readCursor += byteCount;
+    }
+
+    // Steps back over bytes that were read, which only works as far back as the start of the current read window
+    Core::Status rewind(u64 byteCount);
+
+    // Hands what was written so far on to wherever the buffer writes to
+    virtual void flush() {}
+
+protected:
+    // Called when everything in the read window was read. Sets up the next window with setReadWindow, or returns false
+    // at the end.
+    virtual bool refill() {
+        return false;
+    }
+
+    // Called with the bytes of a write that didn't fit, after as many as fit were copied into the write window. The
+    // buffer has to take all of them, usually by flushing the window, and can set up a new window with setWriteWindow.
+    virtual void overflow(const std::byte* source, u64 size);
+
+    // Called for reads that need more than the read window has, after what it had was copied into destination. Reads
+    // from one refilled window after the other, buffers that can read large amounts straight into destination
+    // override this to skip the copy.
+    virtual u64 underflow(std::byte* destination, u64 size);
+
+    void setReadWindow(const std::byte* begin, const std::byte* end) {
+        readBegin  = begin;
+        readCursor = begin;
+        readEnd    = end;
+    }
+
+    void setWriteWindow(std::byte* begin, std::byte* end) {
+        writeBegin  = begin;
+        writeCursor = begin;
+        writeEnd    = end;
+    }
+
+    const std::byte* readBegin  = nullptr;
+    const std::byte* readCursor = nullptr;
+    const std::byte* readEnd    = nullptr;
+
+    std::byte* writeBegin  = nullptr;
+    std::byte* writeCursor = nullptr;
+    std::byte* writeEnd    = nullptr;
+
+    bool contiguous = false;
+
+private:
+    u64 readPastWindow(std::byte* destination, u64 size);
+    void writePastWindow(const std::byte* source, u64 size);
+};
+
+}    // namespace Core::IO
@@ -1,12 +1,11 @@
 #pragma once
 
+#include "core/io/serialization/StreamBuffer.h"
 #include "core/io/serialization/compression/Compression.h"
 
-#include <streambuf>
-
 namespace Core::IO::Compression {
 
-class StreamingCompressionBuffer : public std::basic_streambuf<std::byte> {
+class StreamingCompressionBuffer : public Core::IO::StreamBuffer {
 public:
     const CompressionFormat compressionFormat;
 
@@ -32,24 +32,19 @@ Core::StatusOr<Core::Array<std::byte>> ZStdCompress(Core::Span<const std::byte>
         internal::WriteCompressionHeader(header, stream);
     }
 
-    uint32_t level                        = ZStdLevelFromCompressionGoal(flags.goal);
-    Core::Array<std::byte> compressedData = buffer.takeBuffer();
+    // Compressed straight into the buffer behind the header
+    uint32_t level                   = ZStdLevelFromCompressionGoal(flags.goal);
+    Core::Span<std::byte> compressed = buffer.reserveWrite(expectedCompressedSize);
 
-    uint64_t maximumCompressedSize   = compressedData.unusedCapacity();
-    Core::Span<std::byte> compressed = compressedData.insertUninitialized(maximumCompressedSize);
-
-    uint32_t compressedSize =
+    uint64_t compressedSize =
           ZSTD_compress(compressed.rawData(), compressed.count(), bytes.rawData(), bytes.count(), level);
 
     if(ZSTD_isError(compressedSize)) {
         return Core::Status::Error("Error during zstd compression: {}", ZSTD_getErrorName(compressedSize));
     }
 
-    uint64_t garbageElements       = maximumCompressedSize - compressedSize;
-    uint64_t garbageElementsOffset = compressedData.count() - garbageElements;
-
-    compressedData.eraseAt(garbageElementsOffset, garbageElements);
-    return std::move(compressedData);
+    buffer.commit(compressedSize);
+    return buffer.takeBuffer();
 }
 
 
@@ -1,5 +1,7 @@
 #include "core/io/serialization/compression/ZStdCompressionBuffer.h"
 
+#include <cstring>
+
 #define ASSERT_ZSTD_NO_ERROR_IMPL(tempName, value)                \
     size_t tempName = (value);                                    \
     if(ZSTD_isError(tempName))                                    \
@@ -21,49 +23,59 @@ namespace Core::IO::Compression {
 
 ZStdCompressionBuffer::ZStdCompressionBuffer(Core::IO::OutputStream& stream, int32_t level)
   : StreamingCompressionBuffer(CompressionFormat::ZSTD, stream),
-    buffer(ZSTD_CStreamOutSize()),
+    input(ZSTD_CStreamInSize()),
+    output(ZSTD_CStreamOutSize()),
     zstdContext(ZSTD_createCCtx()) {
     ASSERT_WITH_MESSAGE(zstdContext != nullptr, "Unable to create zstd compression context!");
 
     ASSERT_ZSTD_NO_ERROR(ZSTD_CCtx_setParameter(zstdContext, ZSTD_c_compressionLevel, level));
 
-    setp(buffer.begin(), buffer.begin(), buffer.end());
+    (void)input.insertUninitialized(input.totalCapacity());
+    (void)output.insertUninitialized(output.totalCapacity());
+    setWriteWindow(input.begin(), input.end());
 }
 
 ZStdCompressionBuffer::~ZStdCompressionBuffer() {
-    ZSTD_inBuffer input{.src = nullptr, .size = 0, .pos = 0};
-
-    uint32_t remaining;
-    do {
-        ZSTD_outBuffer output{.dst = buffer.rawData(), .size = buffer.unusedCapacity(), .pos = 0};
-        remaining = ZSTD_compressStream2(zstdContext, &output, &input, ZSTD_e_end);
-        ASSERT_ZSTD_NO_ERROR(remaining);
+    compress(nullptr, 0, ZSTD_e_end);
+    ZSTD_freeCCtx(zstdContext);
+}
 
-        std::span<std::byte> newData(buffer.rawData(), output.pos);
-        stream.write(newData);
+void ZStdCompressionBuffer::flush() {
+    compress(nullptr, 0, ZSTD_e_flush);
+    stream.flush();
+}
 
-        // We don't need to clear the output buffer because we just overwrite the data the next time
-        // we compress to it. It doesn't actually keep track of the number of elements.
-    } while(remaining != 0);
+void ZStdCompressionBuffer::overflow(const std::byte* source, u64 size) {
+    // Writes larger than the window are compressed where they are instead of being copied into it piece by piece
+    if(size >= input.count()) {
+        compress(source, size, ZSTD_e_continue);
+        return;
+    }
 
-    ZSTD_freeCCtx(zstdContext);
+    compress(nullptr, 0, ZSTD_e_continue);
+    std::memcpy(writeCursor, source, size);
+    writeCursor += size;
 }
 
-std::streamsize ZStdCompressionBuffer::xsputn(const std::byte* s, std::streamsize n) {
-    ZSTD_inBuffer input{.src = s, .size = size_t(n), .pos = 0};
+void ZStdCompressionBuffer::compress(const std::byte* source, u64 size, ZSTD_EndDirective mode) {
+    ZSTD_inBuffer windowInput{.src = writeBegin, .size = static_cast<size_t>(writeCursor - writeBegin), .pos = 0};
+    ZSTD_inBuffer sourceInput{.src = source, .size = size, .pos = 0};
 
-    while(input.pos != input.size) {
-        ZSTD_outBuffer output{.dst = buffer.rawData(), .size = buffer.count(), .pos = 0};
-        ASSERT_ZSTD_NO_ERROR(ZSTD_compressStream2(zstdContext, &output, &input, ZSTD_e_continue));
+    for(ZSTD_inBuffer* pending : {&windowInput, &sourceInput}) {
+        // Only the last input ends the frame or flushes, the window is always compressed with the data after it
+        ZSTD_EndDirective pendingMode = pending == &sourceInput ? mode : ZSTD_e_continue;
 
-        std::span<std::byte> newData(buffer.rawData(), output.pos);
-        stream.write(newData);
+        size_t remaining = 0;
+        do {
+            ZSTD_outBuffer compressed{.dst = output.rawData(), .size = output.count(), .pos = 0};
+            remaining = ZSTD_compressStream2(zstdContext, &compressed, pending, pendingMode);
+            ASSERT_ZSTD_NO_ERROR(remaining);
 
-        // We don't need to clear the output buffer because we just overwrite the data the next time
-        // we compress to it. It doesn't actually keep track of the number of elements.
+            stream.write(Core::Span<const std::byte>(output.rawData(), compressed.pos));
+        } while(pending->pos < pending->size || (pendingMode != ZSTD_e_continue && remaining != 0));
     }
 
-    return input.pos;
+    writeCursor = writeBegin;
 }
 
 }    // namespace Core::IO::Compression
@@ -4,20 +4,26 @@
 
 #include <zstd.h>
 
-#include <streambuf>
-
 namespace Core::IO::Compression {
 
+// Writes are gathered in a window of the size zstd works best with and compressed a window at a time. The frame is
+// ended when the buffer is destroyed.
 class ZStdCompressionBuffer : public StreamingCompressionBuffer {
 public:
     ZStdCompressionBuffer(Core::IO::OutputStream& stream, int32_t level);
     ~ZStdCompressionBuffer();
 
+    void flush() override;
+
 protected:
-    std::streamsize xsputn(const std::byte* s, std::streamsize n) override;
+    void overflow(const std::byte* source, u64 size) override;
 
 private:
-    Core::Array<std::byte> buffer;
+    // Compresses the bytes in the window and then the given ones, and empties the window
+    void compress(const std::byte* source, u64 size, ZSTD_EndDirective mode);
+
+    Core::Array<std::byte> input;
+    Core::Array<std::byte> output;
     ZSTD_CCtx* zstdContext;
 };
 
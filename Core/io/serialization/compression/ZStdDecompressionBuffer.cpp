@@ -21,35 +21,61 @@ namespace Core::IO::Compression {
 
 ZStdDecompressionBuffer::ZStdDecompressionBuffer(Core::IO::InputStream& stream)
   : StreamingDecompressionBuffer(CompressionFormat::ZSTD, stream),
-    buffer(ZSTD_DStreamInSize()),
+    input(ZSTD_DStreamInSize()),
+    output(ZSTD_DStreamOutSize()),
+    pendingInput{.src = nullptr, .size = 0, .pos = 0},
     zstdContext(ZSTD_createDCtx()) {
     ASSERT_WITH_MESSAGE(zstdContext != nullptr, "Unable to create zstd decompression context!");
 
-    setg(buffer.begin(), buffer.begin(), buffer.end());
+    (void)input.insertUninitialized(input.totalCapacity());
+    (void)output.insertUninitialized(output.totalCapacity());
 }
 
 ZStdDecompressionBuffer::~ZStdDecompressionBuffer() {
     ZSTD_freeDCtx(zstdContext);
 }
 
-std::streamsize ZStdDecompressionBuffer::xsgetn(std::byte* s, std::streamsize n) {
-    ZSTD_outBuffer output{.dst = s, .size = size_t(n), .pos = 0};
+bool ZStdDecompressionBuffer::refill() {
+    u64 decompressed = decompress(output.rawData(), output.count());
+    setReadWindow(output.begin(), output.begin() + decompressed);
+    return decompressed != 0;
+}
 
-    while(output.pos < output.size) {
-        uint64_t inputSize = stream.readInto(buffer.rawData(), buffer.unusedCapacity());
+u64 ZStdDecompressionBuffer::underflow(std::byte* destination, u64 size) {
+    if(size < output.count()) {
+        return StreamBuffer::underflow(destination, size);
+    }
 
-        if(inputSize == 0) {
+    u64 decompressed = 0;
+    while(decompressed < size) {
+        u64 decompressedNow = decompress(destination + decompressed, size - decompressed);
+        if(decompressedNow == 0) {
             break;
         }
+        decompressed += decompressedNow;
+    }
+    return decompressed;
+}
 
-        ZSTD_inBuffer input{.src = buffer.rawData(), .size = inputSize, .pos = 0};
+u64 ZStdDecompressionBuffer::decompress(std::byte* destination, u64 size) {
+    ZSTD_outBuffer decompressed{.dst = destination, .size = size, .pos = 0};
 
-        while(input.pos < input.size) {
-            ASSERT_ZSTD_NO_ERROR(ZSTD_decompressStream(zstdContext, &output, &input));
+    while(decompressed.pos == 0) {
+        bool inputEnded = false;
+        if(pendingInput.pos == pendingInput.size) {
+            u64 inputSize = stream.readInto(input.rawData(), input.count());
+            pendingInput  = ZSTD_inBuffer{.src = input.rawData(), .size = inputSize, .pos = 0};
+            inputEnded    = inputSize == 0;
+        }
+
+        // Without input this still hands out what zstd held back when the destination was full last time
+        ASSERT_ZSTD_NO_ERROR(ZSTD_decompressStream(zstdContext, &decompressed, &pendingInput));
+        if(inputEnded) {
+            break;
         }
     }
 
-    return output.pos;
+    return decompressed.pos;
 }
 
 }    // namespace Core::IO::Compression
@@ -4,20 +4,29 @@
 
 #include <zstd.h>
 
-#include <streambuf>
-
 namespace Core::IO::Compression {
 
+// Decompresses into a window of the size zstd works best with, reads larger than the window are decompressed straight
+// into their destination instead
 class ZStdDecompressionBuffer : public StreamingDecompressionBuffer {
 public:
     ZStdDecompressionBuffer(Core::IO::InputStream& stream);
     ~ZStdDecompressionBuffer();
 
 protected:
-    std::streamsize xsgetn(std::byte* s, std::streamsize n) override;
+    bool refill() override;
+    u64 underflow(std::byte* destination, u64 size) override;
 
 private:
-    Core::Array<std::byte> buffer;
+    // Decompresses until at least one byte was written to destination, returns how many were. Only returns 0 once
+    // the compressed stream ran out.
+    u64 decompress(std::byte* destination, u64 size);
+
+    Core::Array<std::byte> input;
+    Core::Array<std::byte> output;
+
+    // The compressed bytes in input that zstd hasn't taken yet
+    ZSTD_inBuffer pendingInput;
     ZSTD_DCtx* zstdContext;
 };
 
@@ -0,0 +1,149 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/containers/Array.h"
+#include "core/io/serialization/ArrayBuffer.h"
+#include "core/io/serialization/Borrowed.h"
+#include "core/io/serialization/InputStream.h"
+#include "core/io/serialization/MemoryBuffer.h"
+#include "core/io/serialization/OutputStream.h"
+#include "core/io/serialization/StreamBuffer.h"
+
+#include <algorithm>
+#include <string>
+
+namespace {
+
+Core::Array<std::byte> Serialized(const Core::Array<uint32_t>& numbers, const std::string& text) {
+    Core::IO::ArrayBuffer storage;
+    Core::IO::OutputStream stream(&storage);
+    stream.write(numbers);
+    stream.write(text);
+    return storage.takeBuffer();
+}
+
+// Hands out its memory a few bytes at a time, so that reads keep running past the end of the read window
+class TrickleBuffer : public Core::IO::StreamBuffer {
+public:
+    TrickleBuffer(Core::Span<const std::byte> memory, u64 windowSize) : memory(memory), windowSize(windowSize) {}
+
+    u64 refills = 0;
+
+protected:
+    bool refill() override {
+        u64 size = std::min(windowSize, memory.count() - position);
+        setReadWindow(memory.rawData() + position, memory.rawData() + position + size);
+        position += size;
+        refills++;
+        return size != 0;
+    }
+
+private:
+    Core::Span<const std::byte> memory;
+    u64 windowSize;
+    u64 position = 0;
+};
+
+}    // namespace
+
+TEST_CASE("Input Stream Views Into Memory") {
+    Core::Array<uint32_t> numbers = {1, 2, 3, 4};
+    Core::Array<std::byte> bytes  = Serialized(numbers, "text");
+
+    Core::IO::ReadOnlyMemoryBuffer buffer(Core::ToSpan(bytes));
+    Core::IO::InputStream stream(&buffer);
+    REQUIRE(stream.isMemoryBacked());
+
+    REQUIRE(stream.read<uint64_t>() == 4);
+    std::optional<Core::Span<const uint32_t>> view = stream.readView<uint32_t>(4);
+    REQUIRE(view.has_value());
+    REQUIRE(reinterpret_cast<const std::byte*>(view->rawData()) == bytes.rawData() + sizeof(uint64_t));
+    REQUIRE((*view)[0] == 1);
+    REQUIRE((*view)[3] == 4);
+
+    // Reading goes on after the borrowed bytes
+    REQUIRE(stream.read<std::string>() == "text");
+}
+
+TEST_CASE("Input Stream Views Need Aligned Memory") {
+    Core::Array<std::byte> bytes(std::byte(7), 9);
+
+    Core::IO::ReadOnlyMemoryBuffer buffer(Core::ToSpan(bytes));
+    Core::IO::InputStream stream(&buffer);
+    REQUIRE(stream.read<uint8_t>() == 7);
+
+    // Nothing is read when the view can't be made
+    REQUIRE(!stream.readView<uint32_t>(2).has_value());
+    REQUIRE(stream.readView<uint8_t>(8).has_value());
+}
+
+TEST_CASE("Input Stream Views Need Memory Backed Streams") {
+    Core::IO::ArrayBuffer storage(Serialized({5, 6}, "text"));
+    Core::IO::InputStream stream(&storage);
+    REQUIRE(!stream.isMemoryBacked());
+
+    REQUIRE(stream.read<uint64_t>() == 2);
+    REQUIRE(!stream.readView<uint32_t>(2).has_value());
+}
+
+TEST_CASE("Input Stream Borrowed Arrays") {
+    Core::Array<uint32_t> numbers = {1, 2, 3};
+    Core::Array<std::byte> bytes  = Serialized(numbers, "entry");
+
+    Core::IO::ReadOnlyMemoryBuffer buffer(Core::ToSpan(bytes));
+    Core::IO::InputStream borrowing(&buffer);
+
+    auto borrowedNumbers            = borrowing.read<Core::IO::BorrowedArray<uint32_t>>();
+    Core::IO::BorrowedString string = borrowing.read<Core::IO::BorrowedString>();
+    REQUIRE(borrowedNumbers.isBorrowed());
+    REQUIRE(borrowedNumbers.count() == 3);
+    REQUIRE(borrowedNumbers[2] == 3);
+    REQUIRE(string.isBorrowed());
+    REQUIRE(string.view() == "entry");
+
+    // Other streams get a copy, which survives being moved
+    Core::IO::ArrayBuffer storage(Serialized(numbers, "entry"));
+    Core::IO::InputStream copying(&storage);
+
+    auto copiedNumbers                      = copying.read<Core::IO::BorrowedArray<uint32_t>>();
+    Core::IO::BorrowedArray<uint32_t> moved = std::move(copiedNumbers);
+    REQUIRE(!moved.isBorrowed());
+    REQUIRE(moved.count() == 3);
+    REQUIRE(moved[0] == 1);
+    REQUIRE(moved[2] == 3);
+    REQUIRE(copying.read<Core::IO::BorrowedString>().view() == "entry");
+
+    // Borrowed arrays are written the same way as the arrays they were read from
+    Core::IO::ArrayBuffer rewritten;
+    Core::IO::OutputStream output(&rewritten);
+    output.write(borrowedNumbers);
+    output.write(string);
+
+    Core::IO::InputStream reread(&rewritten);
+    REQUIRE(reread.read<Core::Array<uint32_t>>().count() == 3);
+    REQUIRE(reread.read<std::string>() == "entry");
+}
+
+TEST_CASE("Input Stream Reads Across Refilled Windows") {
+    Core::Array<uint32_t> numbers = {1, 2, 3, 4, 5, 6, 7};
+    Core::Array<std::byte> bytes  = Serialized(numbers, "a longer piece of text");
+
+    TrickleBuffer buffer(Core::ToSpan(bytes), 3);
+    Core::IO::InputStream stream(&buffer);
+    REQUIRE(!stream.isMemoryBacked());
+
+    Core::Array<uint32_t> read = stream.read<Core::Array<uint32_t>>();
+    REQUIRE(read.count() == 7);
+    REQUIRE(read[6] == 7);
+    REQUIRE(stream.read<std::string>() == "a longer piece of text");
+    REQUIRE(buffer.refills > 1);
+
+    // Only bytes from the current window can be read again
+    REQUIRE(stream.rewind(1).isOk());
+    REQUIRE(stream.rewind(100).isError());
+
+    // Reads at the end copy what is left
+    std::byte past[4];
+    REQUIRE(stream.readInto(past, 4) == 1);
+    REQUIRE(past[0] == std::byte('t'));
+    REQUIRE(stream.readInto(past, 4) == 0);
+}
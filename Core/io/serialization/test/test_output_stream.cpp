@@ -1,9 +1,12 @@
 #include <catch2/catch_test_macros.hpp>
 
+#include "core/containers/Array.h"
 #include "core/io/serialization/ArrayBuffer.h"
 #include "core/io/serialization/InputStream.h"
 #include "core/io/serialization/OutputStream.h"
 
+#include <string>
+
 
 TEST_CASE("Output integers") {
     Core::IO::ArrayBuffer storage;
@@ -18,4 +21,51 @@ TEST_CASE("Output integers") {
     for(size_t i = 0; i < sizeof(size_t); i++) {
         CHECK(rawBuffer[i] == rawValue[i]);
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Output Large Writes Between Reads") {
+    Core::IO::ArrayBuffer storage;
+    Core::IO::OutputStream output(&storage);
+    Core::IO::InputStream input(&storage);
+
+    Core::Array<uint64_t> numbers;
+    for(uint64_t i = 0; i < 1000; i++) {
+        numbers.insert(i);
+    }
+
+    // The first write fits into the array's capacity, the second one makes it grow underneath the read window
+    output.write(uint32_t(17));
+    REQUIRE(input.read<uint32_t>() == 17);
+    output.write(numbers);
+    output.write(std::string("after"));
+
+    Core::Array<uint64_t> read = input.read<Core::Array<uint64_t>>();
+    REQUIRE(read.count() == 1000);
+    REQUIRE(read[999] == 999);
+    REQUIRE(input.read<std::string>() == "after");
+    REQUIRE(storage.buffer().count() == sizeof(uint32_t) + sizeof(uint64_t) * 1001 + sizeof(size_t) + 5);
+}
+
+TEST_CASE("Output Reserved Writes") {
+    Core::IO::ArrayBuffer storage(8);
+    Core::IO::OutputStream output(&storage);
+    output.write(uint32_t(1));
+
+    // Reserving more than there is room for grows the array, and only what was committed is kept
+    Core::Span<std::byte> reserved = storage.reserveWrite(100);
+    REQUIRE(reserved.count() == 100);
+    REQUIRE(storage.buffer().totalCapacity() >= sizeof(uint32_t) + 100);
+    for(uint64_t i = 0; i < 10; i++) {
+        reserved[i] = std::byte(i);
+    }
+    storage.commit(10);
+    output.write(uint32_t(2));
+
+    Core::IO::InputStream input(&storage);
+    REQUIRE(input.read<uint32_t>() == 1);
+    std::byte committed[10];
+    REQUIRE(input.readInto(committed, 10) == 10);
+    REQUIRE(committed[9] == std::byte(9));
+    REQUIRE(input.read<uint32_t>() == 2);
+    REQUIRE(storage.buffer().count() == sizeof(uint32_t) * 2 + 10);
+}
@@ -0,0 +1,27 @@
+#include "core/jobs/IOTasks.h"
+
+#include "core/io/file_system/FileSystem.h"
+
+namespace Core::Jobs {
+
+// The parameters are taken by value, since the coroutine frame keeps its own copies while it waits to be scheduled
+
+Task<Core::StatusOr<Core::Array<std::byte>>> ReadBinaryFileAsync(JobSystem& jobs, Core::IO::Path file) {
+    co_await ResumeOn(jobs);
+    co_return Core::IO::ReadBinaryFile(file);
+}
+
+Task<Core::StatusOr<std::string>> ReadTextFileAsync(JobSystem& jobs, Core::IO::Path file) {
+    co_await ResumeOn(jobs);
+    co_return Core::IO::ReadTextFile(file);
+}
+
+Task<Core::StatusOr<Core::Array<std::byte>>> DecompressAsync(JobSystem& jobs,
+                                                             Core::Span<const std::byte> bytes,
+                                                             std::optional<uint64_t> uncompressedBytes,
+                                                             Core::IO::Compression::CompressionFlags flags) {
+    co_await ResumeOn(jobs);
+    co_return Core::IO::Compression::Decompress(bytes, uncompressedBytes, flags);
+}
+
+}    // namespace Core::Jobs
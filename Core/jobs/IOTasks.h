@@ -0,0 +1,28 @@
+#pragma once
+
+#include "core/containers/Array.h"
+#include "core/containers/Span.h"
+#include "core/io/file_system/Path.h"
+#include "core/io/serialization/compression/Compression.h"
+#include "core/jobs/JobSystem.h"
+#include "core/jobs/Task.h"
+#include "core/status/StatusOr.h"
+
+#include <optional>
+#include <string>
+
+namespace Core::Jobs {
+
+// Each of these does its work as a job and resumes the coroutine awaiting it on that job's thread
+
+Task<Core::StatusOr<Core::Array<std::byte>>> ReadBinaryFileAsync(JobSystem& jobs, Core::IO::Path file);
+Task<Core::StatusOr<std::string>> ReadTextFileAsync(JobSystem& jobs, Core::IO::Path file);
+
+// bytes have to stay alive until the task is done
+Task<Core::StatusOr<Core::Array<std::byte>>> DecompressAsync(
+      JobSystem& jobs,
+      Core::Span<const std::byte> bytes,
+      std::optional<uint64_t> uncompressedBytes,
+      Core::IO::Compression::CompressionFlags flags = Core::IO::Compression::DEFAULT_BUFFER_FLAGS);
+
+}    // namespace Core::Jobs
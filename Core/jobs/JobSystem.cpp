@@ -0,0 +1,270 @@
+#include "core/jobs/JobSystem.h"
+
+#include <optional>
+#include <utility>
+
+namespace {
+
+struct WorkerIdentity {
+    const Core::Jobs::JobSystem* system = nullptr;
+    u64 index                           = 0;
+};
+
+thread_local WorkerIdentity CurrentWorker;
+
+// Where a thread starts looking for jobs to steal, so that idle threads don't all go after the same worker
+thread_local u64 StealState = 0x9E3779B97F4A7C15;
+
+u64 NextStealStart() {
+    StealState ^= StealState << 13;
+    StealState ^= StealState >> 7;
+    StealState ^= StealState << 17;
+    return StealState;
+}
+
+// Jobs started from threads that aren't workers wait here. When it's full the job runs on the thread that started it.
+constexpr u64 SharedQueueCapacity = 8192;
+
+// How many times an idle worker looks for a job before going to sleep
+constexpr u64 SpinsBeforeSleeping = 64;
+
+}    // namespace
+
+namespace Core::Jobs {
+
+JobCounter::JobCounter() : state(std::make_shared<internal::CounterState>()) {}
+
+bool JobCounter::isDone() const {
+    return state->pending.load(std::memory_order_acquire) == 0;
+}
+
+u64 JobCounter::pendingCount() const {
+    return state->pending.load(std::memory_order_acquire);
+}
+
+JobSystem::JobSystem(u64 workerCount) : sharedJobs(SharedQueueCapacity) {
+    // Every deque exists before any worker starts stealing from them
+    for(u64 i = 0; i < workerCount; i++) {
+        workers.emplace(std::make_unique<Worker>());
+    }
+    for(u64 i = 0; i < workerCount; i++) {
+        workers[i]->thread = std::thread([this, i]() {
+            workerLoop(i);
+        });
+    }
+}
+
+JobSystem::~JobSystem() {
+    stopping.store(true, std::memory_order_seq_cst);
+    generation.fetch_add(1, std::memory_order_seq_cst);
+    generation.notify_all();
+
+    for(std::unique_ptr<Worker>& worker : workers) {
+        worker->thread.join();
+    }
+
+    // Workers only stop once they can't find a job, but jobs started from outside after that are still queued
+    while(internal::Job* job = findJob(NoWorker)) {
+        execute(job);
+    }
+}
+
+void JobSystem::wait(const JobCounter& counter) {
+    u64 workerIndex = currentWorkerIndex();
+
+    while(counter.state->pending.load(std::memory_order_acquire) > 0) {
+        if(internal::Job* job = findJob(workerIndex)) {
+            execute(job);
+            continue;
+        }
+
+        // Nothing to help with, so sleep until the counter is done or another job turns up. Registering as a sleeper
+        // before checking again means whoever finishes the counter or schedules the job sees the sleeper.
+        u64 seenGeneration = generation.load(std::memory_order_seq_cst);
+        sleepers.fetch_add(1, std::memory_order_seq_cst);
+
+        internal::Job* job = nullptr;
+        if(counter.state->pending.load(std::memory_order_seq_cst) > 0) {
+            job = findJob(workerIndex);
+            if(job == nullptr) {
+                generation.wait(seenGeneration, std::memory_order_seq_cst);
+            }
+        }
+
+        sleepers.fetch_sub(1, std::memory_order_seq_cst);
+        if(job != nullptr) {
+            execute(job);
+        }
+    }
+}
+
+void JobSystem::hold(const JobCounter& counter) {
+    counter.state->pending.fetch_add(1, std::memory_order_relaxed);
+}
+
+void JobSystem::release(const JobCounter& counter) {
+    finish(*counter.state);
+}
+
+u64 JobSystem::workerCount() const {
+    return workers.count();
+}
+
+u64 JobSystem::DefaultWorkerCount() {
+    u64 hardwareThreads = std::thread::hardware_concurrency();
+    return hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+}
+
+void JobSystem::start(std::unique_ptr<internal::Job> job, const JobCounter* counter) {
+    if(counter != nullptr) {
+        counter->state->pending.fetch_add(1, std::memory_order_relaxed);
+        job->counter = counter->state;
+    }
+
+    schedule(job.release());
+}
+
+void JobSystem::startAfter(const JobCounter& dependency,
+                           std::unique_ptr<internal::Job> job,
+                           const JobCounter& counter) {
+    counter.state->pending.fetch_add(1, std::memory_order_relaxed);
+    job->counter = counter.state;
+
+    internal::CounterState& dependencyState = *dependency.state;
+    {
+        // Whoever finishes the dependency takes its continuations under the same lock, after the count reaches zero,
+        // so the job is either seen here as ready or picked up there
+        std::scoped_lock lock(dependencyState.continuationLock);
+        if(dependencyState.pending.load(std::memory_order_acquire) > 0) {
+            dependencyState.continuations.emplace(job.release());
+            return;
+        }
+    }
+
+    schedule(job.release());
+}
+
+void JobSystem::schedule(internal::Job* job) {
+    u64 workerIndex = currentWorkerIndex();
+    if(workerIndex != NoWorker) {
+        workers[workerIndex]->jobs.push(job);
+    } else if(!sharedJobs.tryPush(job)) {
+        execute(job);
+        return;
+    }
+
+    wakeSleepers();
+}
+
+void JobSystem::execute(internal::Job* job) {
+    std::unique_ptr<internal::Job> owned(job);
+    owned->run();
+
+    if(owned->counter) {
+        finish(*owned->counter);
+    }
+}
+
+void JobSystem::finish(internal::CounterState& counter) {
+    if(counter.pending.fetch_sub(1, std::memory_order_seq_cst) != 1) {
+        return;
+    }
+
+    Core::Array<internal::Job*> ready;
+    {
+        std::scoped_lock lock(counter.continuationLock);
+        std::swap(ready, counter.continuations);
+    }
+    for(internal::Job* job : ready) {
+        schedule(job);
+    }
+
+    // Threads waiting on the counter may be asleep
+    wakeSleepers();
+}
+
+internal::Job* JobSystem::findJob(u64 workerIndex) {
+    if(workerIndex != NoWorker) {
+        if(std::optional<internal::Job*> job = workers[workerIndex]->jobs.pop()) {
+            return *job;
+        }
+    }
+
+    if(std::optional<internal::Job*> job = sharedJobs.tryPop()) {
+        return *job;
+    }
+
+    u64 count = workers.count();
+    if(count == 0) {
+        return nullptr;
+    }
+
+    u64 first = NextStealStart() % count;
+    for(u64 i = 0; i < count; i++) {
+        u64 victim = (first + i) % count;
+        if(victim == workerIndex) {
+            continue;
+        }
+
+        if(std::optional<internal::Job*> job = workers[victim]->jobs.steal()) {
+            return *job;
+        }
+    }
+
+    return nullptr;
+}
+
+u64 JobSystem::currentWorkerIndex() const {
+    return CurrentWorker.system == this ? CurrentWorker.index : NoWorker;
+}
+
+void JobSystem::wakeSleepers() {
+    // Orders the job or the finished count before reading sleepers, pairing with sleepers being raised before a
+    // sleeping thread looks for either one last time
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if(sleepers.load(std::memory_order_relaxed) > 0) {
+        generation.fetch_add(1, std::memory_order_seq_cst);
+        generation.notify_all();
+    }
+}
+
+void JobSystem::workerLoop(u64 workerIndex) {
+    CurrentWorker = WorkerIdentity{.system = this, .index = workerIndex};
+    StealState += workerIndex * 0x9E3779B97F4A7C15;
+
+    u64 idleSpins = 0;
+    while(true) {
+        if(internal::Job* job = findJob(workerIndex)) {
+            execute(job);
+            idleSpins = 0;
+            continue;
+        }
+
+        if(stopping.load(std::memory_order_acquire)) {
+            break;
+        }
+
+        if(idleSpins++ < SpinsBeforeSleeping) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        u64 seenGeneration = generation.load(std::memory_order_seq_cst);
+        sleepers.fetch_add(1, std::memory_order_seq_cst);
+
+        internal::Job* job = findJob(workerIndex);
+        if(job == nullptr && !stopping.load(std::memory_order_seq_cst)) {
+            generation.wait(seenGeneration, std::memory_order_seq_cst);
+        }
+
+        sleepers.fetch_sub(1, std::memory_order_seq_cst);
+        if(job != nullptr) {
+            execute(job);
+        }
+        idleSpins = 0;
+    }
+
+    CurrentWorker = WorkerIdentity{};
+}
+
+}    // namespace Core::Jobs
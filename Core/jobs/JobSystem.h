@@ -0,0 +1,143 @@
+#pragma once
+
+#include "core/Types.h"
+#include "core/containers/Array.h"
+#include "core/containers/MPMCQueue.h"
+#include "core/containers/Span.h"
+#include "core/jobs/WorkStealingDeque.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace Core::Jobs {
+
+namespace internal {
+
+class Job;
+
+struct CounterState {
+    std::atomic<u64> pending = 0;
+
+    // Jobs to schedule when pending next reaches zero
+    std::mutex continuationLock;
+    Core::Array<Job*> continuations;
+};
+
+class Job {
+public:
+    virtual ~Job() = default;
+    virtual void run() = 0;
+
+    std::shared_ptr<CounterState> counter;
+};
+
+template <typename FUNCTION>
+class FunctionJob final : public Job {
+public:
+    template <typename F>
+    explicit FunctionJob(F&& function) : function(std::forward<F>(function)) {}
+
+    void run() override {
+        function();
+    }
+
+private:
+    FUNCTION function;
+};
+
+}    // namespace internal
+
+// Counts the jobs given to it that haven't finished yet. Copies share the same count. A job keeps its counter alive
+// until it has finished with it, so a counter can live on the stack of whoever waits on it.
+class JobCounter {
+public:
+    JobCounter();
+
+    [[nodiscard]] bool isDone() const;
+    [[nodiscard]] u64 pendingCount() const;
+
+private:
+    friend class JobSystem;
+
+    std::shared_ptr<internal::CounterState> state;
+};
+
+// Runs jobs on a fixed set of worker threads. Each worker has its own deque: jobs a worker starts go on its own deque
+// and are run newest first, while idle workers steal the oldest jobs from the others. Jobs started from other threads
+// go on a shared queue instead.
+//
+// Waiting on a counter runs other jobs until the counter is done instead of blocking the thread, so jobs can wait on
+// jobs they start, and a system with no workers runs everything on the threads that wait.
+class JobSystem {
+public:
+    explicit JobSystem(u64 workerCount = DefaultWorkerCount());
+    JobSystem(const JobSystem& other) = delete;
+    JobSystem& operator=(const JobSystem& other) = delete;
+
+    // Jobs that haven't run yet are run before the system is destroyed
+    ~JobSystem();
+
+    template <typename FUNCTION>
+    void run(FUNCTION&& function);
+
+    template <typename FUNCTION>
+    void run(FUNCTION&& function, const JobCounter& counter);
+
+    // Runs function once dependency is done. It counts towards counter from now, not from when it starts.
+    template <typename FUNCTION>
+    void runAfter(const JobCounter& dependency, FUNCTION&& function, const JobCounter& counter);
+
+    void wait(const JobCounter& counter);
+
+    // Counts something that isn't a job towards counter, such as a coroutine that is suspended until another thread
+    // resumes it, so that it can be waited on like one. Every hold needs a release.
+    void hold(const JobCounter& counter);
+    void release(const JobCounter& counter);
+
+    [[nodiscard]] u64 workerCount() const;
+
+    // One worker for every hardware thread apart from the one the system is made on, which is expected to wait
+    [[nodiscard]] static u64 DefaultWorkerCount();
+
+private:
+    struct Worker {
+        WorkStealingDeque<internal::Job*> jobs;
+        std::thread thread;
+    };
+
+    constexpr static u64 NoWorker = ~u64(0);
+
+    void start(std::unique_ptr<internal::Job> job, const JobCounter* counter);
+    void startAfter(const JobCounter& dependency, std::unique_ptr<internal::Job> job, const JobCounter& counter);
+
+    void schedule(internal::Job* job);
+    void execute(internal::Job* job);
+    void finish(internal::CounterState& counter);
+
+    [[nodiscard]] internal::Job* findJob(u64 workerIndex);
+    [[nodiscard]] u64 currentWorkerIndex() const;
+
+    // Sleeps until a job is scheduled or a counter is done, unless that happened after seenGeneration was read
+    void sleep(u64 seenGeneration);
+    void wakeSleepers();
+
+    void workerLoop(u64 workerIndex);
+
+    Core::Array<std::unique_ptr<Worker>> workers;
+    MPMCQueue<internal::Job*> sharedJobs;
+
+    alignas(CacheLineSize) std::atomic<u64> generation = 0;
+    alignas(CacheLineSize) std::atomic<u64> sleepers   = 0;
+    std::atomic<bool> stopping                         = false;
+};
+
+// Calls function on every element, splitting the span in half until the pieces are no bigger than grainSize and
+// running the pieces as jobs. Returns once every element has been visited.
+template <typename T, typename FUNCTION>
+void ParallelFor(JobSystem& jobs, Span<T> elements, u64 grainSize, const FUNCTION& function);
+
+}    // namespace Core::Jobs
+
+#include "core/jobs/internal/JobSystem.inl"
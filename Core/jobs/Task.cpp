@@ -0,0 +1,21 @@
+#include "core/jobs/Task.h"
+
+namespace Core::Jobs {
+
+ResumeOn::ResumeOn(JobSystem& jobs) : jobs(jobs) {}
+
+bool ResumeOn::await_ready() const {
+    return false;
+}
+
+void ResumeOn::await_suspend(std::coroutine_handle<> awaiting) {
+    // The coroutine may be resumed and finished on another thread before run returns, so nothing in its frame,
+    // including this awaiter, can be used after this
+    jobs.run([awaiting]() {
+        awaiting.resume();
+    });
+}
+
+void ResumeOn::await_resume() const {}
+
+}    // namespace Core::Jobs
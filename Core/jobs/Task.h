@@ -0,0 +1,95 @@
+#pragma once
+
+#include "core/Types.h"
+#include "core/containers/Span.h"
+#include "core/jobs/JobSystem.h"
+#include "core/status/StatusOr.h"
+
+#include <coroutine>
+
+namespace Core::Jobs {
+
+template <typename T>
+class Task;
+
+namespace internal {
+
+template <typename T>
+class Promise;
+
+template <typename T>
+class TaskAwaiter;
+
+template <typename T>
+class CompletionAwaiter;
+
+template <typename T>
+class UnwrapTaskAwaiter;
+
+}    // namespace internal
+
+// A coroutine that produces a T. A task doesn't start until it's awaited, or handed to WhenAll or SyncWait, and then
+// runs on whichever thread that was until it awaits something else. co_await ResumeOn(jobs) moves it onto the job
+// system, so several tasks can load, decode and so on at the same time without callbacks.
+//
+// Tasks that return a Status or StatusOr stop at errors the way ASSIGN_OR_RETURN does. In them, co_await on a Status,
+// a StatusOr or a task returning either gives the value, and an error skips the rest of the coroutine and becomes its
+// result. co_await task.withStatus() gives the Status or StatusOr itself, for errors the coroutine handles.
+template <typename T>
+class [[nodiscard]] Task {
+public:
+    using promise_type = internal::Promise<T>;
+
+    Task(Task&& other) noexcept;
+    Task& operator=(Task&& other) noexcept;
+    Task(const Task& other) = delete;
+    Task& operator=(const Task& other) = delete;
+    ~Task();
+
+    [[nodiscard]] bool isDone() const;
+
+    // Only for tasks that are done, such as ones given to WhenAll
+    T result() &&;
+
+    [[nodiscard]] internal::TaskAwaiter<T> operator co_await() &;
+    [[nodiscard]] internal::TaskAwaiter<T> operator co_await() &&;
+    [[nodiscard]] internal::TaskAwaiter<T> withStatus();
+
+private:
+    friend class internal::Promise<T>;
+    friend class internal::TaskAwaiter<T>;
+    friend class internal::CompletionAwaiter<T>;
+    friend class internal::UnwrapTaskAwaiter<T>;
+
+    explicit Task(std::coroutine_handle<promise_type> handle);
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+// co_await ResumeOn(jobs) continues the coroutine as a job
+class ResumeOn {
+public:
+    explicit ResumeOn(JobSystem& jobs);
+
+    [[nodiscard]] bool await_ready() const;
+    void await_suspend(std::coroutine_handle<> awaiting);
+    void await_resume() const;
+
+private:
+    JobSystem& jobs;
+};
+
+// Runs every task as its own job and finishes once they all have. The results stay in the tasks.
+template <typename... TS>
+Task<void> WhenAll(JobSystem& jobs, Task<TS>&... tasks);
+
+template <typename T>
+Task<void> WhenAll(JobSystem& jobs, Core::Span<Task<T>> tasks);
+
+// Runs task and returns its result. The calling thread runs other jobs while it waits.
+template <typename T>
+T SyncWait(JobSystem& jobs, Task<T> task);
+
+}    // namespace Core::Jobs
+
+#include "core/jobs/internal/Task.inl"
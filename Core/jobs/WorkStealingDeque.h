@@ -0,0 +1,60 @@
+#pragma once
+
+#include "core/Types.h"
+#include "core/containers/Array.h"
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+namespace Core::Jobs {
+
+// The Chase-Lev deque, as corrected for weak memory models by Le, Pop, Cohen and Zappa Nardelli. One thread owns the
+// deque and pushes and pops at the bottom, like a stack, while any other thread can steal from the top. The owner
+// only contends with thieves over the last element, so a thread working through its own jobs almost never waits.
+//
+// The ring grows when it's full. Rings that have been replaced are kept until the deque is destroyed, since a thief
+// may still be reading from one.
+template <typename T>
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable_v<T>, "Elements are copied while another thread may be stealing them");
+
+public:
+    explicit WorkStealingDeque(u64 capacity = 1024);
+    WorkStealingDeque(const WorkStealingDeque& other) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque& other) = delete;
+
+    // Only the owner can push and pop
+    void push(T element);
+    [[nodiscard]] std::optional<T> pop();
+
+    // Any thread can steal. Fails when the deque is empty, or when another thread took the element first.
+    [[nodiscard]] std::optional<T> steal();
+
+    // Only exact when no thread is using the deque
+    [[nodiscard]] u64 approximateCount() const;
+
+private:
+    struct Ring {
+        explicit Ring(u64 capacity);
+
+        [[nodiscard]] T load(i64 index) const;
+        void store(i64 index, T element);
+
+        i64 capacity;
+        std::unique_ptr<std::atomic<T>[]> elements;
+    };
+
+    [[nodiscard]] Ring* grow(Ring* ring, i64 top, i64 bottom);
+
+    alignas(CacheLineSize) std::atomic<i64> top    = 0;
+    alignas(CacheLineSize) std::atomic<i64> bottom = 0;
+
+    alignas(CacheLineSize) std::atomic<Ring*> ring;
+    Core::Array<std::unique_ptr<Ring>> rings;
+};
+
+}    // namespace Core::Jobs
+
+#include "core/jobs/internal/WorkStealingDeque.inl"
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "core/jobs/JobSystem.h"
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+namespace Core::Jobs {
+
+template <typename FUNCTION>
+void JobSystem::run(FUNCTION&& function) {
+    start(std::make_unique<internal::FunctionJob<std::decay_t<FUNCTION>>>(std::forward<FUNCTION>(function)), nullptr);
+}
+
+template <typename FUNCTION>
+void JobSystem::run(FUNCTION&& function, const JobCounter& counter) {
+    start(std::make_unique<internal::FunctionJob<std::decay_t<FUNCTION>>>(std::forward<FUNCTION>(function)), &counter);
+}
+
+template <typename FUNCTION>
+void JobSystem::runAfter(const JobCounter& dependency, FUNCTION&& function, const JobCounter& counter) {
+    startAfter(dependency,
+               std::make_unique<internal::FunctionJob<std::decay_t<FUNCTION>>>(std::forward<FUNCTION>(function)),
+               counter);
+}
+
+namespace internal {
+
+// Keeps the first half for itself and hands the other half to another job, so a thief always takes a large piece of
+// the work and the span is only split as often as there are threads to take the pieces
+template <typename T, typename FUNCTION>
+void ParallelForRange(
+      JobSystem& jobs, const JobCounter& counter, Span<T> elements, u64 grainSize, const FUNCTION& function) {
+    while(elements.count() > grainSize) {
+        u64 half      = elements.count() / 2;
+        Span<T> upper = elements.subspan(half, elements.count() - half);
+        auto job      = [&jobs, &counter, &function, upper, grainSize]() {
+            ParallelForRange(jobs, counter, upper, grainSize, function);
+        };
+        jobs.run(job, counter);
+
+        elements = elements.first(half);
+    }
+
+    for(T& element : elements) {
+        function(element);
+    }
+}
+
+}    // namespace internal
+
+template <typename T, typename FUNCTION>
+void ParallelFor(JobSystem& jobs, Span<T> elements, u64 grainSize, const FUNCTION& function) {
+    JobCounter counter;
+    internal::ParallelForRange(jobs, counter, elements, std::max<u64>(grainSize, 1), function);
+    jobs.wait(counter);
+}
+
+}    // namespace Core::Jobs
@@ -0,0 +1,461 @@
+#pragma once
+
+#include "core/jobs/Task.h"
+
+#include "core/assert/Assert.h"
+
+#include <atomic>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace Core::Jobs {
+
+namespace internal {
+
+template <typename T>
+struct IsStatusOr : std::false_type {};
+
+template <typename T>
+struct IsStatusOr<StatusOr<T>> : std::true_type {};
+
+template <typename T>
+concept StopsAtErrors = std::is_same_v<T, Status> || IsStatusOr<T>::value;
+
+template <typename T>
+Status TakeStatus(T&& result) {
+    if constexpr(std::is_same_v<std::remove_cvref_t<T>, Status>) {
+        return std::move(result);
+    } else {
+        return std::move(result).status();
+    }
+}
+
+class PromiseBase {
+public:
+    std::suspend_always initial_suspend() noexcept {
+        return {};
+    }
+
+    void unhandled_exception() {
+        Core::AbortWithMessage("An exception escaped a task");
+    }
+
+    // Set by whoever starts the task, which is always before it runs
+    std::coroutine_handle<> continuation = std::noop_coroutine();
+    bool completed                       = false;
+};
+
+class ErrorPromiseBase : public PromiseBase {
+public:
+    // Ends the coroutine with status and returns the coroutine to resume in its place. When the coroutine waiting on
+    // this one stops at errors too, the error ends that one instead, and so on up.
+    std::coroutine_handle<> fail(Status&& status) {
+        completed = true;
+        if(errorReceiver != nullptr) {
+            return errorReceiver->fail(std::move(status));
+        }
+
+        storeError(std::move(status));
+        return continuation;
+    }
+
+    ErrorPromiseBase* errorReceiver = nullptr;
+
+protected:
+    ~ErrorPromiseBase() = default;
+
+    virtual void storeError(Status&& status) = 0;
+};
+
+class FinalAwaiter {
+public:
+    [[nodiscard]] bool await_ready() const noexcept {
+        return false;
+    }
+
+    template <typename PROMISE>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<PROMISE> handle) noexcept {
+        return handle.promise().finish();
+    }
+
+    void await_resume() const noexcept {}
+};
+
+template <typename T>
+class UnwrapAwaiter;
+
+template <typename T>
+class UnwrapAwaiter<StatusOr<T>> {
+public:
+    UnwrapAwaiter(StatusOr<T>&& statusOr, ErrorPromiseBase& promise)
+      : statusOr(std::move(statusOr)), promise(promise) {}
+
+    [[nodiscard]] bool await_ready() const {
+        return !statusOr.peekError();
+    }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<>) {
+        return promise.fail(std::move(statusOr).status());
+    }
+
+    T await_resume() {
+        return std::move(statusOr).value();
+    }
+
+private:
+    StatusOr<T> statusOr;
+    ErrorPromiseBase& promise;
+};
+
+template <>
+class UnwrapAwaiter<Status> {
+public:
+    UnwrapAwaiter(Status&& status, ErrorPromiseBase& promise) : status(std::move(status)), promise(promise) {}
+
+    [[nodiscard]] bool await_ready() const {
+        return status.isOk();
+    }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<>) {
+        // Whoever ends up with the error still has to look at it
+        status.reset();
+        return promise.fail(std::move(status));
+    }
+
+    void await_resume() const {}
+
+private:
+    Status status;
+    ErrorPromiseBase& promise;
+};
+
+template <typename T>
+class UnwrapTaskAwaiter {
+public:
+    UnwrapTaskAwaiter(Task<T>& task, ErrorPromiseBase& promise) : task(task), promise(promise) {}
+
+    [[nodiscard]] bool await_ready() const {
+        const Promise<T>& awaited = task.handle.promise();
+        return awaited.completed && !awaited.result->peekError();
+    }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) {
+        Promise<T>& awaited = task.handle.promise();
+        if(awaited.completed) {
+            return promise.fail(TakeStatus(std::move(*awaited.result)));
+        }
+
+        awaited.continuation  = awaiting;
+        awaited.errorReceiver = &promise;
+        return task.handle;
+    }
+
+    auto await_resume() {
+        // Errors never get here, they end the awaiting coroutine instead
+        if constexpr(std::is_same_v<T, Status>) {
+            ASSERT(task.handle.promise().result->isOk());
+        } else {
+            return std::move(*task.handle.promise().result).value();
+        }
+    }
+
+private:
+    Task<T>& task;
+    ErrorPromiseBase& promise;
+};
+
+template <typename T>
+class TaskAwaiter {
+public:
+    explicit TaskAwaiter(Task<T>& task) : task(task) {}
+
+    [[nodiscard]] bool await_ready() const {
+        return task.handle.promise().completed;
+    }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) {
+        task.handle.promise().continuation = awaiting;
+        return task.handle;
+    }
+
+    T await_resume() {
+        if constexpr(!std::is_void_v<T>) {
+            return std::move(*task.handle.promise().result);
+        }
+    }
+
+private:
+    Task<T>& task;
+};
+
+// Runs a task without taking its result
+template <typename T>
+class CompletionAwaiter {
+public:
+    explicit CompletionAwaiter(Task<T>& task) : task(task) {}
+
+    [[nodiscard]] bool await_ready() const {
+        return task.handle.promise().completed;
+    }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) {
+        task.handle.promise().continuation = awaiting;
+        return task.handle;
+    }
+
+    void await_resume() const {}
+
+private:
+    Task<T>& task;
+};
+
+template <typename T>
+class Promise : public PromiseBase {
+public:
+    Task<T> get_return_object() {
+        return Task<T>(std::coroutine_handle<Promise>::from_promise(*this));
+    }
+
+    FinalAwaiter final_suspend() noexcept {
+        return {};
+    }
+
+    void return_value(T value) {
+        result.emplace(std::move(value));
+    }
+
+    std::coroutine_handle<> finish() {
+        completed = true;
+        return continuation;
+    }
+
+    std::optional<T> result;
+};
+
+template <>
+class Promise<void> : public PromiseBase {
+public:
+    Task<void> get_return_object();
+
+    FinalAwaiter final_suspend() noexcept {
+        return {};
+    }
+
+    void return_void() {}
+
+    std::coroutine_handle<> finish() {
+        completed = true;
+        return continuation;
+    }
+};
+
+template <typename T>
+requires StopsAtErrors<T>
+class Promise<T> final : public ErrorPromiseBase {
+public:
+    Task<T> get_return_object() {
+        return Task<T>(std::coroutine_handle<Promise>::from_promise(*this));
+    }
+
+    FinalAwaiter final_suspend() noexcept {
+        return {};
+    }
+
+    void return_value(T value) {
+        result.emplace(std::move(value));
+    }
+
+    std::coroutine_handle<> finish() {
+        if(errorReceiver != nullptr && result->peekError()) {
+            return fail(TakeStatus(std::move(*result)));
+        }
+
+        completed = true;
+        return continuation;
+    }
+
+    template <typename AWAITABLE>
+    AWAITABLE&& await_transform(AWAITABLE&& awaitable) {
+        return std::forward<AWAITABLE>(awaitable);
+    }
+
+    template <typename U>
+    UnwrapAwaiter<StatusOr<U>> await_transform(StatusOr<U>&& statusOr) {
+        return UnwrapAwaiter<StatusOr<U>>(std::move(statusOr), *this);
+    }
+
+    UnwrapAwaiter<Status> await_transform(Status&& status) {
+        return UnwrapAwaiter<Status>(std::move(status), *this);
+    }
+
+    template <typename U>
+    requires StopsAtErrors<U> UnwrapTaskAwaiter<U> await_transform(Task<U>& task) {
+        return UnwrapTaskAwaiter<U>(task, *this);
+    }
+
+    template <typename U>
+    requires StopsAtErrors<U> UnwrapTaskAwaiter<U> await_transform(Task<U>&& task) {
+        return UnwrapTaskAwaiter<U>(task, *this);
+    }
+
+    std::optional<T> result;
+
+protected:
+    void storeError(Status&& status) override {
+        result.emplace(std::move(status));
+    }
+};
+
+inline Task<void> Promise<void>::get_return_object() {
+    return Task<void>(std::coroutine_handle<Promise>::from_promise(*this));
+}
+
+// A coroutine that starts straight away and frees itself when it's done
+class Detached {
+public:
+    class promise_type {
+    public:
+        Detached get_return_object() {
+            return {};
+        }
+
+        std::suspend_never initial_suspend() noexcept {
+            return {};
+        }
+
+        std::suspend_never final_suspend() noexcept {
+            return {};
+        }
+
+        void return_void() {}
+
+        void unhandled_exception() {
+            Core::AbortWithMessage("An exception escaped a task");
+        }
+    };
+};
+
+// Resumes the awaiting coroutine once every task has arrived. The awaiting coroutine counts as one more arrival, so
+// it's resumed right away if the tasks all finished before it was suspended.
+class WhenAllLatch {
+public:
+    explicit WhenAllLatch(u64 taskCount) : remaining(taskCount + 1) {}
+
+    [[nodiscard]] bool await_ready() const {
+        return false;
+    }
+
+    bool await_suspend(std::coroutine_handle<> awaitingCoroutine) {
+        awaiting = awaitingCoroutine;
+        return remaining.fetch_sub(1, std::memory_order_acq_rel) > 1;
+    }
+
+    void await_resume() const {}
+
+    void arrive() {
+        if(remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            awaiting.resume();
+        }
+    }
+
+private:
+    std::atomic<u64> remaining;
+    std::coroutine_handle<> awaiting;
+};
+
+template <typename T>
+Detached RunThenArrive(JobSystem& jobs, Task<T>& task, WhenAllLatch& latch) {
+    co_await ResumeOn(jobs);
+    co_await CompletionAwaiter<T>(task);
+    latch.arrive();
+}
+
+template <typename T>
+Detached RunThenRelease(JobSystem& jobs, Task<T>& task, JobCounter counter) {
+    co_await CompletionAwaiter<T>(task);
+    jobs.release(counter);
+}
+
+}    // namespace internal
+
+template <typename T>
+Task<T>::Task(std::coroutine_handle<promise_type> handle) : handle(handle) {}
+
+template <typename T>
+Task<T>::Task(Task&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+
+template <typename T>
+Task<T>& Task<T>::operator=(Task&& other) noexcept {
+    if(this != &other) {
+        if(handle) {
+            handle.destroy();
+        }
+        handle = std::exchange(other.handle, nullptr);
+    }
+    return *this;
+}
+
+template <typename T>
+Task<T>::~Task() {
+    // Destroying a coroutine that stopped at an error also destroys the tasks it was waiting on
+    if(handle) {
+        handle.destroy();
+    }
+}
+
+template <typename T>
+bool Task<T>::isDone() const {
+    return handle.promise().completed;
+}
+
+template <typename T>
+T Task<T>::result() && {
+    ASSERT_WITH_MESSAGE(isDone(), "Only a task that is done has a result");
+
+    if constexpr(!std::is_void_v<T>) {
+        return std::move(*handle.promise().result);
+    }
+}
+
+template <typename T>
+internal::TaskAwaiter<T> Task<T>::operator co_await() & {
+    return internal::TaskAwaiter<T>(*this);
+}
+
+template <typename T>
+internal::TaskAwaiter<T> Task<T>::operator co_await() && {
+    return internal::TaskAwaiter<T>(*this);
+}
+
+template <typename T>
+internal::TaskAwaiter<T> Task<T>::withStatus() {
+    return internal::TaskAwaiter<T>(*this);
+}
+
+template <typename... TS>
+Task<void> WhenAll(JobSystem& jobs, Task<TS>&... tasks) {
+    internal::WhenAllLatch latch(sizeof...(TS));
+    (internal::RunThenArrive(jobs, tasks, latch), ...);
+    co_await latch;
+}
+
+template <typename T>
+Task<void> WhenAll(JobSystem& jobs, Core::Span<Task<T>> tasks) {
+    internal::WhenAllLatch latch(tasks.count());
+    for(Task<T>& task : tasks) {
+        internal::RunThenArrive(jobs, task, latch);
+    }
+    co_await latch;
+}
+
+template <typename T>
+T SyncWait(JobSystem& jobs, Task<T> task) {
+    JobCounter counter;
+    jobs.hold(counter);
+    internal::RunThenRelease(jobs, task, counter);
+    jobs.wait(counter);
+    return std::move(task).result();
+}
+
+}    // namespace Core::Jobs
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "core/jobs/WorkStealingDeque.h"
+
+#include "core/assert/Assert.h"
+
+#include <bit>
+
+namespace Core::Jobs {
+
+template <typename T>
+WorkStealingDeque<T>::Ring::Ring(u64 capacity)
+  : capacity(static_cast<i64>(capacity)), elements(std::make_unique<std::atomic<T>[]>(capacity)) {}
+
+template <typename T>
+T WorkStealingDeque<T>::Ring::load(i64 index) const {
+    return elements[index & (capacity - 1)].load(std::memory_order_relaxed);
+}
+
+template <typename T>
+void WorkStealingDeque<T>::Ring::store(i64 index, T element) {
+    elements[index & (capacity - 1)].store(element, std::memory_order_relaxed);
+}
+
+template <typename T>
+WorkStealingDeque<T>::WorkStealingDeque(u64 capacity) {
+    ASSERT_WITH_MESSAGE(capacity > 0, "A deque needs a capacity");
+
+    Ring* first = rings.emplace(std::make_unique<Ring>(std::bit_ceil(capacity))).get();
+    ring.store(first, std::memory_order_relaxed);
+}
+
+template <typename T>
+void WorkStealingDeque<T>::push(T element) {
+    i64 currentBottom = bottom.load(std::memory_order_relaxed);
+    i64 currentTop    = top.load(std::memory_order_acquire);
+    Ring* current     = ring.load(std::memory_order_relaxed);
+
+    if(currentBottom - currentTop >= current->capacity) {
+        current = grow(current, currentTop, currentBottom);
+    }
+
+    // The release store publishes the element to thieves that read the new bottom
+    current->store(currentBottom, element);
+    bottom.store(currentBottom + 1, std::memory_order_release);
+}
+
+template <typename T>
+std::optional<T> WorkStealingDeque<T>::pop() {
+    // Claim the bottom element first, then check whether a thief got there too. The claim has to be visible before top
+    // is read, which is what the sequentially consistent store and load are for.
+    i64 currentBottom = bottom.load(std::memory_order_relaxed) - 1;
+    Ring* current     = ring.load(std::memory_order_relaxed);
+    bottom.store(currentBottom, std::memory_order_seq_cst);
+    i64 currentTop = top.load(std::memory_order_seq_cst);
+
+    if(currentTop > currentBottom) {
+        bottom.store(currentBottom + 1, std::memory_order_relaxed);
+        return std::nullopt;
+    }
+
+    T element = current->load(currentBottom);
+    if(currentTop == currentBottom) {
+        // The last element, which a thief may be stealing at the same time. Whoever moves top past it wins.
+        bool won = top.compare_exchange_strong(
+              currentTop, currentTop + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        bottom.store(currentBottom + 1, std::memory_order_relaxed);
+        if(!won) {
+            return std::nullopt;
+        }
+    }
+
+    return element;
+}
+
+template <typename T>
+std::optional<T> WorkStealingDeque<T>::steal() {
+    i64 currentTop    = top.load(std::memory_order_seq_cst);
+    i64 currentBottom = bottom.load(std::memory_order_seq_cst);
+    if(currentTop >= currentBottom) {
+        return std::nullopt;
+    }
+
+    // The element is read before the claim, since once top moves the owner is free to overwrite its slot
+    T element = ring.load(std::memory_order_acquire)->load(currentTop);
+    if(!top.compare_exchange_strong(currentTop, currentTop + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        return std::nullopt;
+    }
+
+    return element;
+}
+
+template <typename T>
+u64 WorkStealingDeque<T>::approximateCount() const {
+    i64 currentBottom = bottom.load(std::memory_order_relaxed);
+    i64 currentTop    = top.load(std::memory_order_relaxed);
+    return currentBottom > currentTop ? static_cast<u64>(currentBottom - currentTop) : 0;
+}
+
+template <typename T>
+typename WorkStealingDeque<T>::Ring* WorkStealingDeque<T>::grow(Ring* current, i64 currentTop, i64 currentBottom) {
+    Ring* larger = rings.emplace(std::make_unique<Ring>(static_cast<u64>(current->capacity) * 2)).get();
+    for(i64 i = currentTop; i < currentBottom; i++) {
+        larger->store(i, current->load(i));
+    }
+
+    ring.store(larger, std::memory_order_release);
+    return larger;
+}
+
+}    // namespace Core::Jobs
@@ -0,0 +1,61 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <catch2/matchers/catch_matchers_range_equals.hpp>
+
+#include "core/containers/Array.h"
+#include "core/io/file_system/Path.h"
+#include "core/io/serialization/compression/Compression.h"
+#include "core/jobs/IOTasks.h"
+#include "core/jobs/JobSystem.h"
+#include "core/jobs/Task.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace {
+
+// Reads a compressed file and decompresses it, stopping at whichever step fails first
+Core::Jobs::Task<Core::StatusOr<Core::Array<std::byte>>> LoadCompressed(Core::Jobs::JobSystem& jobs,
+                                                                        Core::IO::Path file,
+                                                                        uint64_t uncompressedBytes) {
+    Core::Array<std::byte> compressed = co_await Core::Jobs::ReadBinaryFileAsync(jobs, file);
+    co_return co_await Core::Jobs::DecompressAsync(jobs, Core::ToSpan(compressed), uncompressedBytes);
+}
+
+}    // namespace
+
+TEST_CASE("IO Tasks Read And Decompress") {
+    Core::Jobs::JobSystem jobs(2);
+
+    Core::Array<std::byte> data;
+    for(uint64_t i = 0; i < 10000; i++) {
+        data.emplace(std::byte(i % 7));
+    }
+
+    Core::StatusOr<Core::Array<std::byte>> compressed = Core::IO::Compression::Compress(Core::ToSpan(data));
+    REQUIRE(compressed.isOk());
+
+    std::filesystem::path file = std::filesystem::temp_directory_path() / "bengine_test_io_tasks.bin";
+    {
+        std::ofstream out(file, std::ios::binary);
+        out.write(reinterpret_cast<const char*>(compressed.value().rawData()), compressed.value().count());
+    }
+
+    Core::StatusOr<Core::Array<std::byte>> loaded = Core::Jobs::SyncWait(
+          jobs, LoadCompressed(jobs, Core::IO::Path(file, Core::IO::PathType::Explicit), data.count()));
+    std::filesystem::remove(file);
+
+    REQUIRE(loaded.isOk());
+    CHECK_THAT(loaded.value(), Catch::Matchers::RangeEquals(data));
+}
+
+TEST_CASE("IO Tasks Missing File") {
+    Core::Jobs::JobSystem jobs(1);
+
+    Core::StatusOr<Core::Array<std::byte>> loaded = Core::Jobs::SyncWait(
+          jobs,
+          LoadCompressed(jobs, Core::IO::Path("does/not/exist.bin", Core::IO::PathType::Explicit), 16));
+    REQUIRE(loaded.isError());
+}
@@ -0,0 +1,163 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/Types.h"
+#include "core/containers/Array.h"
+#include "core/jobs/JobSystem.h"
+
+#include <atomic>
+#include <thread>
+
+TEST_CASE("Job System Runs Jobs") {
+    for(u64 workerCount : {0, 1, 4}) {
+        Core::Jobs::JobSystem jobs(workerCount);
+        REQUIRE(jobs.workerCount() == workerCount);
+
+        std::atomic<u64> sum = 0;
+        Core::Jobs::JobCounter counter;
+        for(u64 i = 1; i <= 1000; i++) {
+            jobs.run([&sum, i]() {
+                sum.fetch_add(i, std::memory_order_relaxed);
+            }, counter);
+        }
+
+        jobs.wait(counter);
+        REQUIRE(counter.isDone());
+        REQUIRE(counter.pendingCount() == 0);
+        REQUIRE(sum == 500500);
+    }
+}
+
+TEST_CASE("Job System Jobs Without A Counter Run Before It Is Destroyed") {
+    std::atomic<u64> ran = 0;
+    {
+        Core::Jobs::JobSystem jobs(2);
+        for(u64 i = 0; i < 100; i++) {
+            jobs.run([&ran]() {
+                ran.fetch_add(1, std::memory_order_relaxed);
+            });
+        }
+    }
+    REQUIRE(ran == 100);
+}
+
+TEST_CASE("Job System Jobs Wait On Jobs They Start") {
+    // Waiting inside a job runs other jobs, so nesting deeper than there are workers doesn't deadlock
+    Core::Jobs::JobSystem jobs(2);
+
+    std::atomic<u64> leaves = 0;
+    auto spawn = [&](auto& self, u64 depth) -> void {
+        if(depth == 0) {
+            leaves.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        Core::Jobs::JobCounter children;
+        for(u64 i = 0; i < 3; i++) {
+            jobs.run([&self, depth]() {
+                self(self, depth - 1);
+            }, children);
+        }
+        jobs.wait(children);
+    };
+
+    Core::Jobs::JobCounter root;
+    jobs.run([&]() {
+        spawn(spawn, 6);
+    }, root);
+    jobs.wait(root);
+
+    REQUIRE(leaves == 729);
+}
+
+TEST_CASE("Job System Dependencies") {
+    for(u64 workerCount : {0, 3}) {
+        Core::Jobs::JobSystem jobs(workerCount);
+
+        std::atomic<u64> firstStage     = 0;
+        std::atomic<bool> orderedBefore = true;
+
+        Core::Jobs::JobCounter first;
+        Core::Jobs::JobCounter second;
+        for(u64 i = 0; i < 50; i++) {
+            jobs.run([&]() {
+                std::this_thread::yield();
+                firstStage.fetch_add(1, std::memory_order_relaxed);
+            }, first);
+        }
+        for(u64 i = 0; i < 10; i++) {
+            jobs.runAfter(first, [&]() {
+                if(firstStage.load(std::memory_order_relaxed) != 50) {
+                    orderedBefore = false;
+                }
+            }, second);
+        }
+
+        // The continuations count towards second as soon as they're added
+        REQUIRE(!second.isDone());
+        jobs.wait(second);
+
+        REQUIRE(first.isDone());
+        REQUIRE(orderedBefore);
+
+        // A dependency that's already done doesn't hold anything up
+        std::atomic<bool> ran = false;
+        Core::Jobs::JobCounter third;
+        jobs.runAfter(first, [&]() {
+            ran = true;
+        }, third);
+        jobs.wait(third);
+        REQUIRE(ran);
+    }
+}
+
+TEST_CASE("Job System Parallel For Visits Every Element Once") {
+    Core::Jobs::JobSystem jobs(3);
+
+    for(u64 grainSize : {0, 1, 7, 64, 100000}) {
+        Core::Array<u64> values;
+        for(u64 i = 0; i < 10000; i++) {
+            values.insert(i);
+        }
+
+        Core::Jobs::ParallelFor(jobs, Core::ToSpan(values), grainSize, [](u64& value) {
+            value = value * 2 + 1;
+        });
+
+        bool allVisited = true;
+        for(u64 i = 0; i < values.count(); i++) {
+            allVisited = allVisited && values[i] == i * 2 + 1;
+        }
+        REQUIRE(allVisited);
+    }
+
+    Core::Array<u64> empty;
+    Core::Jobs::ParallelFor(jobs, Core::ToSpan(empty), 16, [](u64&) {});
+}
+
+TEST_CASE("Job System Used From Several Threads") {
+    Core::Jobs::JobSystem jobs(2);
+
+    std::atomic<bool> allCorrect = true;
+    Core::Array<std::thread> threads;
+    for(u64 t = 0; t < 4; t++) {
+        threads.emplace([&]() {
+            for(u64 round = 0; round < 20; round++) {
+                Core::Array<u64> values(u64(0), 1000);
+                Core::Jobs::ParallelFor(jobs, Core::ToSpan(values), 10, [](u64& value) {
+                    value++;
+                });
+
+                for(u64 value : values) {
+                    if(value != 1) {
+                        allCorrect = false;
+                    }
+                }
+            }
+        });
+    }
+    for(std::thread& thread : threads) {
+        thread.join();
+    }
+
+    REQUIRE(allCorrect);
+}
@@ -0,0 +1,216 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/Types.h"
+#include "core/containers/Array.h"
+#include "core/jobs/JobSystem.h"
+#include "core/jobs/Task.h"
+#include "core/status/StatusOr.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+namespace {
+
+Core::Jobs::Task<u64> Square(u64 value) {
+    co_return value * value;
+}
+
+Core::Jobs::Task<u64> SumOfSquares(u64 count) {
+    u64 sum = 0;
+    for(u64 i = 1; i <= count; i++) {
+        sum += co_await Square(i);
+    }
+    co_return sum;
+}
+
+Core::Jobs::Task<std::thread::id> ThreadAfterResumingOn(Core::Jobs::JobSystem& jobs) {
+    co_await Core::Jobs::ResumeOn(jobs);
+    co_return std::this_thread::get_id();
+}
+
+Core::StatusOr<u64> ParseDigit(char c) {
+    if(c < '0' || c > '9') {
+        return Core::Status::Error("'{}' is not a digit", c);
+    }
+    return static_cast<u64>(c - '0');
+}
+
+Core::Status CheckNotEmpty(const std::string& text) {
+    if(text.empty()) {
+        return Core::Status::Error("Empty text");
+    }
+    return Core::Status::Ok();
+}
+
+// Counts how many of these were destroyed, to check that a coroutine stopped at an error still cleans up
+struct DestructionCounter {
+    ~DestructionCounter() {
+        destroyed++;
+    }
+
+    std::atomic<u64>& destroyed;
+};
+
+Core::Jobs::Task<Core::StatusOr<u64>>
+ParseNumber(Core::Jobs::JobSystem& jobs, std::string text, std::atomic<u64>& destroyed) {
+    DestructionCounter counter{destroyed};
+    co_await Core::Jobs::ResumeOn(jobs);
+    co_await CheckNotEmpty(text);
+
+    u64 value = 0;
+    for(char c : text) {
+        value = value * 10 + co_await ParseDigit(c);
+    }
+    co_return value;
+}
+
+Core::Jobs::Task<Core::StatusOr<u64>>
+AddNumbers(Core::Jobs::JobSystem& jobs, std::string first, std::string second, std::atomic<u64>& destroyed) {
+    DestructionCounter counter{destroyed};
+    u64 firstValue  = co_await ParseNumber(jobs, first, destroyed);
+    u64 secondValue = co_await ParseNumber(jobs, second, destroyed);
+    co_return firstValue + secondValue;
+}
+
+Core::Jobs::Task<Core::Status> CheckSum(Core::Jobs::JobSystem& jobs, std::string first, std::string second) {
+    std::atomic<u64> destroyed = 0;
+    u64 sum                    = co_await AddNumbers(jobs, first, second, destroyed);
+    if(sum > 100) {
+        co_return Core::Status::Error("{} is too large", sum);
+    }
+    co_return Core::Status::Ok();
+}
+
+}    // namespace
+
+TEST_CASE("Task Awaits Other Tasks") {
+    Core::Jobs::JobSystem jobs(0);
+    REQUIRE(Core::Jobs::SyncWait(jobs, SumOfSquares(10)) == 385);
+}
+
+TEST_CASE("Task Tasks Start When Awaited") {
+    Core::Jobs::JobSystem jobs(0);
+
+    bool started = false;
+    auto run     = [&]() -> Core::Jobs::Task<void> {
+        started = true;
+        co_return;
+    };
+    Core::Jobs::Task<void> task = run();
+
+    REQUIRE(!started);
+    REQUIRE(!task.isDone());
+    Core::Jobs::SyncWait(jobs, std::move(task));
+    REQUIRE(started);
+}
+
+TEST_CASE("Task Resume On Continues As A Job") {
+    // Without workers the job can only be run by the thread waiting for it
+    Core::Jobs::JobSystem jobs(0);
+
+    std::thread::id resumedOn = Core::Jobs::SyncWait(jobs, ThreadAfterResumingOn(jobs));
+    REQUIRE(resumedOn == std::this_thread::get_id());
+}
+
+TEST_CASE("Task Errors Stop The Coroutine") {
+    for(u64 workerCount : {0, 2}) {
+        Core::Jobs::JobSystem jobs(workerCount);
+
+        std::atomic<u64> destroyed = 0;
+        Core::StatusOr<u64> sum    = Core::Jobs::SyncWait(jobs, AddNumbers(jobs, "12", "30", destroyed));
+        REQUIRE(sum.isOk());
+        REQUIRE(sum.value() == 42);
+        REQUIRE(destroyed == 3);
+
+        destroyed                    = 0;
+        Core::StatusOr<u64> notDigit = Core::Jobs::SyncWait(jobs, AddNumbers(jobs, "12", "3x", destroyed));
+        REQUIRE(notDigit.isError());
+        REQUIRE(notDigit.message() == "'x' is not a digit");
+        REQUIRE(destroyed == 3);
+
+        destroyed                 = 0;
+        Core::StatusOr<u64> empty = Core::Jobs::SyncWait(jobs, AddNumbers(jobs, "", "3", destroyed));
+        REQUIRE(empty.isError());
+        REQUIRE(empty.message() == "Empty text");
+        REQUIRE(destroyed == 2);
+
+        Core::Status ok = Core::Jobs::SyncWait(jobs, CheckSum(jobs, "1", "2"));
+        REQUIRE(ok.isOk());
+
+        Core::Status tooLarge = Core::Jobs::SyncWait(jobs, CheckSum(jobs, "100", "2"));
+        REQUIRE(tooLarge.isError());
+        REQUIRE(tooLarge.message() == "102 is too large");
+
+        Core::Status passedOn = Core::Jobs::SyncWait(jobs, CheckSum(jobs, "1", "-2"));
+        REQUIRE(passedOn.isError());
+        REQUIRE(passedOn.message() == "'-' is not a digit");
+    }
+}
+
+TEST_CASE("Task With Status Handles Errors") {
+    Core::Jobs::JobSystem jobs(1);
+
+    auto parseOrZero = [&jobs](std::string text) -> Core::Jobs::Task<Core::StatusOr<u64>> {
+        std::atomic<u64> destroyed = 0;
+        Core::StatusOr<u64> parsed = co_await ParseNumber(jobs, text, destroyed).withStatus();
+        if(parsed.isError()) {
+            co_return 0;
+        }
+        co_return parsed.value();
+    };
+
+    Core::StatusOr<u64> parsed = Core::Jobs::SyncWait(jobs, parseOrZero("17"));
+    REQUIRE(parsed.isOk());
+    REQUIRE(parsed.value() == 17);
+
+    Core::StatusOr<u64> zero = Core::Jobs::SyncWait(jobs, parseOrZero("x"));
+    REQUIRE(zero.isOk());
+    REQUIRE(zero.value() == 0);
+}
+
+TEST_CASE("Task When All Runs Tasks Side By Side") {
+    Core::Jobs::JobSystem jobs(3);
+
+    std::atomic<u64> destroyed           = 0;
+    Core::Jobs::Task<u64> squares        = SumOfSquares(3);
+    Core::Jobs::Task<std::thread::id> id = ThreadAfterResumingOn(jobs);
+
+    Core::Jobs::Task<Core::StatusOr<u64>> failing = ParseNumber(jobs, "4o4", destroyed);
+
+    Core::Jobs::SyncWait(jobs, Core::Jobs::WhenAll(jobs, squares, id, failing));
+    REQUIRE(squares.isDone());
+    REQUIRE(id.isDone());
+    REQUIRE(failing.isDone());
+
+    REQUIRE(std::move(squares).result() == 14);
+    REQUIRE(std::move(failing).result().isError());
+
+    Core::Array<Core::Jobs::Task<u64>> many;
+    for(u64 i = 0; i < 100; i++) {
+        many.emplace(Square(i));
+    }
+    Core::Jobs::SyncWait(jobs, Core::Jobs::WhenAll(jobs, Core::ToSpan(many)));
+
+    bool allSquared = true;
+    for(u64 i = 0; i < many.count(); i++) {
+        allSquared = allSquared && std::move(many[i]).result() == i * i;
+    }
+    REQUIRE(allSquared);
+}
+
+TEST_CASE("Task Awaiting A Task That Is Done") {
+    Core::Jobs::JobSystem jobs(2);
+
+    auto sumAfterwards = [&jobs]() -> Core::Jobs::Task<Core::StatusOr<u64>> {
+        std::atomic<u64> destroyed                = 0;
+        Core::Jobs::Task<Core::StatusOr<u64>> one = ParseNumber(jobs, "20", destroyed);
+        Core::Jobs::Task<Core::StatusOr<u64>> two = ParseNumber(jobs, "22", destroyed);
+        co_await Core::Jobs::WhenAll(jobs, one, two);
+        co_return co_await one + co_await two;
+    };
+
+    Core::StatusOr<u64> sum = Core::Jobs::SyncWait(jobs, sumAfterwards());
+    REQUIRE(sum.isOk());
+    REQUIRE(sum.value() == 42);
+}
@@ -0,0 +1,108 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/Types.h"
+#include "core/containers/Array.h"
+#include "core/jobs/WorkStealingDeque.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+TEST_CASE("Work Stealing Deque Owner Pops Newest First") {
+    Core::Jobs::WorkStealingDeque<u64> deque(4);
+
+    REQUIRE(!deque.pop().has_value());
+    REQUIRE(!deque.steal().has_value());
+
+    for(u64 i = 0; i < 3; i++) {
+        deque.push(i);
+    }
+    REQUIRE(deque.approximateCount() == 3);
+
+    REQUIRE(deque.pop() == 2u);
+    REQUIRE(deque.pop() == 1u);
+    REQUIRE(deque.pop() == 0u);
+    REQUIRE(!deque.pop().has_value());
+}
+
+TEST_CASE("Work Stealing Deque Thieves Take Oldest First") {
+    Core::Jobs::WorkStealingDeque<u64> deque(4);
+
+    for(u64 i = 0; i < 3; i++) {
+        deque.push(i);
+    }
+
+    REQUIRE(deque.steal() == 0u);
+    REQUIRE(deque.pop() == 2u);
+    REQUIRE(deque.steal() == 1u);
+    REQUIRE(!deque.steal().has_value());
+    REQUIRE(!deque.pop().has_value());
+}
+
+TEST_CASE("Work Stealing Deque Grows") {
+    Core::Jobs::WorkStealingDeque<u64> deque(2);
+
+    // Leave the ring wrapped around before it grows
+    deque.push(100);
+    deque.push(101);
+    REQUIRE(deque.steal() == 100u);
+
+    for(u64 i = 0; i < 1000; i++) {
+        deque.push(i);
+    }
+    REQUIRE(deque.approximateCount() == 1001);
+
+    REQUIRE(deque.steal() == 101u);
+    for(u64 i = 1000; i > 0; i--) {
+        REQUIRE(deque.pop() == i - 1);
+    }
+    REQUIRE(!deque.pop().has_value());
+}
+
+TEST_CASE("Work Stealing Deque Every Element Is Taken Once") {
+    const u64 elementCount = 200000;
+    const u64 thiefCount   = 3;
+
+    Core::Jobs::WorkStealingDeque<u64> deque(16);
+    std::unique_ptr<std::atomic<u8>[]> taken = std::make_unique<std::atomic<u8>[]>(elementCount);
+    std::atomic<u64> takenCount = 0;
+    std::atomic<bool> duplicate = false;
+
+    auto take = [&](u64 element) {
+        if(taken[element].fetch_add(1, std::memory_order_relaxed) != 0) {
+            duplicate = true;
+        }
+        takenCount.fetch_add(1, std::memory_order_relaxed);
+    };
+
+    Core::Array<std::thread> thieves;
+    for(u64 t = 0; t < thiefCount; t++) {
+        thieves.emplace([&]() {
+            while(takenCount.load(std::memory_order_relaxed) < elementCount) {
+                if(std::optional<u64> element = deque.steal()) {
+                    take(*element);
+                }
+            }
+        });
+    }
+
+    // The owner pops some of what it pushes, so it races thieves for the last element as well as for growth
+    for(u64 i = 0; i < elementCount; i++) {
+        deque.push(i);
+        if(i % 3 == 0) {
+            if(std::optional<u64> element = deque.pop()) {
+                take(*element);
+            }
+        }
+    }
+    while(std::optional<u64> element = deque.pop()) {
+        take(*element);
+    }
+
+    for(std::thread& thief : thieves) {
+        thief.join();
+    }
+
+    REQUIRE(!duplicate);
+    REQUIRE(takenCount == elementCount);
+}
@@ -5,6 +5,7 @@
 
 #include <spdlog/sinks/stdout_color_sinks.h>
 
+#include <shared_mutex>
 #include <thread>
 
 // We don't use the Core contaienrs here so that we don't have any external dependencies, allowing this library to be
@@ -17,13 +18,13 @@ namespace {
 std::mutex* LoggerCreationMutex;
 std::mutex* FilterMutex;
 std::mutex* SinkMutex;
-std::mutex* DisplayNameMutex;
+std::shared_mutex* DisplayNameMutex;
 void InitLocks() {
     if(LoggerCreationMutex == nullptr) {
         LoggerCreationMutex = new std::mutex();
         FilterMutex         = new std::mutex();
         SinkMutex           = new std::mutex();
-        DisplayNameMutex    = new std::mutex();
+        DisplayNameMutex    = new std::shared_mutex();
     }
 }
 
@@ -42,11 +43,22 @@ std::unordered_map<const Core::LogCategory*, std::string>& DisplayNames() {
     return DisplayNameMap;
 }
 
+// Every log call looks up its category's name, and the names are only built once, so lookups share the lock and only
+// the first lookup of a category takes it exclusively. References to unordered_map values survive later inserts.
 std::string& GetDisplayName(const Core::LogCategory* category) {
     InitLocks();
-    std::scoped_lock lock(*DisplayNameMutex);
-    std::string& displayName = DisplayNames()[category];
-    if(displayName.empty()) {
+    {
+        std::shared_lock lock(*DisplayNameMutex);
+        auto existing = DisplayNames().find(category);
+        if(existing != DisplayNames().end()) {
+            return existing->second;
+        }
+    }
+
+    std::unique_lock lock(*DisplayNameMutex);
+    auto [entry, inserted]   = DisplayNames().try_emplace(category);
+    std::string& displayName = entry->second;
+    if(inserted) {
         const Core::LogCategory* currentCategory = category;
 
         while(currentCategory != nullptr) {
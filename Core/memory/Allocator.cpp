@@ -0,0 +1,78 @@
+#include "core/memory/Allocator.h"
+
+#include "core/assert/Assert.h"
+#include "core/memory/VirtualMemory.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+class MallocMemoryResource : public Core::Memory::MemoryResource {
+public:
+    void* allocate(u64 size, u64 alignment) override {
+        return allocator.allocate(size, alignment);
+    }
+
+    void deallocate(void* memory, u64 size) override {
+        allocator.deallocate(memory, size);
+    }
+
+private:
+    Core::Memory::MallocAllocator allocator;
+};
+}    // namespace
+
+namespace Core::Memory {
+
+void* RemappingAllocator::AllocateRemappableBlock(u64 size) {
+    return MapVirtualMemory(size);
+}
+
+void RemappingAllocator::FreeRemappableBlock(void* memory, u64 size) {
+    if(memory != nullptr) {
+        ReleaseVirtualMemory(memory, size);
+    }
+}
+
+void* RemappingAllocator::ReallocateRemappableBlock(void* memory, u64 oldSize, u64 newSize) {
+    if(memory != nullptr && oldSize >= RemappableBlockSize && newSize >= RemappableBlockSize) {
+        if(void* remapped = RemapVirtualMemory(memory, oldSize, newSize)) {
+            return remapped;
+        }
+    }
+
+    // The block is moving between malloc and mapped memory, or it could not be remapped
+    RemappingAllocator allocator;
+    void* newMemory = allocator.allocate(newSize, alignof(std::max_align_t));
+    if(newMemory != nullptr && memory != nullptr) {
+        std::memcpy(newMemory, memory, std::min(oldSize, newSize));
+        allocator.deallocate(memory, oldSize);
+    }
+
+    return newMemory;
+}
+
+MemoryResource* MallocResource() {
+    static MallocMemoryResource resource;
+    return &resource;
+}
+
+ResourceAllocator::ResourceAllocator() : memoryResource(MallocResource()) {}
+
+ResourceAllocator::ResourceAllocator(MemoryResource* resource) : memoryResource(resource) {
+    ASSERT(memoryResource != nullptr);
+}
+
+void* ResourceAllocator::allocate(u64 size, u64 alignment) {
+    return memoryResource->allocate(size, alignment);
+}
+
+void ResourceAllocator::deallocate(void* memory, u64 size) {
+    memoryResource->deallocate(memory, size);
+}
+
+MemoryResource* ResourceAllocator::resource() const {
+    return memoryResource;
+}
+
+}    // namespace Core::Memory
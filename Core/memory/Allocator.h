@@ -0,0 +1,137 @@
+#pragma once
+
+#include "core/Types.h"
+#include "core/assert/Assert.h"
+
+#include <concepts>
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+
+namespace Core::Memory {
+
+// Anything that can hand out and take back raw memory. Containers take the allocator as a template parameter and store
+// a copy of it, so a stateless allocator costs nothing while a stateful one is usually a single pointer.
+template <typename A>
+concept Allocator = std::copy_constructible<A> && requires(A allocator, void* memory, u64 size, u64 alignment) {
+    { allocator.allocate(size, alignment) } -> std::same_as<void*>;
+    allocator.deallocate(memory, size);
+};
+
+// An allocator that can also resize a block it handed out, keeping the contents. Containers of trivially relocatable
+// elements grow through it, which avoids a copy whenever the block can be extended in place.
+template <typename A>
+concept ReallocatingAllocator = Allocator<A> && requires(A allocator, void* memory, u64 size, u64 alignment) {
+    { allocator.reallocate(memory, size, size, alignment) } -> std::same_as<void*>;
+};
+
+// The default allocator for every container, which keeps the behavior from before allocators could be swapped out. It
+// is defined inline so that using it compiles to the same direct malloc and free calls as before.
+struct MallocAllocator {
+    [[nodiscard]] void* allocate(u64 size, u64 alignment) {
+        ASSERT_WITH_MESSAGE(
+              alignment <= alignof(std::max_align_t), "malloc can not provide an alignment of {}", alignment);
+        return malloc(size);
+    }
+
+    void deallocate(void* memory, u64) {
+        free(memory);
+    }
+
+    // Resizes a block returned by allocate, which may move it. The contents up to the smaller of both sizes are kept.
+    // glibc already moves large blocks by remapping their pages rather than copying them.
+    [[nodiscard]] void* reallocate(void* memory, u64, u64 newSize, u64 alignment) {
+        ASSERT_WITH_MESSAGE(
+              alignment <= alignof(std::max_align_t), "malloc can not provide an alignment of {}", alignment);
+        return realloc(memory, newSize);
+    }
+
+    bool operator==(const MallocAllocator& other) const = default;
+};
+
+// An allocator for containers that grow very large, such as arrays of tens of megabytes that are appended to. Blocks of
+// RemappableBlockSize or more are mapped straight from the OS on systems that can remap pages, so that reallocating
+// them moves page table entries instead of copying the contents, whatever malloc the program runs with. Smaller blocks
+// and every block on other systems come from malloc.
+//
+// Which of the two a block came from is told from the size it is deallocated with, so blocks must be given back with
+// the size they were allocated or last reallocated with.
+struct RemappingAllocator {
+#if defined(__linux__)
+    constexpr static u64 RemappableBlockSize = 1024 * 1024;
+#else
+    constexpr static u64 RemappableBlockSize = std::numeric_limits<u64>::max();
+#endif
+
+    [[nodiscard]] void* allocate(u64 size, u64 alignment) {
+        if(size >= RemappableBlockSize) {
+            return AllocateRemappableBlock(size);
+        }
+
+        return MallocAllocator().allocate(size, alignment);
+    }
+
+    void deallocate(void* memory, u64 size) {
+        if(size >= RemappableBlockSize) {
+            FreeRemappableBlock(memory, size);
+            return;
+        }
+
+        free(memory);
+    }
+
+    // Resizes a block returned by allocate, which may move it. The contents up to the smaller of both sizes are kept.
+    [[nodiscard]] void* reallocate(void* memory, u64 oldSize, u64 newSize, u64 alignment) {
+        if(oldSize < RemappableBlockSize && newSize < RemappableBlockSize) {
+            return MallocAllocator().reallocate(memory, oldSize, newSize, alignment);
+        }
+
+        return ReallocateRemappableBlock(memory, oldSize, newSize);
+    }
+
+    bool operator==(const RemappingAllocator& other) const = default;
+
+private:
+    [[nodiscard]] static void* AllocateRemappableBlock(u64 size);
+    static void FreeRemappableBlock(void* memory, u64 size);
+
+    // Handles any resize where either size is at least RemappableBlockSize
+    [[nodiscard]] static void* ReallocateRemappableBlock(void* memory, u64 oldSize, u64 newSize);
+};
+
+// A source of memory that is picked at runtime, such as an arena, a pool or an allocator that tracks usage.
+class MemoryResource {
+public:
+    virtual ~MemoryResource() = default;
+
+    [[nodiscard]] virtual void* allocate(u64 size, u64 alignment) = 0;
+    virtual void deallocate(void* memory, u64 size)                = 0;
+};
+
+// The MemoryResource that forwards to MallocAllocator.
+[[nodiscard]] MemoryResource* MallocResource();
+
+// An allocator that forwards to a MemoryResource, for when the same container type needs to allocate from different
+// places. It defaults to MallocResource, so a default constructed ResourceAllocator behaves like MallocAllocator.
+class ResourceAllocator {
+public:
+    ResourceAllocator();
+    ResourceAllocator(MemoryResource* resource);
+
+    [[nodiscard]] void* allocate(u64 size, u64 alignment);
+    void deallocate(void* memory, u64 size);
+
+    [[nodiscard]] MemoryResource* resource() const;
+
+    bool operator==(const ResourceAllocator& other) const = default;
+
+private:
+    MemoryResource* memoryResource;
+};
+
+static_assert(Allocator<MallocAllocator>);
+static_assert(Allocator<ResourceAllocator>);
+static_assert(ReallocatingAllocator<MallocAllocator>);
+static_assert(ReallocatingAllocator<RemappingAllocator>);
+
+}    // namespace Core::Memory
@@ -0,0 +1,58 @@
+#include "core/memory/FrameAllocator.h"
+
+#include "core/assert/Assert.h"
+
+#include <algorithm>
+#include <string>
+
+namespace Core::Memory {
+
+FrameAllocator::FrameAllocator(std::string_view name, u64 capacityPerFrame, u64 framesInFlight, PageSize pageSize)
+  : arenas(framesInFlight) {
+    ASSERT_WITH_MESSAGE(framesInFlight > 0, "Frame allocator {} needs at least one frame", name);
+
+    for(u64 i = 0; i < framesInFlight; i++) {
+        arenas.emplace(std::string(name) + " (frame " + std::to_string(i) + ")", capacityPerFrame, pageSize);
+    }
+}
+
+void* FrameAllocator::allocate(u64 size, u64 alignment) {
+    return arenas[currentArenaIndex].allocate(size, alignment);
+}
+
+void FrameAllocator::deallocate(void*, u64) {
+    // Nothing is handed back to the arena, because containers can be destroyed after their frame's arena has been reset
+    // and reused. Handing their memory back then would release somebody else's allocation.
+}
+
+void FrameAllocator::nextFrame() {
+    currentArenaIndex = (currentArenaIndex + 1) % arenas.count();
+    arenas[currentArenaIndex].reset();
+    framesStarted++;
+}
+
+LinearArena& FrameAllocator::currentArena() {
+    return arenas[currentArenaIndex];
+}
+
+u64 FrameAllocator::frameCount() const {
+    return framesStarted;
+}
+
+ArenaStatistics FrameAllocator::statistics() const {
+    ArenaStatistics total;
+    for(const LinearArena& arena : arenas) {
+        ArenaStatistics arenaStatistics = arena.statistics();
+
+        total.capacity += arenaStatistics.capacity;
+        total.committedBytes += arenaStatistics.committedBytes;
+        total.bytesInUse += arenaStatistics.bytesInUse;
+        total.highWaterMark = std::max(total.highWaterMark, arenaStatistics.highWaterMark);
+        total.allocationCount += arenaStatistics.allocationCount;
+        total.resetCount += arenaStatistics.resetCount;
+    }
+
+    return total;
+}
+
+}    // namespace Core::Memory
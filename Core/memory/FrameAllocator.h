@@ -0,0 +1,43 @@
+#pragma once
+
+#include "core/Types.h"
+#include "core/containers/Array.h"
+#include "core/memory/Allocator.h"
+#include "core/memory/LinearArena.h"
+
+#include <string_view>
+
+namespace Core::Memory {
+
+// Hands out memory that lives until the end of the frame. Each frame in flight gets its own arena, and moving on to the
+// next frame resets that frame's arena, so memory allocated during a frame stays valid for framesInFlight - 1 more
+// frames. Register it with a SystemClockTicker to have it advance on every tick.
+//
+// Use it through a ResourceAllocator to put containers in frame memory. Their destructors still run, but freeing the
+// memory itself is free.
+class FrameAllocator : public MemoryResource {
+public:
+    FrameAllocator(std::string_view name,
+                   u64 capacityPerFrame,
+                   u64 framesInFlight = 1,
+                   PageSize pageSize  = PageSize::Normal);
+
+    [[nodiscard]] void* allocate(u64 size, u64 alignment) override;
+    void deallocate(void* memory, u64 size) override;
+
+    // Makes the next frame's arena current and releases everything that was allocated from it
+    void nextFrame();
+
+    [[nodiscard]] LinearArena& currentArena();
+    [[nodiscard]] u64 frameCount() const;
+
+    // The sum of the statistics of every frame's arena, except for the high water mark which is the largest of any frame
+    [[nodiscard]] ArenaStatistics statistics() const;
+
+private:
+    Core::Array<LinearArena> arenas;
+    u64 currentArenaIndex = 0;
+    u64 framesStarted     = 0;
+};
+
+}    // namespace Core::Memory
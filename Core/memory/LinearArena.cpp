@@ -0,0 +1,146 @@
+#include "core/memory/LinearArena.h"
+
+#include "core/assert/Assert.h"
+#include "core/memory/VirtualMemory.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace {
+// Committing in bigger steps than a single page keeps the number of system calls down for arenas that grow steadily
+constexpr u64 MinimumCommitSize = 64 * 1024;
+
+u64 AlignUp(u64 value, u64 alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+}    // namespace
+
+namespace Core::Memory {
+
+LinearArena::LinearArena(std::string_view name, u64 capacity, PageSize pageSize) : arenaName(name) {
+    ASSERT_WITH_MESSAGE(capacity > 0, "Arena {} needs a capacity", arenaName);
+
+    if(pageSize == PageSize::Huge && HugePageSize() != 0) {
+        u64 hugeCapacity = AlignUp(capacity, HugePageSize());
+        base             = reinterpret_cast<std::byte*>(AllocateHugePages(hugeCapacity));
+        if(base != nullptr) {
+            reservedSize  = hugeCapacity;
+            committedSize = hugeCapacity;
+            hugePages     = true;
+            return;
+        }
+    }
+
+    reservedSize = AlignUp(capacity, SystemPageSize());
+    base         = reinterpret_cast<std::byte*>(ReserveVirtualMemory(reservedSize));
+    ASSERT_WITH_MESSAGE(base != nullptr, "Failed to reserve {} bytes for arena {}", reservedSize, arenaName);
+
+    // No huge pages were set aside, so hint that the range should get transparent huge pages instead. The system may
+    // ignore that, so the arena still counts as using normal pages.
+    if(pageSize == PageSize::Huge) {
+        AdviseHugePages(base, reservedSize);
+    }
+}
+
+LinearArena::LinearArena(LinearArena&& other)
+  : arenaName(std::move(other.arenaName)),
+    base(std::exchange(other.base, nullptr)),
+    reservedSize(std::exchange(other.reservedSize, 0)),
+    committedSize(std::exchange(other.committedSize, 0)),
+    top(std::exchange(other.top, 0)),
+    hugePages(other.hugePages),
+    highWaterMark(other.highWaterMark),
+    allocationCount(other.allocationCount),
+    resetCount(other.resetCount) {}
+
+LinearArena::~LinearArena() {
+    if(base != nullptr) {
+        ReleaseVirtualMemory(base, reservedSize);
+    }
+}
+
+void* LinearArena::allocate(u64 size, u64 alignment) {
+    u64 start = AlignUp(top, alignment);
+    u64 end   = start + size;
+    ASSERT_WITH_MESSAGE(end <= reservedSize,
+                        "Arena {} is out of space, {} bytes were requested with {} of {} in use",
+                        arenaName,
+                        size,
+                        top,
+                        reservedSize);
+
+    if(end > committedSize) {
+        commitUpTo(end);
+    }
+
+    top           = end;
+    highWaterMark = std::max(highWaterMark, top);
+    allocationCount++;
+
+    return base + start;
+}
+
+void LinearArena::deallocate(void* memory, u64 size) {
+    // Only the most recent allocation can be given back, which handles the common case of a temporary that is freed
+    // straight away. Anything else is reclaimed by the next rewind or reset.
+    if(reinterpret_cast<std::byte*>(memory) + size == base + top) {
+        top -= size;
+    }
+}
+
+LinearArena::Marker LinearArena::mark() const {
+    return Marker{top};
+}
+
+void LinearArena::rewind(Marker marker) {
+    ASSERT(marker.offset <= top);
+    top = marker.offset;
+}
+
+void LinearArena::reset() {
+    top             = 0;
+    allocationCount = 0;
+    resetCount++;
+}
+
+bool LinearArena::owns(const void* memory) const {
+    const std::byte* address = reinterpret_cast<const std::byte*>(memory);
+    return address >= base && address < base + reservedSize;
+}
+
+bool LinearArena::usesHugePages() const {
+    return hugePages;
+}
+
+std::string_view LinearArena::name() const {
+    return arenaName;
+}
+
+ArenaStatistics LinearArena::statistics() const {
+    return ArenaStatistics{
+          .capacity        = reservedSize,
+          .committedBytes  = committedSize,
+          .bytesInUse      = top,
+          .highWaterMark   = highWaterMark,
+          .allocationCount = allocationCount,
+          .resetCount      = resetCount,
+    };
+}
+
+void LinearArena::commitUpTo(u64 offset) {
+    u64 newCommittedSize = std::min(AlignUp(std::max(offset, committedSize + MinimumCommitSize), SystemPageSize()),
+                                    reservedSize);
+
+    bool committed = CommitVirtualMemory(base + committedSize, newCommittedSize - committedSize);
+    ASSERT_WITH_MESSAGE(committed, "Failed to commit {} bytes for arena {}", newCommittedSize, arenaName);
+
+    committedSize = newCommittedSize;
+}
+
+ArenaScope::ArenaScope(LinearArena& arena) : arena(arena), marker(arena.mark()) {}
+
+ArenaScope::~ArenaScope() {
+    arena.rewind(marker);
+}
+
+}    // namespace Core::Memory
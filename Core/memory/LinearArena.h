@@ -0,0 +1,87 @@
+#pragma once
+
+#include "core/Types.h"
+#include "core/memory/Allocator.h"
+
+#include <string>
+#include <string_view>
+
+namespace Core::Memory {
+
+enum class PageSize { Normal, Huge };
+
+struct ArenaStatistics {
+    u64 capacity        = 0;    // Bytes of address space reserved for the arena
+    u64 committedBytes  = 0;    // Bytes that are backed by memory
+    u64 bytesInUse      = 0;
+    u64 highWaterMark   = 0;    // The most bytes that have ever been in use at once, across resets
+    u64 allocationCount = 0;    // Allocations made since the last reset
+    u64 resetCount      = 0;
+};
+
+// A bump allocator over a single reserved range of virtual memory. Allocating moves a pointer forward and freeing does
+// nothing, apart from giving back the most recent allocation. All memory is released at once with reset() or rewind(),
+// after which it must not be deallocated again.
+//
+// Memory is only committed as the arena grows, so reserving a generous capacity is cheap, but running out of capacity is
+// fatal. The high water mark in statistics() is there to size arenas from real workloads. Arenas are not thread safe.
+class LinearArena : public MemoryResource {
+public:
+    // A position in the arena that it can later be rewound to
+    struct Marker {
+        u64 offset;
+    };
+
+    LinearArena(std::string_view name, u64 capacity, PageSize pageSize = PageSize::Normal);
+    LinearArena(LinearArena&& other);
+    LinearArena(const LinearArena& other) = delete;
+
+    LinearArena& operator=(LinearArena&& other) = delete;
+    LinearArena& operator=(const LinearArena& other) = delete;
+
+    ~LinearArena() override;
+
+    [[nodiscard]] void* allocate(u64 size, u64 alignment) override;
+    void deallocate(void* memory, u64 size) override;
+
+    [[nodiscard]] Marker mark() const;
+
+    // Frees everything allocated since marker was taken
+    void rewind(Marker marker);
+
+    void reset();
+
+    [[nodiscard]] bool owns(const void* memory) const;
+    // Whether the arena got huge pages up front. Arenas that only hinted at transparent huge pages don't count.
+    [[nodiscard]] bool usesHugePages() const;
+    [[nodiscard]] std::string_view name() const;
+    [[nodiscard]] ArenaStatistics statistics() const;
+
+private:
+    void commitUpTo(u64 offset);
+
+    std::string arenaName;
+    std::byte* base     = nullptr;
+    u64 reservedSize    = 0;
+    u64 committedSize   = 0;
+    u64 top             = 0;
+    bool hugePages      = false;
+    u64 highWaterMark   = 0;
+    u64 allocationCount = 0;
+    u64 resetCount      = 0;
+};
+
+// Rewinds an arena back to where it was when the scope was entered.
+class ArenaScope {
+public:
+    explicit ArenaScope(LinearArena& arena);
+    ArenaScope(const ArenaScope& other) = delete;
+    ArenaScope& operator=(const ArenaScope& other) = delete;
+    ~ArenaScope();
+
+private:
+    LinearArena& arena;
+    LinearArena::Marker marker;
+};
+
+}    // namespace Core::Memory
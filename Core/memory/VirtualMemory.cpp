@@ -0,0 +1,139 @@
+#include "core/memory/VirtualMemory.h"
+
+#if defined(_WIN32)
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__)
+#include <fstream>
+#include <string>
+#endif
+
+namespace Core::Memory {
+
+#if defined(_WIN32)
+
+u64 SystemPageSize() {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwPageSize;
+}
+
+u64 HugePageSize() {
+    return GetLargePageMinimum();
+}
+
+void* ReserveVirtualMemory(u64 size) {
+    return VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS);
+}
+
+bool CommitVirtualMemory(void* address, u64 size) {
+    return VirtualAlloc(address, size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+}
+
+void* MapVirtualMemory(u64 size) {
+    return VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+}
+
+void* RemapVirtualMemory(void*, u64, u64) {
+    return nullptr;
+}
+
+void* AllocateHugePages(u64 size) {
+    if(HugePageSize() == 0) {
+        return nullptr;
+    }
+
+    return VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+}
+
+bool AdviseHugePages(void*, u64) {
+    return false;
+}
+
+void ReleaseVirtualMemory(void* address, u64) {
+    VirtualFree(address, 0, MEM_RELEASE);
+}
+
+#else
+
+u64 SystemPageSize() {
+    return static_cast<u64>(sysconf(_SC_PAGESIZE));
+}
+
+u64 HugePageSize() {
+#if defined(__linux__)
+    static const u64 size = []() -> u64 {
+        std::ifstream meminfo("/proc/meminfo");
+        std::string field;
+        while(meminfo >> field) {
+            if(field == "Hugepagesize:") {
+                u64 kilobytes = 0;
+                meminfo >> kilobytes;
+                return kilobytes * 1024;
+            }
+        }
+        return 0;
+    }();
+    return size;
+#else
+    return 0;
+#endif
+}
+
+void* ReserveVirtualMemory(u64 size) {
+    void* address = mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    return address == MAP_FAILED ? nullptr : address;
+}
+
+bool CommitVirtualMemory(void* address, u64 size) {
+    return mprotect(address, size, PROT_READ | PROT_WRITE) == 0;
+}
+
+void* MapVirtualMemory(u64 size) {
+    void* address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    return address == MAP_FAILED ? nullptr : address;
+}
+
+#if defined(__linux__)
+void* RemapVirtualMemory(void* address, u64 oldSize, u64 newSize) {
+    void* newAddress = mremap(address, oldSize, newSize, MREMAP_MAYMOVE);
+    return newAddress == MAP_FAILED ? nullptr : newAddress;
+}
+#else
+void* RemapVirtualMemory(void*, u64, u64) {
+    return nullptr;
+}
+#endif
+
+#if defined(__linux__)
+void* AllocateHugePages(u64 size) {
+    void* address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    return address == MAP_FAILED ? nullptr : address;
+}
+
+bool AdviseHugePages(void* address, u64 size) {
+    return madvise(address, size, MADV_HUGEPAGE) == 0;
+}
+#else
+void* AllocateHugePages(u64) {
+    return nullptr;
+}
+
+bool AdviseHugePages(void*, u64) {
+    return false;
+}
+#endif
+
+void ReleaseVirtualMemory(void* address, u64 size) {
+    munmap(address, size);
+}
+
+#endif
+
+}    // namespace Core::Memory
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "core/Types.h"
+
+namespace Core::Memory {
+
+// The granularity that memory can be committed at.
+[[nodiscard]] u64 SystemPageSize();
+
+// The size of a huge (large) page, or 0 if the system doesn't support them. On Linux this is the default size the kernel
+// reports in /proc/meminfo.
+[[nodiscard]] u64 HugePageSize();
+
+// Reserves a range of address space without backing it with memory. The range has to be committed before it is used.
+[[nodiscard]] void* ReserveVirtualMemory(u64 size);
+
+// Backs part of a reserved range with readable and writable memory. Both address and size must be page aligned.
+[[nodiscard]] bool CommitVirtualMemory(void* address, u64 size);
+
+// Reserves and commits size bytes of readable and writable memory in one go.
+[[nodiscard]] void* MapVirtualMemory(u64 size);
+
+// Grows or shrinks a range returned by MapVirtualMemory, moving it if it can't be resized in place. The pages are
+// remapped rather than copied, so this is cheap however large the range is. Returns nullptr if the system can't remap
+// pages, which is the case everywhere but Linux, or if remapping failed; the original range is left untouched then.
+[[nodiscard]] void* RemapVirtualMemory(void* address, u64 oldSize, u64 newSize);
+
+// Reserves and commits size bytes backed by huge pages, which cuts down on TLB misses for large, hot allocations. size
+// must be a multiple of HugePageSize(). Returns nullptr if huge pages aren't available, for example because no pages
+// were set aside for them on Linux or the process lacks the privilege to lock pages in memory on Windows.
+[[nodiscard]] void* AllocateHugePages(u64 size);
+
+// Asks the system to back a range with huge pages where it can, which Linux does with transparent huge pages. This is
+// only a hint, the range may still end up in normal pages. Returns false if the system doesn't take the hint at all.
+bool AdviseHugePages(void* address, u64 size);
+
+// Releases a range returned by ReserveVirtualMemory, MapVirtualMemory or AllocateHugePages.
+void ReleaseVirtualMemory(void* address, u64 size);
+
+}    // namespace Core::Memory
@@ -0,0 +1,216 @@
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/Types.h"
+#include "core/algorithms/Strings.h"
+#include "core/containers/Array.h"
+#include "core/containers/Colony.h"
+#include "core/containers/InlineArray.h"
+#include "core/containers/SoAArray.h"
+#include "core/io/serialization/ArrayBuffer.h"
+#include "core/io/serialization/OutputStream.h"
+#include "core/memory/Allocator.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+namespace {
+class TrackingResource : public Core::Memory::MemoryResource {
+public:
+    void* allocate(u64 size, u64 alignment) override {
+        allocationCount++;
+        bytesInUse += size;
+        return Core::Memory::MallocResource()->allocate(size, alignment);
+    }
+
+    void deallocate(void* memory, u64 size) override {
+        deallocationCount++;
+        bytesInUse -= size;
+        Core::Memory::MallocResource()->deallocate(memory, size);
+    }
+
+    u64 allocationCount   = 0;
+    u64 deallocationCount = 0;
+    u64 bytesInUse        = 0;
+};
+}    // namespace
+
+TEST_CASE("Default Allocator Adds No Size") {
+    struct ArrayWithoutAllocator {
+        u64 capacity;
+        u64 elementCount;
+        u64* data;
+    };
+
+    STATIC_REQUIRE(sizeof(Core::Array<u64>) == sizeof(ArrayWithoutAllocator));
+}
+
+TEMPLATE_TEST_CASE("Reallocate Keeps Contents", "", Core::Memory::MallocAllocator, Core::Memory::RemappingAllocator) {
+    TestType allocator;
+
+    // Crosses in and out of the sizes that RemappingAllocator remaps on Linux
+    u64 sizes[] = {64, 4096, 1024 * 1024, 8 * 1024 * 1024, 100, 3 * 1024 * 1024};
+
+    u64 size   = 16;
+    u8* memory = reinterpret_cast<u8*>(allocator.allocate(size, 1));
+    std::memset(memory, 0xAB, size);
+
+    for(u64 newSize : sizes) {
+        memory = reinterpret_cast<u8*>(allocator.reallocate(memory, size, newSize, 1));
+        REQUIRE(memory != nullptr);
+
+        u64 keptSize = std::min(size, newSize);
+        REQUIRE(std::all_of(memory, memory + keptSize, [](u8 value) { return value == 0xAB; }));
+
+        std::memset(memory, 0xAB, newSize);
+        size = newSize;
+    }
+
+    allocator.deallocate(memory, size);
+}
+
+TEST_CASE("Array Allocates From Resource") {
+    TrackingResource resource;
+
+    {
+        Core::Array<std::string, Core::Memory::ResourceAllocator> array(&resource);
+        REQUIRE(array.allocator().resource() == &resource);
+
+        for(u64 i = 0; i < 100; i++) {
+            array.emplace(std::to_string(i));
+        }
+
+        REQUIRE(resource.allocationCount > 1);
+        REQUIRE(resource.bytesInUse == array.totalCapacity() * sizeof(std::string));
+
+        Core::Array<std::string, Core::Memory::ResourceAllocator> copy(array);
+        REQUIRE(copy.allocator().resource() == &resource);
+        REQUIRE(copy.count() == 100);
+
+        Core::Array<std::string, Core::Memory::ResourceAllocator> moved(std::move(copy));
+        REQUIRE(moved.allocator().resource() == &resource);
+        REQUIRE(moved[99] == "99");
+
+        Core::Array<std::string, Core::Memory::ResourceAllocator> spanCopy(Core::ToSpan(moved), &resource);
+        REQUIRE(spanCopy.allocator().resource() == &resource);
+        REQUIRE(spanCopy.count() == 100);
+        REQUIRE(spanCopy[99] == "99");
+    }
+
+    REQUIRE(resource.bytesInUse == 0);
+    REQUIRE(resource.allocationCount == resource.deallocationCount);
+}
+
+TEST_CASE("Colony Allocates Blocks From Resource") {
+    TrackingResource resource;
+
+    {
+        Core::Colony<std::string, Core::Memory::ResourceAllocator> colony(&resource);
+        Core::Array<std::string*> elements;
+        for(u64 i = 0; i < 100; i++) {
+            elements.insert(&colony.emplace(std::to_string(i)));
+        }
+
+        REQUIRE(resource.allocationCount > 1);
+
+        // Emptying the first block gives it back
+        u64 deallocationsBefore = resource.deallocationCount;
+        for(u64 i = 0; i < Core::Colony<std::string>::FirstBlockCapacity; i++) {
+            colony.erase(elements[i]);
+        }
+        REQUIRE(resource.deallocationCount == deallocationsBefore + 1);
+
+        Core::Colony<std::string, Core::Memory::ResourceAllocator> moved(std::move(colony));
+        REQUIRE(moved.allocator().resource() == &resource);
+        REQUIRE(moved.count() == 100 - Core::Colony<std::string>::FirstBlockCapacity);
+    }
+
+    REQUIRE(resource.bytesInUse == 0);
+    REQUIRE(resource.allocationCount == resource.deallocationCount);
+}
+
+TEST_CASE("Inline Array Spills Into Resource") {
+    TrackingResource resource;
+
+    {
+        Core::InlineArray<std::string, 2, Core::Memory::ResourceAllocator> array(&resource);
+        array.emplace("a");
+        array.emplace("b");
+        REQUIRE(resource.allocationCount == 0);
+
+        for(u64 i = 0; i < 100; i++) {
+            array.emplace(std::to_string(i));
+        }
+
+        REQUIRE(!array.isInline());
+        REQUIRE(resource.bytesInUse == array.totalCapacity() * sizeof(std::string));
+
+        Core::InlineArray<std::string, 2, Core::Memory::ResourceAllocator> moved;
+        moved = std::move(array);
+        REQUIRE(moved.allocator().resource() == &resource);
+        REQUIRE(moved[101] == "99");
+    }
+
+    REQUIRE(resource.bytesInUse == 0);
+    REQUIRE(resource.allocationCount == resource.deallocationCount);
+}
+
+TEST_CASE("SoA Array Allocates From Resource") {
+    TrackingResource resource;
+
+    {
+        Core::BasicSoAArray<Core::Memory::ResourceAllocator, u32, std::string> array(&resource);
+        for(u32 i = 0; i < 100; i++) {
+            array.emplace(i, std::to_string(i));
+        }
+
+        REQUIRE(resource.allocationCount > 1);
+        REQUIRE(resource.bytesInUse > 0);
+
+        Core::BasicSoAArray<Core::Memory::ResourceAllocator, u32, std::string> copy(array);
+        REQUIRE(copy.allocator().resource() == &resource);
+        REQUIRE(copy.get<1>(99) == "99");
+    }
+
+    REQUIRE(resource.bytesInUse == 0);
+    REQUIRE(resource.allocationCount == resource.deallocationCount);
+}
+
+TEST_CASE("Default Resource Allocator Uses Malloc") {
+    Core::Array<u64, Core::Memory::ResourceAllocator> array;
+
+    REQUIRE(array.allocator().resource() == Core::Memory::MallocResource());
+    array.emplace(4);
+    REQUIRE(array[0] == 4);
+}
+
+TEST_CASE("Array Buffer Allocates From Resource") {
+    TrackingResource resource;
+
+    {
+        Core::IO::BasicArrayBuffer<Core::Memory::ResourceAllocator> buffer(0, &resource);
+        Core::IO::OutputStream out(&buffer);
+        out.write(std::string("Some data to write"));
+
+        REQUIRE(resource.allocationCount > 0);
+        REQUIRE(buffer.buffer().count() > 0);
+    }
+
+    REQUIRE(resource.bytesInUse == 0);
+}
+
+TEST_CASE("Split Allocates From Resource") {
+    TrackingResource resource;
+
+    {
+        Core::Array<std::string_view, Core::Memory::ResourceAllocator> splits = Core::Algorithms::String::Split(
+              "a,b,c", ',', Core::Algorithms::String::Filter::None, Core::Memory::ResourceAllocator(&resource));
+
+        REQUIRE(splits.count() == 3);
+        REQUIRE(splits[2] == "c");
+        REQUIRE(resource.allocationCount > 0);
+    }
+
+    REQUIRE(resource.bytesInUse == 0);
+}
@@ -0,0 +1,137 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/Types.h"
+#include "core/containers/Array.h"
+#include "core/memory/FrameAllocator.h"
+#include "core/memory/LinearArena.h"
+#include "core/memory/VirtualMemory.h"
+
+#include <cstring>
+#include <string>
+
+TEST_CASE("Arena Allocations Are Aligned And Distinct") {
+    Core::Memory::LinearArena arena("Test", 1024 * 1024);
+
+    void* first  = arena.allocate(3, 1);
+    void* second = arena.allocate(8, 8);
+    void* third  = arena.allocate(64, 64);
+
+    REQUIRE(reinterpret_cast<uintptr_t>(second) % 8 == 0);
+    REQUIRE(reinterpret_cast<uintptr_t>(third) % 64 == 0);
+    REQUIRE(static_cast<std::byte*>(second) >= static_cast<std::byte*>(first) + 3);
+    REQUIRE(static_cast<std::byte*>(third) >= static_cast<std::byte*>(second) + 8);
+
+    REQUIRE(arena.owns(first));
+    REQUIRE(arena.owns(third));
+    REQUIRE(!arena.owns(&arena));
+}
+
+TEST_CASE("Arena Commits Memory As It Grows") {
+    const u64 capacity = 64 * 1024 * 1024;
+    Core::Memory::LinearArena arena("Test", capacity);
+
+    REQUIRE(arena.statistics().capacity >= capacity);
+    REQUIRE(arena.statistics().committedBytes == 0);
+
+    // Touch every byte to make sure that the memory is really there
+    const u64 size = 3 * 1024 * 1024 + 17;
+    void* memory   = arena.allocate(size, 16);
+    std::memset(memory, 0xAB, size);
+
+    REQUIRE(arena.statistics().committedBytes >= size);
+    REQUIRE(arena.statistics().committedBytes < capacity);
+}
+
+TEST_CASE("Arena Gives Back The Latest Allocation") {
+    Core::Memory::LinearArena arena("Test", 1024 * 1024);
+
+    void* first = arena.allocate(16, 16);
+    u64 inUse   = arena.statistics().bytesInUse;
+
+    void* second = arena.allocate(32, 16);
+    arena.deallocate(first, 16);
+    REQUIRE(arena.statistics().bytesInUse == inUse + 32);
+
+    arena.deallocate(second, 32);
+    REQUIRE(arena.statistics().bytesInUse == inUse);
+    REQUIRE(arena.allocate(32, 16) == second);
+}
+
+TEST_CASE("Arena Rewind And Reset") {
+    Core::Memory::LinearArena arena("Test", 1024 * 1024);
+
+    REQUIRE(arena.allocate(100, 1) != nullptr);
+    Core::Memory::LinearArena::Marker marker = arena.mark();
+
+    {
+        Core::Memory::ArenaScope scope(arena);
+        REQUIRE(arena.allocate(1000, 1) != nullptr);
+        REQUIRE(arena.statistics().bytesInUse == 1100);
+    }
+
+    REQUIRE(arena.mark().offset == marker.offset);
+
+    REQUIRE(arena.allocate(500, 1) != nullptr);
+    arena.rewind(marker);
+    REQUIRE(arena.statistics().bytesInUse == 100);
+
+    arena.reset();
+    Core::Memory::ArenaStatistics statistics = arena.statistics();
+    REQUIRE(statistics.bytesInUse == 0);
+    REQUIRE(statistics.highWaterMark == 1100);
+    REQUIRE(statistics.allocationCount == 0);
+    REQUIRE(statistics.resetCount == 1);
+}
+
+TEST_CASE("Huge Page Arena") {
+    // Huge pages may not be available, in which case the arena quietly uses normal pages
+    Core::Memory::LinearArena arena("Test", 4 * 1024 * 1024, Core::Memory::PageSize::Huge);
+
+    // Without huge pages nothing is committed up front, even if transparent huge pages were asked for
+    if(!arena.usesHugePages()) {
+        REQUIRE(arena.statistics().committedBytes == 0);
+    }
+
+    void* memory = arena.allocate(4 * 1024 * 1024, 64);
+    std::memset(memory, 0, 4 * 1024 * 1024);
+
+    if(arena.usesHugePages()) {
+        REQUIRE(arena.statistics().capacity % Core::Memory::HugePageSize() == 0);
+    }
+}
+
+TEST_CASE("Array In An Arena") {
+    Core::Memory::LinearArena arena("Test", 1024 * 1024);
+
+    {
+        Core::Array<std::string, Core::Memory::ResourceAllocator> strings(&arena);
+        for(u64 i = 0; i < 1000; i++) {
+            strings.emplace(std::to_string(i));
+        }
+
+        REQUIRE(strings[999] == "999");
+        REQUIRE(arena.owns(strings.rawData()));
+    }
+
+    REQUIRE(arena.statistics().allocationCount > 1);
+}
+
+TEST_CASE("Frame Allocator Cycles Through Frames") {
+    Core::Memory::FrameAllocator frames("Frames", 1024 * 1024, 2);
+
+    void* firstFrame = frames.allocate(256, 16);
+    frames.nextFrame();
+
+    void* secondFrame = frames.allocate(128, 16);
+    REQUIRE(secondFrame != firstFrame);
+    REQUIRE(!frames.currentArena().owns(firstFrame));
+
+    frames.nextFrame();
+    REQUIRE(frames.currentArena().owns(firstFrame));
+    REQUIRE(frames.allocate(16, 16) == firstFrame);
+
+    Core::Memory::ArenaStatistics statistics = frames.statistics();
+    REQUIRE(statistics.highWaterMark == 256);
+    REQUIRE(statistics.bytesInUse == 128 + 16);
+    REQUIRE(frames.frameCount() == 2);
+}
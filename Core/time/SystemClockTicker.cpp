@@ -7,6 +7,10 @@ SystemClockTicker::SystemClockTicker() : previousTick(systemClock.now()) {}
 void SystemClockTicker::tick() {
     std::chrono::steady_clock::time_point currentTick = systemClock.now();
 
+    for(Core::Memory::FrameAllocator* allocator : frameAllocators) {
+        allocator->nextFrame();
+    }
+
     for(Clock* clock : clocksToTick) {
         clock->tick(currentTick - previousTick);
     }
@@ -22,4 +26,8 @@ const Core::Array<Clock*>& SystemClockTicker::clocks() const {
     return clocksToTick;
 }
 
+void SystemClockTicker::registerFrameAllocator(Core::Memory::FrameAllocator* allocator) {
+    frameAllocators.insert(allocator);
+}
+
 }    // namespace Core
\ No newline at end of file
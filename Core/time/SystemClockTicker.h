@@ -3,6 +3,7 @@
 #include "core/time/Clock.h"
 
 #include "core/containers/Array.h"
+#include "core/memory/FrameAllocator.h"
 
 #include <chrono>
 
@@ -15,10 +16,14 @@ public:
     void registerClock(Clock* clock);
     const Core::Array<Clock*>& clocks() const;
 
+    // Registered frame allocators move on to their next frame at the start of every tick
+    void registerFrameAllocator(Core::Memory::FrameAllocator* allocator);
+
 private:
     std::chrono::steady_clock systemClock;
     std::chrono::steady_clock::time_point previousTick;
 
     Core::Array<Clock*> clocksToTick;
+    Core::Array<Core::Memory::FrameAllocator*> frameAllocators;
 };
 }    // namespace Core
\ No newline at end of file
@@ -46,7 +46,11 @@ VkCommandBuffer VulkanCommandPool::allocateSingleUseBuffer(const VkDevice device
     return buffer;
 }
 
-void VulkanCommandPool::freeBuffers(const VkDevice device, const Core::Array<VkCommandBuffer>& buffers) const {
+void VulkanCommandPool::freeBuffer(const VkDevice device, VkCommandBuffer buffer) const {
+    vkFreeCommandBuffers(device, object, 1, &buffer);
+}
+
+void VulkanCommandPool::freeBuffers(const VkDevice device, Core::Span<const VkCommandBuffer> buffers) const {
     vkFreeCommandBuffers(device, object, static_cast<uint32_t>(buffers.count()), buffers.rawData());
 }
 
@@ -3,6 +3,7 @@
 #include "VulkanCore.h"
 
 #include "core/containers/Array.h"
+#include "core/containers/Span.h"
 
 namespace Renderer::Backends::Vulkan {
 
@@ -19,7 +20,8 @@ struct VulkanCommandPool : public VulkanObject<VkCommandPool> {
                     VulkanCommandBufferLevel level = VulkanCommandBufferLevel::Primary) const;
     VkCommandBuffer allocateSingleUseBuffer(const VkDevice device,
                                             VulkanCommandBufferLevel level = VulkanCommandBufferLevel::Primary) const;
-    void freeBuffers(const VkDevice device, const Core::Array<VkCommandBuffer>& buffers) const;
+    void freeBuffer(const VkDevice device, VkCommandBuffer buffer) const;
+    void freeBuffers(const VkDevice device, Core::Span<const VkCommandBuffer> buffers) const;
 
     static VulkanCommandPool
     Create(VkDevice device,
@@ -26,7 +26,7 @@ void VulkanDescriptorSetUpdate::addSampledImage(uint32_t binding,
 }
 
 void VulkanDescriptorSetUpdate::update(VkDevice device, VkDescriptorSet descriptorSet) const {
-    Core::Array<VkWriteDescriptorSet> writes;
+    Core::InlineArray<VkWriteDescriptorSet, 8> writes;
 
     for(auto& bufferWrite : buffers) {
         VkWriteDescriptorSet& set = writes.emplace();
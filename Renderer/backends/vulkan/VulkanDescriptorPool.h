@@ -6,6 +6,7 @@
 #include "VulkanSampler.h"
 
 #include "core/containers/Array.h"
+#include "core/containers/InlineArray.h"
 
 
 namespace Renderer::Backends::Vulkan {
@@ -17,8 +18,9 @@ struct VulkanDescriptorSetUpdate {
     void update(VkDevice device, VkDescriptorSet descriptorSet) const;
 
 private:
-    Core::Array<std::pair<uint32_t, VkDescriptorBufferInfo>> buffers;
-    Core::Array<std::pair<uint32_t, VkDescriptorImageInfo>> images;
+    // Sets are updated a few bindings at a time, which fit without allocating
+    Core::InlineArray<std::pair<uint32_t, VkDescriptorBufferInfo>, 4> buffers;
+    Core::InlineArray<std::pair<uint32_t, VkDescriptorImageInfo>, 4> images;
 };
 
 struct VulkanDescriptorPool : VulkanObject<VkDescriptorPool> {
@@ -80,8 +80,8 @@ void VulkanRendererBackend::shutdown() {
         VulkanSemaphore::Destroy(logicalDevice, frameResource.renderFinishedSemaphore);
         VulkanFence::Destroy(logicalDevice, frameResource.queueFence);
 
-        queues.graphics.pool.freeBuffers(logicalDevice, {frameResource.mainCommandBuffer});
-        queues.graphics.pool.freeBuffers(logicalDevice, frameResource.commandBuffers);
+        queues.graphics.pool.freeBuffer(logicalDevice, frameResource.mainCommandBuffer);
+        queues.graphics.pool.freeBuffers(logicalDevice, Core::ToSpan(frameResource.commandBuffers));
     }
 
     if(swapChain) {
@@ -171,11 +171,11 @@ VulkanBuffer VulkanRendererBackend::createBuffer(std::span<const std::byte> data
     vkCmdCopyBuffer(copyBuffer, stagingBuffer, finalBuffer, 1, &copyRegion);
     vkEndCommandBuffer(copyBuffer);
 
-    SubmittedCommandBuffers& submittedBuffer =
-          submittedCommandBuffers.emplace(SubmittedCommandBuffers{.submitFence    = VulkanFence::Create(logicalDevice),
-                                                                  .pool           = queues.transfer.pool,
-                                                                  .commandBuffers = {copyBuffer},
-                                                                  .dataBuffers    = {stagingBuffer}});
+    SubmittedCommandBuffers& submittedBuffer = submittedCommandBuffers.emplaceBack(
+          SubmittedCommandBuffers{.submitFence    = VulkanFence::Create(logicalDevice),
+                                  .pool           = queues.transfer.pool,
+                                  .commandBuffers = {copyBuffer},
+                                  .dataBuffers    = {stagingBuffer}});
 
     queues.transfer.submit(
           copyBuffer, VulkanQueueSubmitType::Transfer, VK_NULL_HANDLE, VK_NULL_HANDLE, submittedBuffer.submitFence);
@@ -221,11 +221,11 @@ VulkanImage VulkanRendererBackend::createImage(std::span<const std::byte> data,
 
     vkEndCommandBuffer(commandBuffer);
 
-    SubmittedCommandBuffers& submittedBuffer =
-          submittedCommandBuffers.emplace(SubmittedCommandBuffers{.submitFence    = VulkanFence::Create(logicalDevice),
-                                                                  .pool           = queues.transfer.pool,
-                                                                  .commandBuffers = {commandBuffer},
-                                                                  .dataBuffers    = {transferBuffer}});
+    SubmittedCommandBuffers& submittedBuffer = submittedCommandBuffers.emplaceBack(
+          SubmittedCommandBuffers{.submitFence    = VulkanFence::Create(logicalDevice),
+                                  .pool           = queues.transfer.pool,
+                                  .commandBuffers = {commandBuffer},
+                                  .dataBuffers    = {transferBuffer}});
 
     queues.transfer.submit(
           commandBuffer, VulkanQueueSubmitType::Transfer, VK_NULL_HANDLE, VK_NULL_HANDLE, submittedBuffer.submitFence);
@@ -259,12 +259,11 @@ Renderer::Resources::GPUMesh VulkanRendererBackend::createMesh(std::span<const s
 }
 
 void VulkanRendererBackend::processFinishedSubmitResources() {
-    while(!submittedCommandBuffers.empty() &&
+    while(!submittedCommandBuffers.isEmpty() &&
           vkGetFenceStatus(logicalDevice, submittedCommandBuffers.front().submitFence)) {
-        SubmittedCommandBuffers submittedBuffers = submittedCommandBuffers.front();
-        submittedCommandBuffers.pop();
+        SubmittedCommandBuffers submittedBuffers = submittedCommandBuffers.popFront();
 
-        submittedBuffers.pool.freeBuffers(logicalDevice, submittedBuffers.commandBuffers);
+        submittedBuffers.pool.freeBuffers(logicalDevice, Core::ToSpan(submittedBuffers.commandBuffers));
         for(auto& buffer : submittedBuffers.dataBuffers) {
             VulkanBuffer::Destroy(buffer);
         }
@@ -297,7 +296,7 @@ VulkanRendererBackend::CreateWithSurface(const std::string& applicationName,
 }
 
 
-Core::Status VulkanRendererBackend::submitCommands(const Core::Array<VulkanFrameCommands>& commands) {
+Core::Status VulkanRendererBackend::submitCommands(Core::Span<const VulkanFrameCommands> commands) {
     currentFrameResourcesIndex = (currentFrameResourcesIndex + 1) % frameResources.size();
     FrameResources& resources  = frameResources[currentFrameResourcesIndex];
 
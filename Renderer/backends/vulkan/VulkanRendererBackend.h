@@ -19,11 +19,14 @@
 
 #include "core/containers/Array.h"
 #include "core/containers/HashSet.h"
+#include "core/containers/InlineArray.h"
+#include "core/containers/Queue.h"
+#include "core/containers/Span.h"
+#include "core/memory/Allocator.h"
 #include "core/status/StatusOr.h"
 
 #include <functional>
 #include <optional>
-#include <queue>
 #include <span>
 #include <string>
 
@@ -39,8 +42,9 @@ struct VulkanSurfaceFormat {
 struct SubmittedCommandBuffers {
     VulkanFence submitFence;
     VulkanCommandPool pool;
-    Core::Array<VkCommandBuffer> commandBuffers;
-    Core::Array<VulkanBuffer> dataBuffers;
+    // Uploads submit a single command buffer with a single staging buffer, so neither needs an allocation
+    Core::InlineArray<VkCommandBuffer, 1> commandBuffers;
+    Core::InlineArray<VulkanBuffer, 1> dataBuffers;
 };
 
 struct FrameResources {
@@ -58,6 +62,8 @@ struct FrameResources {
     Core::Array<VulkanBuffer> buffers;
 };
 
+// The mesh is read when the commands are recorded, so it has to stay where it is until then. Meshes kept in a
+// Core::Colony never move.
 struct VulkanDrawMeshCommand {
     Resources::GPUMesh* mesh;
     VulkanGraphicsPipeline pipeline;
@@ -76,10 +82,14 @@ struct VulkanDrawMeshInstancedCommand {
 
 using VulkanCustomDrawCommand = std::function<void(VkCommandBuffer)>;
 
+// Commands are rebuilt every frame, so their storage can come from a frame allocator
 struct VulkanFrameCommands {
-    Core::Array<VulkanDrawMeshCommand> meshCommands;
-    Core::Array<VulkanDrawMeshInstancedCommand> instanceMeshCommands;
-    Core::Array<VulkanCustomDrawCommand> customCommands;
+    explicit VulkanFrameCommands(const Core::Memory::ResourceAllocator& allocator = {})
+      : meshCommands(allocator), instanceMeshCommands(allocator), customCommands(allocator) {}
+
+    Core::Array<VulkanDrawMeshCommand, Core::Memory::ResourceAllocator> meshCommands;
+    Core::Array<VulkanDrawMeshInstancedCommand, Core::Memory::ResourceAllocator> instanceMeshCommands;
+    Core::Array<VulkanCustomDrawCommand, Core::Memory::ResourceAllocator> customCommands;
 };
 
 class VulkanRendererBackend : public RendererBackend {
@@ -120,9 +130,9 @@ public:
         return createBuffer(Core::AsBytes(data), bufferType);
     }
 
-    template <typename VERTEX_TYPE, typename INDEX_TYPE>
-    Renderer::Resources::GPUMesh createMesh(const Core::Array<VERTEX_TYPE>& vertexData,
-                                            const Core::Array<INDEX_TYPE>& indexData,
+    template <typename VERTEX_TYPE, typename VERTEX_ALLOCATOR, typename INDEX_TYPE, typename INDEX_ALLOCATOR>
+    Renderer::Resources::GPUMesh createMesh(const Core::Array<VERTEX_TYPE, VERTEX_ALLOCATOR>& vertexData,
+                                            const Core::Array<INDEX_TYPE, INDEX_ALLOCATOR>& indexData,
                                             VkIndexType indexType) {
         return createMesh(Core::AsBytes(vertexData), Core::AsBytes(indexData), indexType);
     }
@@ -134,7 +144,7 @@ public:
                       const Core::HashSet<std::string>& requiredDeviceExtensions,
                       const Core::HashSet<std::string>& requiredValidationLayers = {});
 
-    Core::Status submitCommands(const Core::Array<VulkanFrameCommands>& commands);
+    Core::Status submitCommands(Core::Span<const VulkanFrameCommands> commands);
 
     VulkanInstance& getInstance() {
         return instance;
@@ -173,7 +183,7 @@ private:
     std::optional<VulkanRenderPass> swapChainRenderPass;
     std::optional<VulkanSwapChain> swapChain;
 
-    std::queue<SubmittedCommandBuffers> submittedCommandBuffers;
+    Core::Queue<SubmittedCommandBuffers> submittedCommandBuffers;
 };
 
 }    // namespace Renderer::Backends::Vulkan
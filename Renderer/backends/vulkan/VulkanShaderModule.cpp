@@ -5,6 +5,12 @@
 namespace Renderer::Backends::Vulkan {
 
 VulkanShaderModule VulkanShaderModule::Create(VkDevice device, const Core::Array<std::byte>& code) {
+    return Create(device, Core::ToSpan(code));
+}
+
+VulkanShaderModule VulkanShaderModule::Create(VkDevice device, Core::Span<const std::byte> code) {
+    ASSERT(reinterpret_cast<uintptr_t>(code.rawData()) % alignof(uint32_t) == 0);
+
     VkShaderModuleCreateInfo createInfo = {};
     createInfo.sType                    = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
     createInfo.codeSize                 = code.count();
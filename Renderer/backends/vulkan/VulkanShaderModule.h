@@ -1,6 +1,7 @@
 #pragma once
 
 #include "core/containers/Array.h"
+#include "core/containers/Span.h"
 #include "core/io/file_system/Path.h"
 
 #include "VulkanCore.h"
@@ -8,6 +9,8 @@
 namespace Renderer::Backends::Vulkan {
 struct VulkanShaderModule : public VulkanObject<VkShaderModule> {
     static VulkanShaderModule Create(VkDevice device, const Core::Array<std::byte>& code);
+    // The code has to be aligned to 4 bytes, as SPIR-V is made of 32-bit words
+    static VulkanShaderModule Create(VkDevice device, Core::Span<const std::byte> code);
     static VulkanShaderModule CreateFromFile(VkDevice device, const Core::IO::Path& filename);
     static void Destroy(VkDevice device, VulkanShaderModule& shaderModule);
 };
@@ -79,7 +79,7 @@ VulkanSwapChain VulkanSwapChain::Create(VkDevice device,
     }
 
     vkQueueWaitIdle(queues.transfer);
-    queues.transfer.pool.freeBuffers(device, {commandBuffer});
+    queues.transfer.pool.freeBuffer(device, commandBuffer);
 
 
     return swapChain;
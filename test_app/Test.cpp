@@ -13,9 +13,14 @@
 #include <glm/gtc/matrix_transform.hpp>
 
 
+#include "core/containers/Colony.h"
+#include "core/containers/SoAArray.h"
 #include "core/io/file_system/FileSystem.h"
 #include "core/io/file_system/Path.h"
 #include "core/io/file_system/VirtualFileSystemMount.h"
+#include "core/jobs/JobSystem.h"
+#include "core/jobs/Task.h"
+#include "core/memory/FrameAllocator.h"
 #include "core/time/SystemClockTicker.h"
 #include "core/time/Timer.h"
 
@@ -48,7 +53,8 @@ Core::Array<VkDescriptorSet> uniformBuffersDescriptors;
 Core::Array<VulkanBuffer> uniformBuffers;
 Core::Array<VulkanBuffer> instanceBuffers;
 
-Renderer::Resources::GPUMesh mesh;
+Core::Colony<Renderer::Resources::GPUMesh> meshes;
+Renderer::Resources::GPUMesh* mesh = nullptr;
 Renderer::Resources::GPUTexture texture;
 
 const int MAX_FRAME_IN_FLIGHT = 2;
@@ -80,8 +86,11 @@ void cleanupVulkan(VulkanRendererBackend& backend) {
     VulkanSampler::Destroy(device, texture.sampler);
 
     VulkanImage::Destroy(texture.image);
-    VulkanBuffer::Destroy(mesh.vertexBuffer);
-    VulkanBuffer::Destroy(mesh.indexBuffer);
+    for(Renderer::Resources::GPUMesh& gpuMesh : meshes) {
+        VulkanBuffer::Destroy(gpuMesh.vertexBuffer);
+        VulkanBuffer::Destroy(gpuMesh.indexBuffer);
+    }
+    meshes.clear();
 
     VulkanDescriptorPool::Destroy(device, descriptorPool);
 
@@ -92,7 +101,7 @@ void cleanupVulkan(VulkanRendererBackend& backend) {
     backend.shutdown();
 }
 
-Core::Status createGraphicsPipeline(VulkanRendererBackend& backend, const Assets::Mesh& meshData) {
+Core::Status createGraphicsPipeline(VulkanRendererBackend& backend, const Assets::MeshView& meshData) {
     VulkanLogicalDevice& device = backend.getLogicalDevice();
     VulkanRenderPass renderPass = *backend.getSwapChainRenderPass();
 
@@ -131,34 +140,57 @@ void createDrawDataBuffers(VulkanRendererBackend& backend) {
 }
 
 
-Core::Status createVertexBuffer(VulkanRendererBackend& backend) {
-    std::string file = "Models/chalet.mesh";
+template <typename ASSET>
+Core::Jobs::Task<Core::StatusOr<ASSET>> loadAsset(Core::Jobs::JobSystem& jobs, std::string file) {
+    co_await Core::Jobs::ResumeOn(jobs);
 
-    ASSIGN_OR_RETURN(Core::IO::InputStream input, Core::IO::OpenFileForRead(file));
+    Core::IO::InputStream input = co_await Core::IO::OpenFileForRead(file);
+    co_return input.read<ASSET>();
+}
 
-    auto model = input.read<Assets::Mesh>();
-    RETURN_IF_ERROR(createGraphicsPipeline(backend, model));
+// A mesh read as a view of its mapped file. The stream keeps the file mapped while the view's vertex and index data
+// point into it, so they are uploaded without being copied first.
+struct MappedMesh {
+    Core::IO::InputStream file;
+    Assets::MeshView mesh;
+};
 
-    mesh = backend.createMesh(model.vertexData, model.indexData, VK_INDEX_TYPE_UINT32);
+Core::Jobs::Task<Core::StatusOr<MappedMesh>> loadMappedMesh(Core::Jobs::JobSystem& jobs, std::string file) {
+    co_await Core::Jobs::ResumeOn(jobs);
 
-    return Core::Status::Ok();
+    Core::IO::InputStream input = co_await Core::IO::OpenMappedFileForRead(file);
+    Assets::MeshView mesh       = input.read<Assets::MeshView>();
+    co_return MappedMesh{.file = std::move(input), .mesh = std::move(mesh)};
 }
 
-Core::Status createTextureImage(VulkanRendererBackend& backend) {
-    std::string file = "Textures/chalet_texture.texture";
-    ASSIGN_OR_RETURN(Core::IO::InputStream input, Core::IO::OpenFileForRead(file));
+Core::Status createVertexBuffer(VulkanRendererBackend& backend, const Assets::MeshView& model) {
+    RETURN_IF_ERROR(createGraphicsPipeline(backend, model));
 
-    auto textureAsset = input.read<Assets::Texture>();
+    mesh = &meshes.insert(backend.createMesh(
+          Core::AsBytes(model.vertexData.span()), Core::AsBytes(model.indexData.span()), VK_INDEX_TYPE_UINT32));
 
+    return Core::Status::Ok();
+}
+
+Core::Status createTextureImage(VulkanRendererBackend& backend, const Assets::Texture& textureAsset) {
     texture = backend.createTexture(
           Core::ToSpan(textureAsset.data), VK_FORMAT_R8G8B8A8_UNORM, {textureAsset.width, textureAsset.height});
 
     return Core::Status::Ok();
 }
 
-Core::Status initVulkanBackend(VulkanRendererBackend& backend) {
-    RETURN_IF_ERROR(createVertexBuffer(backend));
-    RETURN_IF_ERROR(createTextureImage(backend));
+Core::Status initVulkanBackend(Core::Jobs::JobSystem& jobs, VulkanRendererBackend& backend) {
+    // The mesh and the texture are read and decoded side by side, while the uploads stay on this thread
+    Core::Jobs::Task<Core::StatusOr<MappedMesh>> meshLoad = loadMappedMesh(jobs, "Models/chalet.mesh");
+    Core::Jobs::Task<Core::StatusOr<Assets::Texture>> textureLoad =
+          loadAsset<Assets::Texture>(jobs, "Textures/chalet_texture.texture");
+    Core::Jobs::SyncWait(jobs, Core::Jobs::WhenAll(jobs, meshLoad, textureLoad));
+
+    ASSIGN_OR_RETURN(MappedMesh model, std::move(meshLoad).result());
+    ASSIGN_OR_RETURN(Assets::Texture textureAsset, std::move(textureLoad).result());
+
+    RETURN_IF_ERROR(createVertexBuffer(backend, model.mesh));
+    RETURN_IF_ERROR(createTextureImage(backend, textureAsset));
 
     createDrawDataBuffers(backend);
 
@@ -185,7 +217,10 @@ void RenderGUI() {
     ImGui::ShowDemoWindow(&windowShowned);
 }
 
-Core::Status drawFrame(GUI::Window& window, Core::Clock::Seconds delta, VulkanRendererBackend& backend) {
+Core::Status drawFrame(GUI::Window& window,
+                       Core::Clock::Seconds delta,
+                       VulkanRendererBackend& backend,
+                       Core::Memory::FrameAllocator& frameAllocator) {
     VulkanSwapChain& swapChain = *backend.getSwapChain();
 
     static UniformBufferObject ubo = {
@@ -195,19 +230,22 @@ Core::Status drawFrame(GUI::Window& window, Core::Clock::Seconds delta, VulkanRe
                            0.1f,
                            10000.0f)};
 
-    static Core::Array<InstanceBufferObject> instances = {
-          InstanceBufferObject{glm::mat4(1.0f)},
-          InstanceBufferObject{glm::mat4(1.0f)},
-    };
+    // Only the first column is uploaded, the rotation speeds never leave the CPU
+    static Core::SoAArray<InstanceBufferObject, float> instances = [] {
+        Core::SoAArray<InstanceBufferObject, float> initialInstances;
+        initialInstances.emplace(InstanceBufferObject{glm::mat4(1.0f)}, glm::radians(90.0f));
+        initialInstances.emplace(InstanceBufferObject{glm::mat4(1.0f)}, glm::radians(180.0f));
+        return initialInstances;
+    }();
 
+    Core::Span<InstanceBufferObject> models = instances.column<0>();
+    Core::Span<const float> speeds          = instances.column<1>();
     for(uint32_t i = 0; i < instances.count(); i++) {
-        float rads  = glm::radians(90.0f);
-        float angle = delta.count() * rads * (i + 1);
+        float angle = delta.count() * speeds[i];
 
-        instances[i].model = glm::rotate(instances[i].model, angle, glm::vec3(0, 0, 1));
+        models[i].model = glm::rotate(models[i].model, angle, glm::vec3(0, 0, 1));
     }
 
-
     if(window.hasResized(true)) {
         Core::Log::Info(Test, "Recreating swap chain");
         recreateSwapChain(window, backend);
@@ -217,14 +255,16 @@ Core::Status drawFrame(GUI::Window& window, Core::Clock::Seconds delta, VulkanRe
                                           10000.0f);
     }
 
-    instanceBuffers[currentFrame].upload(Core::AsBytes(instances));
+    instanceBuffers[currentFrame].upload(Core::AsBytes(instances.column<0>()));
     uniformBuffers[currentFrame].upload(Core::ToBytes(ubo));
 
-    Core::Array<VulkanFrameCommands> commandList;
-    VulkanFrameCommands& commands = commandList.emplace();
+    Core::Memory::ResourceAllocator frameMemory(&frameAllocator);
+
+    Core::Array<VulkanFrameCommands, Core::Memory::ResourceAllocator> commandList(frameMemory);
+    VulkanFrameCommands& commands = commandList.emplace(frameMemory);
 
     VulkanDrawMeshInstancedCommand& draw = commands.instanceMeshCommands.emplace();
-    draw.mesh                            = &mesh;
+    draw.mesh                            = mesh;
     draw.pipeline                        = graphicsPipeline;
     draw.uniformDescriptorSet            = uniformBuffersDescriptors[currentFrame];
     draw.instanceDataBuffer              = instanceBuffers[currentFrame];
@@ -235,7 +275,7 @@ Core::Status drawFrame(GUI::Window& window, Core::Clock::Seconds delta, VulkanRe
         ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(), commandBuffer);
     });
 
-    return backend.submitCommands(commandList);
+    return backend.submitCommands(Core::ToSpan(commandList));
 }
 
 Core::Status run() {
@@ -258,7 +298,8 @@ Core::Status run() {
                                                    {},
                                                    {}));
 
-    RETURN_IF_ERROR(initVulkanBackend(backend));
+    Core::Jobs::JobSystem jobs;
+    RETURN_IF_ERROR(initVulkanBackend(jobs, backend));
 
     VulkanSwapChain& swapChain = *backend.getSwapChain();
     ImGui::CreateContext();
@@ -289,15 +330,17 @@ Core::Status run() {
     VK_CHECK(vkEndCommandBuffer(buffer));
     transferQueue.submit(buffer, VulkanQueueSubmitType::Transfer);
     vkQueueWaitIdle(transferQueue);
-    transferQueue.pool.freeBuffers(backend.getLogicalDevice(), {buffer});
+    transferQueue.pool.freeBuffer(backend.getLogicalDevice(), buffer);
 
     Core::SystemClockTicker ticker;
+    Core::Memory::FrameAllocator frameAllocator("Frame", 16 * 1024 * 1024);
     Core::Clock clock;
     Core::Clock clock2;
     Core::Timer timer(&clock2);
 
     ticker.registerClock(&clock);
     ticker.registerClock(&clock2);
+    ticker.registerFrameAllocator(&frameAllocator);
 
     double changePerSecond = -0.45;
     Core::Clock::Seconds period(2.0f);
@@ -318,7 +361,7 @@ Core::Status run() {
 
         RenderGUI();
 
-        Core::Status drawStatus = drawFrame(*window, clock.tickedTime(), backend);
+        Core::Status drawStatus = drawFrame(*window, clock.tickedTime(), backend, frameAllocator);
         if(drawStatus.isError()) {
             Core::Log::Error(Test, drawStatus.message());
         }